@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef WOJI_CONCEPTS_HPP
+#define WOJI_CONCEPTS_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+/**
+ * @file Concepts.hpp
+ * @brief Element-type requirements used to select Matrix kernels.
+ *
+ * Matrix<T> itself accepts any element type. Operations that need arithmetic
+ * inspect these concepts and pick the most suitable algorithm:
+ *  - TriviallyRelocatableArithmetic types get contiguous pointer kernels that
+ *    the compiler can vectorize.
+ *  - ApproximateField types (floating point) get partial pivoting with a
+ *    tolerance and fused multiply-add row updates.
+ *  - EuclideanRing types (integers) get fraction-free elimination, so
+ *    determinants and ranks are exact instead of truncated.
+ *  - Any other Field (e.g. Rational) uses exact Gauss-Jordan elimination.
+ */
+
+/**
+ * @brief A commutative ring with identity: `T{}` is zero, `T{1}` is one, and
+ * addition, negation and multiplication are closed.
+ */
+template <typename T>
+concept Ring = std::regular<T> && std::constructible_from<T, int> &&
+  requires(T a, const T b) {
+    { a + b } -> std::convertible_to<T>;
+    { a * b } -> std::convertible_to<T>;
+    { -b } -> std::convertible_to<T>;
+    { a += b } -> std::same_as<T&>;
+    { a *= b } -> std::same_as<T&>;
+  };
+
+/** A Ring that additionally supports division. */
+template <typename T>
+concept Field = Ring<T> && requires(T a, const T b) {
+  { a / b } -> std::convertible_to<T>;
+};
+
+/**
+ * @brief A built-in arithmetic type whose objects can be moved with memcpy and
+ * processed by vectorized pointer loops.
+ */
+template <typename T>
+concept TriviallyRelocatableArithmetic = std::is_arithmetic_v<T> && std::is_trivially_copyable_v<T>;
+
+/** A Field whose arithmetic rounds, so comparisons against zero need a tolerance. */
+template <typename T>
+concept ApproximateField = Field<T> && std::floating_point<T>;
+
+/** A Ring whose division truncates, so elimination must avoid fractions. */
+template <typename T>
+concept EuclideanRing = Ring<T> && std::integral<T> && !std::same_as<T, bool>;
+
+/**
+ * @brief A matrix-free linear operator: anything that can compute `y = A x`.
+ *
+ * Implemented by Matrix and SparseMatrix; iterative solvers such as lanczos()
+ * only ever touch the operator through apply(), so any structured or implicit
+ * operator with these members can be passed instead.
+ */
+template <typename Op>
+concept LinearOperator = requires(const Op& op, std::span<const typename Op::value_type> x,
+    std::span<typename Op::value_type> y) {
+  { op.rows() } -> std::convertible_to<std::size_t>;
+  { op.cols() } -> std::convertible_to<std::size_t>;
+  op.apply(x, y);
+};
+
+#endif
@@ -0,0 +1,201 @@
+#pragma once
+
+#ifndef WOJI_CSV_HPP
+#define WOJI_CSV_HPP
+
+#include <lin_alg/MappedFile.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+#include <lin_alg/TextParsing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @file Csv.hpp
+ * @brief High-throughput loading of delimited text matrices.
+ *
+ * The input is memory-mapped and split into newline-aligned chunks. A first
+ * parallel pass counts the rows of every chunk, which fixes the row each chunk
+ * starts at. A second parallel pass parses values with std::from_chars directly
+ * into a preallocated Matrix<T>.
+ */
+
+/** Options controlling how delimited text is interpreted. */
+struct CsvOptions {
+  /**
+   * Character separating values within a row. A space or tab delimiter treats
+   * any run of blanks as a single separator.
+   */
+  char delimiter = ',';
+
+  /** Number of leading lines (e.g. column titles) to ignore. */
+  std::size_t skip_lines = 0;
+};
+
+namespace lin_alg::detail {
+
+/** Minimum number of bytes handed to a single parsing thread. */
+inline constexpr std::size_t CSV_MIN_CHUNK_BYTES = std::size_t{1} << 20;
+
+/** Returns true if the line starting at @p p contains only blanks. */
+inline bool is_blank_line(const char* p, const char* end)
+{
+  p = skip_blanks(p, end);
+  return p == end || *p == '\n';
+}
+
+/**
+ * @brief Parses one row of @p cols values starting at @p p into @p out.
+ *
+ * @return Number of values found on the line; parsing stops after @p cols values
+ * when @p out is non-null.
+ */
+template <typename T>
+std::size_t parse_csv_row(const char* p, const char* end, const CsvOptions& opts,
+    std::size_t cols, T* out)
+{
+  const bool blank_sep = opts.delimiter == ' ' || opts.delimiter == '\t';
+  std::size_t n = 0;
+
+  p = skip_blanks(p, end);
+  while (p != end && *p != '\n') {
+    if (out && n == cols)
+      throw std::runtime_error("Row has more values than the first row.");
+
+    T value;
+    p = parse_value(p, end, value);
+    if (out) out[n] = value;
+    ++n;
+
+    p = skip_blanks(p, end);
+    if (p == end || *p == '\n') break;
+    if (!blank_sep) {
+      if (*p != opts.delimiter)
+        throw std::runtime_error("Unexpected character '" + std::string(1, *p) + "' in delimited text.");
+      p = skip_blanks(p + 1, end);
+      if (p == end || *p == '\n')
+        throw std::runtime_error("Row ends with a delimiter.");
+    }
+  }
+  return n;
+}
+
+/**
+ * Rethrows a parse error with the 1-based number of the line it came from, as a
+ * std::runtime_error whichever of the value parser's exceptions it was.
+ */
+[[noreturn]] inline void rethrow_at_line(const std::exception& e, std::size_t line)
+{
+  throw std::runtime_error("Line " + std::to_string(line) + ": " + e.what());
+}
+
+} // namespace lin_alg::detail
+
+// ==============================================================================
+// Loading
+// ==============================================================================
+
+/**
+ * @brief Parses delimited text into a matrix, one line per row.
+ *
+ * @tparam T Element type; any arithmetic type, or Rational written as `a/b`.
+ * @param text The delimited text.
+ * @param opts Delimiter and number of header lines to skip.
+ * @return A matrix with one row per non-blank line.
+ *
+ * @throws std::invalid_argument If there are no rows.
+ * @throws std::runtime_error If a value is malformed (including a Rational with a
+ * zero denominator), a row ends with a delimiter or rows differ in length. The
+ * message starts with the 1-based line number.
+ */
+template <typename T>
+Matrix<T> parse_csv(std::string_view text, const CsvOptions& opts = {})
+{
+  using namespace lin_alg::detail;
+  const char* p = text.data();
+  const char* end = p + text.size();
+
+  // 1-based number of the line at p
+  std::size_t line = 1;
+  for (std::size_t i = 0; i < opts.skip_lines && p != end; ++i, ++line)
+    p = next_line(p, end);
+  for (; p != end && is_blank_line(p, end); ++line)
+    p = next_line(p, end);
+  if (p == end)
+    throw std::invalid_argument("Matrix must have at least one row.");
+
+  std::size_t cols = 0;
+  try {
+    cols = parse_csv_row<T>(p, end, opts, 0, nullptr);
+  } catch (const std::runtime_error& e) {
+    rethrow_at_line(e, line);
+  } catch (const std::invalid_argument& e) {
+    rethrow_at_line(e, line);
+  }
+
+  const std::size_t bytes = static_cast<std::size_t>(end - p);
+  const std::size_t parts = std::clamp<std::size_t>(bytes / CSV_MIN_CHUNK_BYTES, 1, hardware_threads());
+  const auto bounds = split_lines(p, end, parts);
+  const std::size_t chunks = bounds.size() - 1;
+
+  // Pass 1: count rows and lines per chunk
+  std::vector<std::size_t> first_row(chunks + 1, 0), first_line(chunks + 1, 0);
+  parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i)
+      for (const char* q = bounds[i]; q != bounds[i + 1]; q = next_line(q, bounds[i + 1])) {
+        ++first_line[i + 1];
+        if (!is_blank_line(q, bounds[i + 1])) ++first_row[i + 1];
+      }
+  });
+  first_line[0] = line;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    first_row[i + 1] += first_row[i];
+    first_line[i + 1] += first_line[i];
+  }
+
+  // Pass 2: parse every row straight into the matrix
+  Matrix<T> m(first_row[chunks], cols);
+  T* out = m.data().data();
+  parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) {
+      const char* stop = bounds[i + 1];
+      std::size_t r = first_row[i], at = first_line[i];
+      for (const char* q = bounds[i]; q != stop; q = next_line(q, stop), ++at) {
+        if (is_blank_line(q, stop)) continue;
+        try {
+          if (parse_csv_row(q, stop, opts, cols, out + r * cols) != cols)
+            throw std::runtime_error("Row has fewer values than the first row.");
+        } catch (const std::runtime_error& e) {
+          rethrow_at_line(e, at);
+        } catch (const std::invalid_argument& e) {
+          rethrow_at_line(e, at);
+        }
+        ++r;
+      }
+    }
+  });
+
+  return m;
+}
+
+/**
+ * @brief Loads a delimited text file into a matrix.
+ *
+ * @see parse_csv()
+ *
+ * @throws std::runtime_error If the file cannot be opened or parsed.
+ */
+template <typename T>
+Matrix<T> read_csv(const std::filesystem::path& path, const CsvOptions& opts = {})
+{
+  MappedFile file(path);
+  return parse_csv<T>(file.view(), opts);
+}
+
+#endif
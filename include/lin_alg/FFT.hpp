@@ -0,0 +1,292 @@
+#pragma once
+
+#ifndef WOJI_FFT_HPP
+#define WOJI_FFT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @file FFT.hpp
+ * @brief Discrete Fourier transforms of any length, without external dependencies.
+ *
+ * Lengths whose prime factors are all small run a mixed-radix Stockham
+ * transform: one pass per factor (radix 4, 2, 3, then any other prime up to
+ * FFT_MAX_RADIX), ping-ponging between two buffers so that no bit-reversal is
+ * needed and every butterfly's innermost loop runs over contiguous elements.
+ * Other lengths use Bluestein's algorithm, a convolution evaluated with a
+ * power-of-two transform. Either way the cost is O(n log n).
+ *
+ * Plans (factorization and twiddle factors) are built once per length and
+ * element type and cached for the lifetime of the program.
+ */
+
+namespace lin_alg::detail {
+
+/** Largest prime factor handled by a direct butterfly; longer primes use Bluestein. */
+inline constexpr std::size_t FFT_MAX_RADIX = 64;
+
+/**
+ * @brief A precomputed forward DFT of one length: `X[k] = Σ_j x[j] e^(-2πi jk/n)`.
+ */
+template <std::floating_point T>
+class FFTPlan {
+private:
+  using C = std::complex<T>;
+
+  /** One Stockham pass: radix r on sub-transforms of length `len`. */
+  struct Stage {
+    std::size_t radix;
+    std::size_t len;
+    /** Twiddles `e^(-2πi p u / len)` at `[p * radix + u]`. */
+    std::vector<C> twiddles;
+    /** Roots of unity `e^(-2πi t / radix)` for the generic butterfly. */
+    std::vector<C> roots;
+  };
+
+  std::size_t _n;
+  std::vector<Stage> _stages;
+
+  // Bluestein: chirp e^(-πi j²/n), the transform of the conjugate chirp, and a power-of-two plan
+  std::vector<C> _chirp;
+  std::vector<C> _kernel;
+  std::shared_ptr<const FFTPlan> _inner;
+
+  static C unit_root(std::size_t k, std::size_t n)
+  {
+    const double angle = -2.0 * std::numbers::pi * static_cast<double>(k % n) / static_cast<double>(n);
+    return C(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+  }
+
+  void stockham(C* data, C* work) const;
+  void bluestein(C* data) const;
+
+public:
+  /** Plans a transform of length @p n. */
+  explicit FFTPlan(std::size_t n);
+
+  /** Returns the transform length. */
+  std::size_t size() const noexcept { return _n; }
+
+  /** Replaces the size() elements at @p data by their forward DFT. */
+  void forward(C* data) const;
+
+  /** Replaces the size() elements at @p data by their inverse DFT, including the 1/n scaling. */
+  void inverse(C* data) const;
+};
+
+template <std::floating_point T>
+FFTPlan<T>::FFTPlan(std::size_t n) : _n(n)
+{
+  if (n == 0)
+    throw std::invalid_argument("Transform length must be positive.");
+
+  std::vector<std::size_t> factors;
+  std::size_t rest = n;
+  while (rest % 4 == 0) {
+    factors.push_back(4);
+    rest /= 4;
+  }
+  for (std::size_t p = 2; p * p <= rest; ++p)
+    while (rest % p == 0) {
+      factors.push_back(p);
+      rest /= p;
+    }
+  if (rest > 1) factors.push_back(rest);
+
+  bool direct = true;
+  for (std::size_t f : factors) direct = direct && f <= FFT_MAX_RADIX;
+
+  if (direct) {
+    std::size_t len = n;
+    for (std::size_t r : factors) {
+      Stage stage{r, len, std::vector<C>(len), std::vector<C>(r)};
+      const std::size_t m = len / r;
+      for (std::size_t p = 0; p < m; ++p)
+        for (std::size_t u = 0; u < r; ++u) stage.twiddles[p * r + u] = unit_root(p * u, len);
+      for (std::size_t t = 0; t < r; ++t) stage.roots[t] = unit_root(t, r);
+      _stages.push_back(std::move(stage));
+      len = m;
+    }
+    return;
+  }
+
+  // Bluestein: X[k] = w[k] Σ_j (x[j] w[j]) conj(w[k - j]) with w[j] = e^(-πi j²/n)
+  std::size_t size = 1;
+  while (size < 2 * n - 1) size *= 2;
+  _chirp.resize(n);
+  for (std::size_t j = 0; j < n; ++j) {
+    const std::uint64_t square = (static_cast<std::uint64_t>(j) * j) % (2 * static_cast<std::uint64_t>(n));
+    _chirp[j] = unit_root(static_cast<std::size_t>(square), 2 * n);
+  }
+  _kernel.assign(size, C{});
+  _kernel[0] = std::conj(_chirp[0]);
+  for (std::size_t j = 1; j < n; ++j) _kernel[j] = _kernel[size - j] = std::conj(_chirp[j]);
+  _inner = std::make_shared<const FFTPlan>(size);
+  _inner->forward(_kernel.data());
+}
+
+template <std::floating_point T>
+void FFTPlan<T>::stockham(C* data, C* work) const
+{
+  C* x = data;
+  C* y = work;
+  std::size_t s = 1;
+  for (const Stage& stage : _stages) {
+    const std::size_t r = stage.radix, m = stage.len / r;
+    const C* w = stage.twiddles.data();
+
+    // Input element t of butterfly (p, q) sits at q + s (p + t m); output u goes to q + s (r p + u)
+    for (std::size_t p = 0; p < m; ++p) {
+      const C* in = x + s * p;
+      C* out = y + s * r * p;
+      const C* tw = w + p * r;
+      if (r == 2) {
+        for (std::size_t q = 0; q < s; ++q) {
+          const C a = in[q], b = in[q + s * m];
+          out[q] = a + b;
+          out[q + s] = (a - b) * tw[1];
+        }
+      } else if (r == 4) {
+        for (std::size_t q = 0; q < s; ++q) {
+          const C a0 = in[q], a1 = in[q + s * m], a2 = in[q + 2 * s * m], a3 = in[q + 3 * s * m];
+          const C e = a0 + a2, f = a0 - a2, g = a1 + a3;
+          const C h = a1 - a3, mih(h.imag(), -h.real());
+          out[q] = e + g;
+          out[q + s] = (f + mih) * tw[1];
+          out[q + 2 * s] = (e - g) * tw[2];
+          out[q + 3 * s] = (f - mih) * tw[3];
+        }
+      } else if (r == 3) {
+        const T half_sqrt3 = static_cast<T>(std::numbers::sqrt3 / 2);
+        for (std::size_t q = 0; q < s; ++q) {
+          const C a0 = in[q], a1 = in[q + s * m], a2 = in[q + 2 * s * m];
+          const C sum = a1 + a2, diff = a1 - a2;
+          const C mid = a0 - sum * T(0.5), rot(diff.imag() * half_sqrt3, -diff.real() * half_sqrt3);
+          out[q] = a0 + sum;
+          out[q + s] = (mid + rot) * tw[1];
+          out[q + 2 * s] = (mid - rot) * tw[2];
+        }
+      } else {
+        std::array<C, FFT_MAX_RADIX> a;
+        for (std::size_t q = 0; q < s; ++q) {
+          for (std::size_t t = 0; t < r; ++t) a[t] = in[q + t * s * m];
+          for (std::size_t u = 0; u < r; ++u) {
+            C sum = a[0];
+            for (std::size_t t = 1; t < r; ++t) sum += a[t] * stage.roots[(t * u) % r];
+            out[q + u * s] = sum * tw[u];
+          }
+        }
+      }
+    }
+    std::swap(x, y);
+    s *= r;
+  }
+  if (x != data) std::copy(x, x + _n, data);
+}
+
+template <std::floating_point T>
+void FFTPlan<T>::bluestein(C* data) const
+{
+  const std::size_t size = _kernel.size();
+  std::vector<C> a(size);
+  for (std::size_t j = 0; j < _n; ++j) a[j] = data[j] * _chirp[j];
+  _inner->forward(a.data());
+  for (std::size_t k = 0; k < size; ++k) a[k] *= _kernel[k];
+  _inner->inverse(a.data());
+  for (std::size_t k = 0; k < _n; ++k) data[k] = a[k] * _chirp[k];
+}
+
+template <std::floating_point T>
+void FFTPlan<T>::forward(C* data) const
+{
+  if (_inner) {
+    bluestein(data);
+  } else if (!_stages.empty()) {
+    std::vector<C> work(_n);
+    stockham(data, work.data());
+  }
+}
+
+template <std::floating_point T>
+void FFTPlan<T>::inverse(C* data) const
+{
+  // ifft(x) = conj(fft(conj(x))) / n
+  for (std::size_t i = 0; i < _n; ++i) data[i] = std::conj(data[i]);
+  forward(data);
+  const T scale = T{1} / static_cast<T>(_n);
+  for (std::size_t i = 0; i < _n; ++i) data[i] = std::conj(data[i]) * scale;
+}
+
+/** Returns the cached plan for length @p n, building it on first use. Thread-safe. */
+template <std::floating_point T>
+std::shared_ptr<const FFTPlan<T>> fft_plan(std::size_t n)
+{
+  static std::mutex mutex;
+  static std::unordered_map<std::size_t, std::shared_ptr<const FFTPlan<T>>> cache;
+  {
+    const std::lock_guard<std::mutex> lock(mutex);
+    if (auto it = cache.find(n); it != cache.end()) return it->second;
+  }
+  auto plan = std::make_shared<const FFTPlan<T>>(n);
+  const std::lock_guard<std::mutex> lock(mutex);
+  return cache.emplace(n, std::move(plan)).first->second;
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Returns the discrete Fourier transform `X[k] = Σ_j x[j] e^(-2πi jk/n)`.
+ *
+ * @throws std::invalid_argument If @p x is empty.
+ */
+template <std::floating_point T>
+std::vector<std::complex<T>> fft(std::span<const std::complex<T>> x)
+{
+  std::vector<std::complex<T>> result(x.begin(), x.end());
+  lin_alg::detail::fft_plan<T>(x.size())->forward(result.data());
+  return result;
+}
+
+/**
+ * @brief Returns the inverse discrete Fourier transform
+ * `x[j] = (1/n) Σ_k X[k] e^(2πi jk/n)`.
+ *
+ * @throws std::invalid_argument If @p X is empty.
+ */
+template <std::floating_point T>
+std::vector<std::complex<T>> ifft(std::span<const std::complex<T>> X)
+{
+  std::vector<std::complex<T>> result(X.begin(), X.end());
+  lin_alg::detail::fft_plan<T>(X.size())->inverse(result.data());
+  return result;
+}
+
+/** @overload */
+template <std::floating_point T>
+std::vector<std::complex<T>> fft(const std::vector<std::complex<T>>& x)
+{
+  return fft(std::span<const std::complex<T>>(x));
+}
+
+/** @overload */
+template <std::floating_point T>
+std::vector<std::complex<T>> ifft(const std::vector<std::complex<T>>& X)
+{
+  return ifft(std::span<const std::complex<T>>(X));
+}
+
+#endif
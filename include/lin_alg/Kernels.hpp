@@ -0,0 +1,628 @@
+#pragma once
+
+#ifndef WOJI_KERNELS_HPP
+#define WOJI_KERNELS_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file Kernels.hpp
+ * @brief Low-level loops over contiguous element ranges.
+ *
+ * Each kernel works on raw pointers with unit stride so that, for
+ * TriviallyRelocatableArithmetic types, the compiler can vectorize it. The
+ * element kernels are constexpr; fused multiply-add is only used at run time.
+ *
+ * The threaded run-time kernels (gemm_blocked(), gemm_update(), and the bodies
+ * of ger(), syrk() and gemv()) are explicitly instantiated for double, float
+ * and Rational in the `lin_alg_kernels` library; see the end of this file.
+ */
+
+namespace lin_alg::detail {
+
+/** Computes `a * x + y`, fused into a single rounding for floating types at run time. */
+template <typename T>
+constexpr T fma(const T& a, const T& x, const T& y)
+{
+  if constexpr (std::floating_point<T>) {
+    if (!std::is_constant_evaluated())
+      return std::fma(a, x, y);
+  }
+  return y + a * x;
+}
+
+/** Returns |v| without relying on std::abs being constexpr. */
+template <typename T>
+constexpr T magnitude(const T& v)
+{
+  return v < T{} ? -v : v;
+}
+
+/**
+ * @brief Returns the threshold below which an element of an @p rows x @p cols
+ * matrix is treated as zero during elimination.
+ *
+ * Scales machine epsilon by the largest dimension and the largest magnitude in
+ * @p a, so the test is invariant to uniformly rescaling the matrix. Rows of
+ * @p a start @p stride elements apart.
+ */
+template <ApproximateField T>
+constexpr T elimination_tolerance(std::size_t rows, std::size_t cols, const T* a, std::size_t stride)
+{
+  T largest{};
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < cols; ++j)
+      largest = std::max(largest, magnitude(a[i * stride + j]));
+  return std::numeric_limits<T>::epsilon() * static_cast<T>(std::max(rows, cols)) * largest;
+}
+
+/** @overload for a contiguous matrix. */
+template <ApproximateField T>
+constexpr T elimination_tolerance(std::size_t rows, std::size_t cols, const T* a)
+{
+  return elimination_tolerance(rows, cols, a, cols);
+}
+
+/**
+ * @brief Copies a @p rows x @p cols block between row-major buffers with the
+ * given row strides.
+ *
+ * Trivially copyable types are moved with one memcpy per row at run time, or a
+ * single memcpy when both blocks are contiguous.
+ *
+ * @note The blocks must not overlap.
+ */
+template <typename T>
+constexpr void copy_block(std::size_t rows, std::size_t cols,
+    const T* src, std::size_t src_stride, T* dst, std::size_t dst_stride)
+{
+  if (rows == 0 || cols == 0) return;
+  if (src_stride == cols && dst_stride == cols) {
+    cols *= rows;
+    rows = 1;
+  }
+
+  for (std::size_t r = 0; r < rows; ++r) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      if (!std::is_constant_evaluated()) {
+        std::memcpy(dst + r * dst_stride, src + r * src_stride, cols * sizeof(T));
+        continue;
+      }
+    }
+    std::copy_n(src + r * src_stride, cols, dst + r * dst_stride);
+  }
+}
+
+/** y[i] += alpha * x[i] for i in [0, n). */
+template <typename T>
+constexpr void axpy(std::size_t n, const T& alpha, const T* x, T* y)
+{
+  if constexpr (TriviallyRelocatableArithmetic<T>) {
+    const T a = alpha;
+    for (std::size_t i = 0; i < n; ++i)
+      y[i] = fma(a, x[i], y[i]);
+  } else {
+    for (std::size_t i = 0; i < n; ++i)
+      y[i] += alpha * x[i];
+  }
+}
+
+/** x[i] *= alpha for i in [0, n). */
+template <typename T>
+constexpr void scal(std::size_t n, const T& alpha, T* x)
+{
+  if constexpr (TriviallyRelocatableArithmetic<T>) {
+    const T a = alpha;
+    for (std::size_t i = 0; i < n; ++i)
+      x[i] *= a;
+  } else {
+    for (std::size_t i = 0; i < n; ++i)
+      x[i] *= alpha;
+  }
+}
+
+/** (x[i], y[i]) = (c x[i] - s y[i], s x[i] + c y[i]) for i in [0, n): a plane rotation (ROT). */
+template <typename T>
+constexpr void rot(std::size_t n, const T& c, const T& s, T* x, T* y)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    const T xi = x[i], yi = y[i];
+    x[i] = c * xi - s * yi;
+    y[i] = s * xi + c * yi;
+  }
+}
+
+/**
+ * @brief C = A * B for row-major A (m x k), B (k x n) and C (m x n).
+ *
+ * Arithmetic types use the i-k-j loop order: every inner iteration streams a
+ * contiguous row of B into a contiguous row of C, which vectorizes. Other types
+ * accumulate each dot product in a local, as the generic Matrix code always has.
+ *
+ * @note C must not alias A or B.
+ */
+template <typename T>
+constexpr void gemm(std::size_t m, std::size_t n, std::size_t k, const T* A, const T* B, T* C)
+{
+  if constexpr (TriviallyRelocatableArithmetic<T>) {
+    for (std::size_t i = 0; i < m; ++i) {
+      T* c = C + i * n;
+      for (std::size_t j = 0; j < n; ++j) c[j] = T{};
+      for (std::size_t p = 0; p < k; ++p) {
+        const T a = A[i * k + p];
+        const T* b = B + p * n;
+        for (std::size_t j = 0; j < n; ++j)
+          c[j] += a * b[j];
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < m; ++i)
+      for (std::size_t j = 0; j < n; ++j) {
+        T sum{};
+        for (std::size_t p = 0; p < k; ++p)
+          sum += A[i * k + p] * B[p * n + j];
+        C[i * n + j] = sum;
+      }
+  }
+}
+
+/** Minimum number of elements handed to a single thread by elementwise(). */
+inline constexpr std::size_t ELEMENTWISE_GRAIN = std::size_t{1} << 15;
+
+/**
+ * @brief out[i] = f(in[i]...) for i in [0, n).
+ *
+ * The one loop behind every element-wise Matrix operation. Each input is a
+ * unit-stride pointer, so the loop vectorizes for arithmetic types once @p f is
+ * inlined; large ranges are split across threads at run time. @p out may alias
+ * any input, which gives the in-place forms.
+ *
+ * @note @p f may be called concurrently and in any order.
+ */
+template <typename R, typename F, typename... Ts>
+constexpr void elementwise(std::size_t n, R* out, F f, const Ts*... in)
+{
+  auto range = [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i)
+      out[i] = f(in[i]...);
+  };
+
+  if (std::is_constant_evaluated())
+    range(0, n);
+  else
+    parallel_for(0, n, ELEMENTWISE_GRAIN, range);
+}
+
+/** Row, depth and column block sizes used by gemm_blocked(). */
+inline constexpr std::size_t GEMM_BLOCK_ROWS = 64;
+inline constexpr std::size_t GEMM_BLOCK_DEPTH = 256;
+inline constexpr std::size_t GEMM_BLOCK_COLS = 1024;
+
+/**
+ * @brief C += alpha * A * B for an @p m x @p k block A, a @p k x @p n block B and
+ * an @p m x @p n block C, each row-major with its own row stride.
+ *
+ * The depth and column loops are tiled so the active panel of B stays in cache
+ * while each row of C is updated with contiguous, vectorizable loops. Runs on
+ * the calling thread; see gemm_update() for the threaded form.
+ *
+ * @note C must not alias A or B.
+ */
+template <typename T>
+void gemm_acc(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+    const T* A, std::size_t lda, const T* B, std::size_t ldb, T* C, std::size_t ldc)
+{
+  for (std::size_t j0 = 0; j0 < n; j0 += GEMM_BLOCK_COLS) {
+    const std::size_t nb = std::min(GEMM_BLOCK_COLS, n - j0);
+    for (std::size_t p0 = 0; p0 < k; p0 += GEMM_BLOCK_DEPTH) {
+      const std::size_t p1 = std::min(k, p0 + GEMM_BLOCK_DEPTH);
+      for (std::size_t i0 = 0; i0 < m; i0 += GEMM_BLOCK_ROWS) {
+        const std::size_t i1 = std::min(m, i0 + GEMM_BLOCK_ROWS);
+        for (std::size_t i = i0; i < i1; ++i) {
+          T* c = C + i * ldc + j0;
+          for (std::size_t p = p0; p < p1; ++p) {
+            const T a = alpha * A[i * lda + p];
+            const T* b = B + p * ldb + j0;
+            for (std::size_t j = 0; j < nb; ++j)
+              c[j] += a * b[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Multithreaded gemm_acc(): rows of C are split across threads when the
+ * product is large enough to benefit.
+ */
+template <typename T>
+void gemm_update(std::size_t m, std::size_t n, std::size_t k, const T& alpha,
+    const T* A, std::size_t lda, const T* B, std::size_t ldb, T* C, std::size_t ldc)
+{
+  // Only go wide when every thread gets a meaningful amount of work
+  const std::size_t grain = m * n * k < (std::size_t{1} << 18)
+    ? m : std::max<std::size_t>(1, GEMM_BLOCK_ROWS / 4);
+
+  parallel_for(0, m, grain, [&](std::size_t lo, std::size_t hi) {
+    gemm_acc(hi - lo, n, k, alpha, A + lo * lda, lda, B, ldb, C + lo * ldc, ldc);
+  });
+}
+
+/**
+ * @brief Cache-blocked, multithreaded C = A * B with the same layout as gemm().
+ *
+ * Arithmetic types run gemm_update(); other types fall back to gemm(), which
+ * keeps their summation order.
+ *
+ * @note C must not alias A or B. Not usable in constant expressions.
+ */
+template <typename T>
+void gemm_blocked(std::size_t m, std::size_t n, std::size_t k, const T* A, const T* B, T* C)
+{
+  if constexpr (!TriviallyRelocatableArithmetic<T>) {
+    gemm(m, n, k, A, B, C);
+  } else {
+    std::fill(C, C + m * n, T{});
+    gemm_update(m, n, k, T{1}, A, k, B, n, C, n);
+  }
+}
+
+/**
+ * @brief Rank-1 update A += alpha * x * yᵀ of a row-major @p m x @p n matrix (GER),
+ * restricted to rows [lo, hi).
+ *
+ * Each row of A receives one axpy() with y. ger() covers every row, spread
+ * across threads at run time.
+ */
+template <typename T>
+constexpr void ger_rows(std::size_t lo, std::size_t hi, std::size_t n, const T& alpha, const T* x, const T* y, T* A)
+{
+  for (std::size_t i = lo; i < hi; ++i) {
+    const T s = alpha * x[i];
+    if (s != T{}) axpy(n, s, y, A + i * n);
+  }
+}
+
+/** Run-time ger(), with the rows of A split across threads. */
+template <typename T>
+void ger_threaded(std::size_t m, std::size_t n, const T& alpha, const T* x, const T* y, T* A)
+{
+  parallel_for(0, m, std::max<std::size_t>(1, ELEMENTWISE_GRAIN / n), [&](std::size_t lo, std::size_t hi) {
+    ger_rows(lo, hi, n, alpha, x, y, A);
+  });
+}
+
+template <typename T>
+constexpr void ger(std::size_t m, std::size_t n, const T& alpha, const T* x, const T* y, T* A)
+{
+  if (std::is_constant_evaluated())
+    ger_rows(0, m, n, alpha, x, y, A);
+  else
+    ger_threaded(m, n, alpha, x, y, A);
+}
+
+/** Upper-triangle rows t and n - 1 - t of syrk(), for every t in [lo, hi). */
+template <typename T>
+constexpr void syrk_pairs(std::size_t lo, std::size_t hi, std::size_t m, std::size_t n, const T* A, T* C)
+{
+  auto update_row = [&](std::size_t i, std::size_t r0, std::size_t r1) {
+    for (std::size_t r = r0; r < r1; ++r)
+      axpy(n - i, A[r * n + i], A + r * n + i, C + i * n + i);
+  };
+  for (std::size_t r0 = 0; r0 < m; r0 += GEMM_BLOCK_DEPTH) {
+    const std::size_t r1 = std::min(m, r0 + GEMM_BLOCK_DEPTH);
+    for (std::size_t t = lo; t < hi; ++t) {
+      update_row(t, r0, r1);
+      if (n - 1 - t != t) update_row(n - 1 - t, r0, r1);
+    }
+  }
+}
+
+/** Run-time upper triangle of syrk(), with the row pairs split across threads. */
+template <typename T>
+void syrk_threaded(std::size_t m, std::size_t n, const T* A, T* C)
+{
+  const std::size_t pairs = (n + 1) / 2;
+  parallel_for(0, pairs, m * n * n < (std::size_t{1} << 18) ? pairs : 1, [&](std::size_t lo, std::size_t hi) {
+    syrk_pairs(lo, hi, m, n, A, C);
+  });
+}
+
+/**
+ * @brief Gram product C = Aᵀ A of a row-major @p m x @p n matrix A (SYRK).
+ *
+ * Only the upper triangle is computed, as a sum of outer products of the rows
+ * of A, each one a contiguous axpy(); it is then mirrored into the lower
+ * triangle. Rows of C are paired short-with-long (i with n - 1 - i) so that
+ * threads get equal shares of the triangle, and rows of A are processed in
+ * panels so the rows of C being updated stay in cache.
+ *
+ * @note C must be a zero-initialized @p n x @p n buffer that does not alias A.
+ */
+template <typename T>
+constexpr void syrk(std::size_t m, std::size_t n, const T* A, T* C)
+{
+  if (std::is_constant_evaluated())
+    syrk_pairs(std::size_t{0}, (n + 1) / 2, m, n, A, C);
+  else
+    syrk_threaded(m, n, A, C);
+
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = i + 1; j < n; ++j)
+      C[j * n + i] = C[i * n + j];
+}
+
+/** Number of independent accumulators folded side by side within a block. */
+inline constexpr std::size_t REDUCE_LANES = 8;
+/** Number of indices folded sequentially before partial results are merged. */
+inline constexpr std::size_t REDUCE_BLOCK = 512;
+/** Number of blocks handed to a single thread by reduce(). */
+inline constexpr std::size_t REDUCE_TASK_BLOCKS = 64;
+
+/**
+ * @brief Folds indices [lo, hi) into REDUCE_LANES interleaved accumulators and
+ * merges them pairwise.
+ *
+ * Independent lanes break the loop-carried dependency on a single accumulator,
+ * which lets the compiler vectorize the fold without reassociating it.
+ */
+template <typename Acc, typename Step, typename Merge>
+constexpr Acc reduce_block(std::size_t lo, std::size_t hi, const Acc& identity, Step& step, Merge& merge)
+{
+  std::array<Acc, REDUCE_LANES> lanes;
+  lanes.fill(identity);
+
+  std::size_t i = lo;
+  for (; i + REDUCE_LANES <= hi; i += REDUCE_LANES)
+    for (std::size_t l = 0; l < REDUCE_LANES; ++l)
+      lanes[l] = step(lanes[l], i + l);
+  // Fewer than REDUCE_LANES indices remain; bounding on l as well lets the compiler see that
+  for (std::size_t l = 0; l < REDUCE_LANES && i < hi; ++i, ++l)
+    lanes[l] = step(lanes[l], i);
+
+  for (std::size_t w = REDUCE_LANES / 2; w > 0; w /= 2)
+    for (std::size_t l = 0; l < w; ++l)
+      lanes[l] = merge(lanes[l], lanes[l + w]);
+  return lanes[0];
+}
+
+/** Reduces blocks [first, last) of [0, n) as a balanced binary tree of merges. */
+template <typename Acc, typename Step, typename Merge>
+constexpr Acc reduce_tree(std::size_t first, std::size_t last, std::size_t n,
+    const Acc& identity, Step& step, Merge& merge)
+{
+  if (last - first == 1)
+    return reduce_block(first * REDUCE_BLOCK, std::min(n, (first + 1) * REDUCE_BLOCK),
+        identity, step, merge);
+  const std::size_t mid = first + (last - first) / 2;
+  return merge(reduce_tree(first, mid, n, identity, step, merge),
+      reduce_tree(mid, last, n, identity, step, merge));
+}
+
+/**
+ * @brief Reduces the indices [0, n) with blocked pairwise summation.
+ *
+ * @param n Number of indices.
+ * @param identity Starting value of every accumulator; must be neutral for @p merge.
+ * @param step Callable `Acc(Acc, std::size_t i)` folding index @p i into an accumulator.
+ * @param merge Associative callable `Acc(Acc, Acc)` combining two partial results.
+ *
+ * Indices are folded in blocks of REDUCE_BLOCK, and blocks are combined as a
+ * balanced tree, so rounding error grows with log(n) rather than n. Large inputs
+ * spread groups of blocks across threads; the grouping is independent of the
+ * thread count, so results are reproducible.
+ *
+ * @note @p step and @p merge may be called concurrently at run time.
+ */
+template <typename Acc, typename Step, typename Merge>
+constexpr Acc reduce(std::size_t n, const Acc& identity, Step step, Merge merge)
+{
+  if (n == 0) return identity;
+  const std::size_t blocks = (n + REDUCE_BLOCK - 1) / REDUCE_BLOCK;
+  if (std::is_constant_evaluated() || blocks <= REDUCE_TASK_BLOCKS)
+    return reduce_tree(0, blocks, n, identity, step, merge);
+
+  const std::size_t tasks = (blocks + REDUCE_TASK_BLOCKS - 1) / REDUCE_TASK_BLOCKS;
+  std::vector<Acc> partial(tasks, identity);
+  parallel_for(0, tasks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t t = lo; t < hi; ++t)
+      partial[t] = reduce_tree(t * REDUCE_TASK_BLOCKS,
+          std::min(blocks, (t + 1) * REDUCE_TASK_BLOCKS), n, identity, step, merge);
+  });
+
+  for (std::size_t w = 1; w < tasks; w *= 2)
+    for (std::size_t t = 0; t + w < tasks; t += 2 * w)
+      partial[t] = merge(partial[t], partial[t + w]);
+  return partial[0];
+}
+
+/** Returns the sum of x[i] * y[i] for i in [0, n), using reduce(). */
+template <typename T>
+constexpr T dot(std::size_t n, const T* x, const T* y)
+{
+  return reduce(n, T{},
+      [x, y](const T& acc, std::size_t i) { return fma(x[i], y[i], acc); },
+      [](const T& a, const T& b) { return a + b; });
+}
+
+/** Run-time gemv(), with the rows of A split across threads. */
+template <typename T>
+void gemv_threaded(std::size_t m, std::size_t n, const T* A, const T* x, T* y)
+{
+  parallel_for(0, m, std::max<std::size_t>(1, REDUCE_BLOCK * REDUCE_TASK_BLOCKS / (n + 1)),
+      [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t r = lo; r < hi; ++r) y[r] = dot(n, A + r * n, x);
+  });
+}
+
+/**
+ * @brief y = A x for a row-major @p m x @p n matrix A (GEMV).
+ *
+ * Each element of y is a dot() of one contiguous row; rows are spread across
+ * threads at run time.
+ */
+template <typename T>
+constexpr void gemv(std::size_t m, std::size_t n, const T* A, const T* x, T* y)
+{
+  if (std::is_constant_evaluated()) {
+    for (std::size_t r = 0; r < m; ++r) y[r] = dot(n, A + r * n, x);
+  } else {
+    gemv_threaded(m, n, A, x, y);
+  }
+}
+
+/**
+ * @brief Returns, for each row of a row-major @p rows x @p cols matrix, the sum
+ * of `map(a_ij)` over its columns.
+ *
+ * Each row is summed with reduce(); rows are spread across threads at run time.
+ */
+template <typename T, typename Map>
+constexpr std::vector<T> row_reduce(std::size_t rows, std::size_t cols, const T* a, Map map)
+{
+  std::vector<T> out(rows, T{});
+  auto rows_range = [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t r = lo; r < hi; ++r) {
+      const T* row = a + r * cols;
+      out[r] = reduce(cols, T{},
+          [row, &map](const T& acc, std::size_t j) { return acc + map(row[j]); },
+          [](const T& x, const T& y) { return x + y; });
+    }
+  };
+
+  if (std::is_constant_evaluated())
+    rows_range(0, rows);
+  else
+    parallel_for(0, rows, std::max<std::size_t>(1, REDUCE_BLOCK * REDUCE_TASK_BLOCKS / cols), rows_range);
+  return out;
+}
+
+/**
+ * @brief Returns, for each column of a row-major @p rows x @p cols matrix, the
+ * sum of `map(a_ij)` over its rows.
+ *
+ * Rows are accumulated in groups of contiguous row updates, which vectorize
+ * across the columns; group results are merged pairwise. As with reduce(), the
+ * grouping does not depend on the thread count.
+ */
+template <typename T, typename Map>
+constexpr std::vector<T> column_reduce(std::size_t rows, std::size_t cols, const T* a, Map map)
+{
+  const std::size_t group = std::max<std::size_t>(1, REDUCE_BLOCK * REDUCE_TASK_BLOCKS / cols);
+  const std::size_t groups = (rows + group - 1) / group;
+
+  std::vector<std::vector<T>> partial(groups, std::vector<T>(cols, T{}));
+  auto groups_range = [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t g = lo; g < hi; ++g) {
+      T* sums = partial[g].data();
+      for (std::size_t r = g * group; r < std::min(rows, (g + 1) * group); ++r) {
+        const T* row = a + r * cols;
+        for (std::size_t j = 0; j < cols; ++j)
+          sums[j] += map(row[j]);
+      }
+    }
+  };
+
+  if (std::is_constant_evaluated())
+    groups_range(0, groups);
+  else
+    parallel_for(0, groups, 1, groups_range);
+
+  for (std::size_t w = 1; w < groups; w *= 2)
+    for (std::size_t g = 0; g + w < groups; g += 2 * w)
+      for (std::size_t j = 0; j < cols; ++j)
+        partial[g][j] += partial[g + w][j];
+  return std::move(partial[0]);
+}
+
+/** Outcome of fraction_free_eliminate(). */
+struct FractionFreeResult {
+  /** Number of pivots found. */
+  std::size_t rank;
+  /** True if an odd number of row swaps were performed. */
+  bool odd_swaps;
+};
+
+/**
+ * @brief Reduces a row-major @p rows x @p cols matrix to row echelon form in
+ * place using Bareiss' fraction-free elimination.
+ *
+ * Every division is exact, so integral element types never truncate. On a
+ * square, nonsingular input the last diagonal element is the determinant up to
+ * the sign given by the swap parity.
+ */
+template <EuclideanRing T>
+constexpr FractionFreeResult fraction_free_eliminate(std::size_t rows, std::size_t cols, T* a)
+{
+  T prev{1};
+  std::size_t r = 0;
+  bool odd_swaps = false;
+
+  for (std::size_t c = 0; c < cols && r < rows; ++c) {
+    std::size_t i = r;
+    while (i < rows && a[i * cols + c] == T{})
+      ++i;
+    if (i == rows) continue;
+
+    if (i != r) {
+      std::swap_ranges(a + i * cols, a + i * cols + cols, a + r * cols);
+      odd_swaps = !odd_swaps;
+    }
+
+    const T pivot = a[r * cols + c];
+    for (std::size_t k = r + 1; k < rows; ++k) {
+      const T f = a[k * cols + c];
+      for (std::size_t j = c + 1; j < cols; ++j)
+        a[k * cols + j] = (pivot * a[k * cols + j] - f * a[r * cols + j]) / prev;
+      a[k * cols + c] = T{};
+    }
+    prev = pivot;
+    ++r;
+  }
+  return FractionFreeResult{r, odd_swaps};
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * Declares one explicit instantiation of every threaded run-time kernel for
+ * element type T. Expanded with `extern` below, and without it in
+ * src/Kernels.cpp. These are the kernels worth precompiling: each one pulls in
+ * parallel_for() and its thread machinery, and none is small enough to gain from
+ * inlining. The constexpr kernels dispatch to them at run time.
+ */
+#define LIN_ALG_KERNEL_INSTANTIATIONS(EXTERN, T) \
+  EXTERN template void lin_alg::detail::gemm_acc<T>(std::size_t, std::size_t, std::size_t, const T&, \
+      const T*, std::size_t, const T*, std::size_t, T*, std::size_t); \
+  EXTERN template void lin_alg::detail::gemm_update<T>(std::size_t, std::size_t, std::size_t, const T&, \
+      const T*, std::size_t, const T*, std::size_t, T*, std::size_t); \
+  EXTERN template void lin_alg::detail::gemm_blocked<T>(std::size_t, std::size_t, std::size_t, \
+      const T*, const T*, T*); \
+  EXTERN template void lin_alg::detail::ger_threaded<T>(std::size_t, std::size_t, const T&, \
+      const T*, const T*, T*); \
+  EXTERN template void lin_alg::detail::syrk_threaded<T>(std::size_t, std::size_t, const T*, T*); \
+  EXTERN template void lin_alg::detail::gemv_threaded<T>(std::size_t, std::size_t, const T*, const T*, T*);
+
+#ifdef LIN_ALG_KERNELS
+// Provided by the lin_alg_kernels library (src/Kernels.cpp). Declaring the
+// Rational copies only needs the class name, so this header stays independent
+// of Rational.hpp.
+class Rational;
+
+LIN_ALG_KERNEL_INSTANTIATIONS(extern, double)
+LIN_ALG_KERNEL_INSTANTIATIONS(extern, float)
+LIN_ALG_KERNEL_INSTANTIATIONS(extern, Rational)
+#endif
+
+#endif
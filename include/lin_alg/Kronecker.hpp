@@ -0,0 +1,200 @@
+#pragma once
+
+#ifndef WOJI_KRONECKER_HPP
+#define WOJI_KRONECKER_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/LU.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file Kronecker.hpp
+ * @brief Kronecker products, dense and structured.
+ *
+ * For an m x n matrix A and a p x q matrix B, `A ⊗ B` is the (mp) x (nq) block
+ * matrix whose (i, j) block is `a_ij * B`. With vectors flattened row-major
+ * (`x[j * q + l] = X[j][l]`), the identity `(A ⊗ B) vec(X) = vec(A X Bᵀ)` lets
+ * KroneckerMatrix multiply and solve without ever forming the product.
+ */
+
+/**
+ * @brief Computes the Kronecker product `A ⊗ B`.
+ *
+ * Every output row is a sequence of scaled copies of one row of B, written with
+ * contiguous, vectorizable loops; output rows are spread across threads.
+ */
+template <typename T>
+Matrix<T> kron(const Matrix<T>& A, const Matrix<T>& B)
+{
+  const std::size_t m = A.rows(), n = A.cols(), p = B.rows(), q = B.cols();
+  Matrix<T> K(m * p, n * q);
+  const T* a = A.data().data();
+  const T* b = B.data().data();
+  T* out = K.data().data();
+
+  lin_alg::detail::parallel_for(0, m * p, std::max<std::size_t>(1, 4096 / (n * q)),
+      [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t row = lo; row < hi; ++row) {
+      const std::size_t i = row / p, k = row % p;
+      const T* b_row = b + k * q;
+      T* dst = out + row * n * q;
+      for (std::size_t j = 0; j < n; ++j) {
+        const T s = a[i * n + j];
+        for (std::size_t l = 0; l < q; ++l)
+          dst[j * q + l] = s * b_row[l];
+      }
+    }
+  });
+  return K;
+}
+
+/**
+ * @brief A lazily evaluated Kronecker product `A ⊗ B`.
+ *
+ * @tparam T Element type.
+ *
+ * Stores only A and B. Multiplying by a vector costs O(mq(n + p)) instead of
+ * O(mnpq), and solving factorizes A and B separately (O(n³ + q³)) rather than
+ * the (nq) x (nq) product (O(n³q³)).
+ */
+template <typename T>
+class KroneckerMatrix {
+private:
+  Matrix<T> _a;
+  Matrix<T> _b;
+
+  /** Factorizations of A and B, computed once by the first solve(). */
+  struct Factors {
+    std::once_flag once;
+    std::optional<LU<T>> a;
+    std::optional<LU<T>> b;
+  };
+
+  /** Shared by copies, which hold the same immutable A and B. */
+  std::shared_ptr<Factors> _factors = std::make_shared<Factors>();
+
+  /** Columns of a row of `A X` formed at a time by apply(). */
+  static constexpr std::size_t APPLY_TILE = 64;
+
+public:
+  using value_type = T;
+
+  /** Represents `A ⊗ B`; the factors are stored by value. */
+  KroneckerMatrix(Matrix<T> A, Matrix<T> B) : _a(std::move(A)), _b(std::move(B)) { }
+
+  /** Returns the left factor, A. */
+  const Matrix<T>& left() const noexcept { return _a; }
+  /** Returns the right factor, B. */
+  const Matrix<T>& right() const noexcept { return _b; }
+
+  /** Returns the number of rows of the product, `A.rows() * B.rows()`. */
+  std::size_t rows() const noexcept { return _a.rows() * _b.rows(); }
+  /** Returns the number of columns of the product, `A.cols() * B.cols()`. */
+  std::size_t cols() const noexcept { return _a.cols() * _b.cols(); }
+
+  /** Materializes the product; see kron(). */
+  Matrix<T> to_dense() const { return kron(_a, _b); }
+
+  /**
+   * @brief Computes `(A ⊗ B) x` as `vec(A X Bᵀ)`.
+   *
+   * @param x A vector of size cols().
+   * @return A vector of size rows().
+   *
+   * @throws std::invalid_argument If @p x has the wrong size.
+   */
+  std::vector<T> apply(std::span<const T> x) const
+  {
+    std::vector<T> y(rows());
+    apply(x, y);
+    return y;
+  }
+
+  /**
+   * @brief Computes `y = (A ⊗ B) x` into caller-provided storage (LinearOperator).
+   *
+   * Row i of `A X` is formed APPLY_TILE columns at a time in a stack buffer and
+   * dotted with the same columns of every row of B, so no call allocates. Rows
+   * of A are spread across threads only once there is enough work per thread.
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const
+  {
+    if (x.size() != cols() || y.size() != rows())
+      throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+    const std::size_t n = _a.cols(), p = _b.rows(), q = _b.cols();
+    const T* a = _a.data().data();
+    const T* b = _b.data().data();
+    lin_alg::detail::parallel_for(0, _a.rows(), std::max<std::size_t>(1, 4096 / (q * (n + p))),
+        [&](std::size_t lo, std::size_t hi) {
+      std::array<T, APPLY_TILE> ax;
+      for (std::size_t i = lo; i < hi; ++i) {
+        T* y_i = y.data() + i * p;
+        std::fill(y_i, y_i + p, T{});
+        for (std::size_t l = 0; l < q; l += APPLY_TILE) {
+          const std::size_t len = std::min(APPLY_TILE, q - l);
+          std::fill_n(ax.begin(), len, T{});
+          for (std::size_t j = 0; j < n; ++j)
+            lin_alg::detail::axpy(len, a[i * n + j], x.data() + j * q + l, ax.data());
+          for (std::size_t k = 0; k < p; ++k)
+            y_i[k] += lin_alg::detail::dot(len, ax.data(), b + k * q + l);
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Solves `(A ⊗ B) x = b` as `X = A⁻¹ Y B⁻ᵀ`.
+   *
+   * @param b A vector of size rows().
+   * @return The solution x.
+   *
+   * @throws std::invalid_argument If A or B is not square, or @p b has the wrong size.
+   * @throws std::runtime_error If A or B is singular.
+   *
+   * @note The first call factorizes A and B and caches the factors; concurrent
+   * calls are safe, and only one of them factorizes.
+   */
+  std::vector<T> solve(std::span<const T> b) const
+  {
+    if (b.size() != rows())
+      throw std::invalid_argument("Vector must have the same number of rows as the matrix!");
+    std::call_once(_factors->once, [this] {
+      _factors->a.emplace(_a);
+      _factors->b.emplace(_b);
+    });
+    const LU<T>& lu_a = *_factors->a;
+    const LU<T>& lu_b = *_factors->b;
+
+    const std::size_t n = _a.rows(), q = _b.rows();
+
+    // A Z = Y, all q columns at once
+    Matrix<T> Z = lu_a.solve(Matrix<T>(n, q, std::vector<T>(b.begin(), b.end())));
+
+    // X Bᵀ = Z, i.e. B x_i = z_i for every row i
+    if (lu_b.singular())
+      throw std::runtime_error("Cannot solve with a singular matrix.");
+    lin_alg::detail::parallel_for(0, n, 1, [&](std::size_t lo, std::size_t hi) {
+      for (std::size_t i = lo; i < hi; ++i) {
+        const auto x_i = lu_b.solve(std::span<const T>(Z.row_at(i)));
+        std::copy(x_i.begin(), x_i.end(), Z.row_at(i).begin());
+      }
+    });
+    return std::move(Z.data());
+  }
+};
+
+#endif
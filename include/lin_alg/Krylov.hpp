@@ -0,0 +1,856 @@
+#pragma once
+
+#ifndef WOJI_KRYLOV_HPP
+#define WOJI_KRYLOV_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/LU.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+#include <lin_alg/Random.hpp>
+#include <lin_alg/SymmetricEigen.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @file Krylov.hpp
+ * @brief A few eigenpairs of large operators by implicitly restarted Lanczos
+ * (symmetric) and Arnoldi (general) iteration.
+ *
+ * The operator is only ever applied to vectors through the LinearOperator
+ * interface, so it can be a dense Matrix, a SparseMatrix, or any implicit
+ * operator. An m-step Krylov factorization `A Vₘ = Vₘ Hₘ + f eₘᵀ` is built with
+ * full reorthogonalization and compressed back to k steps with m - k implicitly
+ * shifted QR steps on Hₘ, using the unwanted Ritz values as exact shifts
+ * (Sorensen's implicit restart). Memory is the n x m basis, with m ≈ 2k.
+ *
+ * For eigenvalues in the interior of the spectrum, or clustered at one end (the
+ * smallest eigenvalues of a graph Laplacian), wrap the matrix in ShiftInvert:
+ * eigenvalues of `(A - σI)⁻¹` nearest the largest are those of A nearest σ.
+ */
+
+/** Tuning parameters of lanczos() and arnoldi(). */
+struct KrylovOptions {
+  /** Krylov subspace size m; zero selects `min(n, max(2k + 1, k + 20))`. */
+  std::size_t subspace = 0;
+
+  /** Maximum number of implicit restarts before giving up. */
+  std::size_t max_restarts = 1000;
+
+  /**
+   * A Ritz pair (θ, x) is accepted once `‖A x - θ x‖ ≤ max(tolerance |θ|,
+   * ε^(2/3) ‖H‖)`, where H is the projected matrix.
+   */
+  double tolerance = 1e-10;
+
+  /** Seed of the deterministic starting vector. */
+  std::uint64_t seed = 1;
+};
+
+/** Eigenpairs of a symmetric operator; see lanczos(). */
+template <typename T>
+struct LanczosResult {
+  /** Eigenvalues in ascending order. */
+  std::vector<T> eigenvalues;
+  /** Unit eigenvectors, column j belonging to `eigenvalues[j]`. */
+  Matrix<T> eigenvectors;
+  /** Number of implicit restarts performed. */
+  std::size_t restarts = 0;
+};
+
+/** Eigenpairs of a general real operator; see arnoldi(). */
+template <typename T>
+struct ArnoldiResult {
+  /** Eigenvalues in ascending order of real part, then imaginary part. */
+  std::vector<std::complex<T>> eigenvalues;
+  /** Unit eigenvectors, column j belonging to `eigenvalues[j]`. */
+  Matrix<std::complex<T>> eigenvectors;
+  /** Number of implicit restarts performed. */
+  std::size_t restarts = 0;
+};
+
+/**
+ * @brief The operator `(A - σI)⁻¹` of a square matrix, applied through one LU
+ * factorization that is computed once and reused by every apply().
+ *
+ * @tparam T A floating-point element type.
+ *
+ * @note The factorization is dense: O(n²) memory, O(n³) to build and O(n²) per
+ * apply(), so this suits matrices up to a few thousand rows. For large sparse
+ * operators, wrap a sparse factorization or an iterative solver in a type
+ * satisfying LinearOperator and pass that to lanczos() or arnoldi() instead.
+ */
+template <std::floating_point T>
+class ShiftInvert {
+private:
+  LU<T> _lu;
+  T _sigma;
+
+  static Matrix<T> shifted(Matrix<T> A, const T& sigma)
+  {
+    if (A.rows() != A.cols())
+      throw std::invalid_argument("Shift-invert requires a square matrix.");
+    for (std::size_t i = 0; i < A.rows(); ++i) A.data()[i * A.cols() + i] -= sigma;
+    return A;
+  }
+
+public:
+  using value_type = T;
+
+  /**
+   * @brief Factorizes `A - sigma I`.
+   *
+   * @throws std::invalid_argument If @p A is not square.
+   * @throws std::runtime_error If @p sigma is an eigenvalue of @p A.
+   */
+  ShiftInvert(const Matrix<T>& A, T sigma) : ShiftInvert(LU<T>(shifted(A, sigma)), sigma) { }
+
+  /**
+   * @brief Reuses an existing factorization of `A - sigma I`.
+   *
+   * @throws std::runtime_error If @p lu is singular.
+   */
+  ShiftInvert(LU<T> lu, T sigma) : _lu(std::move(lu)), _sigma(sigma)
+  {
+    if (_lu.singular())
+      throw std::runtime_error("Cannot solve with a singular matrix.");
+  }
+
+  /** Returns the shift σ. */
+  T sigma() const noexcept { return _sigma; }
+  /** Returns the order of the operator. */
+  std::size_t rows() const noexcept { return _lu.size(); }
+  /** Returns the order of the operator. */
+  std::size_t cols() const noexcept { return _lu.size(); }
+
+  /**
+   * @brief Computes `y = (A - σI)⁻¹ x` by two triangular solves, in place in @p y.
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   *
+   * @note @p x and @p y must not overlap.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const
+  {
+    const std::size_t n = rows();
+    if (x.size() != n || y.size() != n)
+      throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+    using lin_alg::detail::dot;
+    const T* a = _lu.packed().data().data();
+    const std::vector<std::size_t>& perm = _lu.permutation();
+
+    // L z = P x, then U y = z, each row a contiguous dot product
+    for (std::size_t i = 0; i < n; ++i) y[i] = x[perm[i]] - dot(i, a + i * n, y.data());
+    for (std::size_t i = n; i-- > 0;)
+      y[i] = (y[i] - dot(n - i - 1, a + i * n + i + 1, y.data() + i + 1)) / a[i * n + i];
+  }
+};
+
+namespace lin_alg::detail {
+
+/** Minimum number of vector elements handed to one thread by the basis updates. */
+inline constexpr std::size_t KRYLOV_GRAIN = std::size_t{1} << 15;
+
+/**
+ * @brief An m-step Arnoldi factorization `A Vᵀ = Vᵀ H + f e_{m}ᵀ`.
+ *
+ * Row i of V (m x n) is the i-th orthonormal basis vector, so every vector is
+ * contiguous; H is m x m upper Hessenberg (tridiagonal for a symmetric operator).
+ */
+template <std::floating_point T>
+struct KrylovFactorization {
+  std::size_t n = 0, m = 0;
+  bool symmetric = false;
+  std::vector<T> V, H, f;
+  /** Stream and next position of the counter_random() draws for new basis vectors. */
+  std::uint64_t seed = 0, draws = 0;
+};
+
+/** y -= Σ_i h[i] V_i over the first @p count basis vectors, split across threads by element. */
+template <std::floating_point T>
+void subtract_combination(KrylovFactorization<T>& K, std::size_t count, const T* h, T* y)
+{
+  parallel_for(0, K.n, KRYLOV_GRAIN, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = 0; i < count; ++i)
+      axpy(hi - lo, -h[i], K.V.data() + i * K.n + lo, y + lo);
+  });
+}
+
+/**
+ * @brief Orthogonalizes @p w against the first @p count basis vectors, adding
+ * the coefficients to @p h; classical Gram–Schmidt with one DGKS correction.
+ *
+ * @return The norm of the orthogonalized vector.
+ */
+template <std::floating_point T>
+T orthogonalize(KrylovFactorization<T>& K, std::size_t count, T* w, T* h)
+{
+  const std::size_t n = K.n;
+  T norm = std::sqrt(dot(n, w, w));
+  std::vector<T> c(count);
+  for (int pass = 0; pass < 2 && count > 0; ++pass) {
+    for (std::size_t i = 0; i < count; ++i) c[i] = dot(n, K.V.data() + i * n, w);
+    subtract_combination(K, count, c.data(), w);
+    for (std::size_t i = 0; i < count; ++i) h[i] += c[i];
+
+    const T previous = norm;
+    norm = std::sqrt(dot(n, w, w));
+    if (norm > T(0.717) * previous) break;
+  }
+  return norm;
+}
+
+/** Writes a unit vector orthogonal to the first @p count basis vectors into row @p count of V. */
+template <std::floating_point T>
+void random_basis_vector(KrylovFactorization<T>& K, std::size_t count)
+{
+  T* v = K.V.data() + count * K.n;
+  std::vector<T> h(count);
+  for (;;) {
+    for (std::size_t i = 0; i < K.n; ++i) v[i] = counter_uniform<T>(K.seed, K.draws++) - T(0.5);
+    const T norm = orthogonalize(K, count, v, h.data());
+    if (norm > T{}) {
+      scal(K.n, T{1} / norm, v);
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Extends the factorization from step @p start to step m. On entry, rows
+ * 0..start of V are orthonormal; on exit f holds the new residual.
+ */
+template <std::floating_point T, LinearOperator Op>
+void krylov_extend(const Op& op, KrylovFactorization<T>& K, std::size_t start)
+{
+  const std::size_t n = K.n, m = K.m;
+  const T breakdown = std::numeric_limits<T>::epsilon() * static_cast<T>(n);
+  std::vector<T> h(m);
+
+  for (std::size_t j = start; j < m; ++j) {
+    T* w = j + 1 < m ? K.V.data() + (j + 1) * n : K.f.data();
+    op.apply(std::span<const T>(K.V.data() + j * n, n), std::span<T>(w, n));
+
+    // A symmetric operator only couples neighbouring Lanczos vectors, but every
+    // earlier vector is still projected out to keep the basis orthogonal
+    std::fill(h.begin(), h.end(), T{});
+    const T scale = std::sqrt(dot(n, w, w));
+    const T beta = orthogonalize(K, j + 1, w, h.data());
+
+    for (std::size_t i = 0; i <= j; ++i) K.H[i * m + j] = h[i];
+    if (K.symmetric) {
+      for (std::size_t i = 0; i + 1 < j; ++i) K.H[i * m + j] = T{};
+      if (j > 0) K.H[(j - 1) * m + j] = K.H[j * m + j - 1];
+    }
+    if (j + 1 == m) break;
+
+    if (beta <= breakdown * scale) {
+      // Invariant subspace found: continue from a fresh orthogonal direction
+      K.H[(j + 1) * m + j] = T{};
+      random_basis_vector(K, j + 1);
+    } else {
+      K.H[(j + 1) * m + j] = beta;
+      scal(n, T{1} / beta, w);
+    }
+  }
+}
+
+/**
+ * @brief Eigenvalues of the @p m x @p m upper Hessenberg matrix @p H by the
+ * Francis double-shift QR algorithm.
+ *
+ * @throws std::runtime_error If the iteration fails to converge.
+ */
+template <std::floating_point T>
+std::vector<std::complex<T>> hessenberg_eigenvalues(std::size_t m, std::vector<T> H)
+{
+  // One-based indexing keeps the classic formulation readable
+  auto a = [&](std::ptrdiff_t i, std::ptrdiff_t j) -> T& { return H[(i - 1) * m + (j - 1)]; };
+  const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(m);
+  std::vector<T> wr(m + 1), wi(m + 1);
+
+  T anorm = 0;
+  for (std::ptrdiff_t i = 1; i <= size; ++i)
+    for (std::ptrdiff_t j = std::max<std::ptrdiff_t>(i - 1, 1); j <= size; ++j) anorm += std::abs(a(i, j));
+
+  std::ptrdiff_t nn = size, l = 1;
+  T t = 0;
+  while (nn >= 1) {
+    int its = 0;
+    do {
+      for (l = nn; l >= 2; --l) {
+        T s = std::abs(a(l - 1, l - 1)) + std::abs(a(l, l));
+        if (s == T{}) s = anorm;
+        if (std::abs(a(l, l - 1)) + s == s) {
+          a(l, l - 1) = 0;
+          break;
+        }
+      }
+      T x = a(nn, nn);
+      if (l == nn) {
+        wr[nn] = x + t;
+        wi[nn--] = 0;
+      } else {
+        T y = a(nn - 1, nn - 1), w = a(nn, nn - 1) * a(nn - 1, nn);
+        if (l == nn - 1) {
+          const T p = T(0.5) * (y - x), q = p * p + w;
+          T z = std::sqrt(std::abs(q));
+          x += t;
+          if (q >= 0) {
+            z = p + std::copysign(z, p);
+            wr[nn - 1] = wr[nn] = x + z;
+            if (z != T{}) wr[nn] = x - w / z;
+            wi[nn - 1] = wi[nn] = 0;
+          } else {
+            wr[nn - 1] = wr[nn] = x + p;
+            wi[nn - 1] = -(wi[nn] = z);
+          }
+          nn -= 2;
+        } else {
+          if (its == 60)
+            throw std::runtime_error("Hessenberg eigenvalue iteration did not converge.");
+          if (its % 10 == 0 && its > 0) {
+            // Exceptional shift
+            t += x;
+            for (std::ptrdiff_t i = 1; i <= nn; ++i) a(i, i) -= x;
+            const T s = std::abs(a(nn, nn - 1)) + std::abs(a(nn - 1, nn - 2));
+            y = x = T(0.75) * s;
+            w = T(-0.4375) * s * s;
+          }
+          ++its;
+          std::ptrdiff_t mm = nn - 2;
+          T p = 0, q = 0, r = 0, z = 0;
+          for (; mm >= l; --mm) {
+            z = a(mm, mm);
+            r = x - z;
+            T s = y - z;
+            p = (r * s - w) / a(mm + 1, mm) + a(mm, mm + 1);
+            q = a(mm + 1, mm + 1) - z - r - s;
+            r = a(mm + 2, mm + 1);
+            s = std::abs(p) + std::abs(q) + std::abs(r);
+            p /= s;
+            q /= s;
+            r /= s;
+            if (mm == l) break;
+            const T u = std::abs(a(mm, mm - 1)) * (std::abs(q) + std::abs(r));
+            const T v = std::abs(p) * (std::abs(a(mm - 1, mm - 1)) + std::abs(z) + std::abs(a(mm + 1, mm + 1)));
+            if (u + v == v) break;
+          }
+          for (std::ptrdiff_t i = mm + 2; i <= nn; ++i) {
+            a(i, i - 2) = 0;
+            if (i != mm + 2) a(i, i - 3) = 0;
+          }
+          for (std::ptrdiff_t k = mm; k <= nn - 1; ++k) {
+            if (k != mm) {
+              p = a(k, k - 1);
+              q = a(k + 1, k - 1);
+              r = 0;
+              if (k != nn - 1) r = a(k + 2, k - 1);
+              if ((x = std::abs(p) + std::abs(q) + std::abs(r)) != T{}) {
+                p /= x;
+                q /= x;
+                r /= x;
+              }
+            }
+            const T s = std::copysign(std::sqrt(p * p + q * q + r * r), p);
+            if (s == T{}) continue;
+            if (k == mm) {
+              if (l != mm) a(k, k - 1) = -a(k, k - 1);
+            } else {
+              a(k, k - 1) = -s * x;
+            }
+            p += s;
+            x = p / s;
+            y = q / s;
+            z = r / s;
+            q /= p;
+            r /= p;
+            for (std::ptrdiff_t j = k; j <= nn; ++j) {
+              p = a(k, j) + q * a(k + 1, j);
+              if (k != nn - 1) {
+                p += r * a(k + 2, j);
+                a(k + 2, j) -= p * z;
+              }
+              a(k + 1, j) -= p * y;
+              a(k, j) -= p * x;
+            }
+            const std::ptrdiff_t last = std::min(nn, k + 3);
+            for (std::ptrdiff_t i = l; i <= last; ++i) {
+              p = x * a(i, k) + y * a(i, k + 1);
+              if (k != nn - 1) {
+                p += z * a(i, k + 2);
+                a(i, k + 2) -= p * r;
+              }
+              a(i, k + 1) -= p * q;
+              a(i, k) -= p;
+            }
+          }
+        }
+      }
+    } while (l < nn - 1);
+  }
+
+  std::vector<std::complex<T>> values(m);
+  for (std::size_t i = 0; i < m; ++i) values[i] = {wr[i + 1], wi[i + 1]};
+  return values;
+}
+
+/**
+ * @brief A unit eigenvector of the @p m x @p m matrix @p H for its eigenvalue
+ * @p lambda, by inverse iteration with a pivoted complex LU factorization.
+ */
+template <std::floating_point T>
+std::vector<std::complex<T>> hessenberg_eigenvector(std::size_t m, const std::vector<T>& H, std::complex<T> lambda)
+{
+  using C = std::complex<T>;
+  T hnorm = 0;
+  for (const T& x : H) hnorm = std::max(hnorm, std::abs(x));
+  const T tiny = std::numeric_limits<T>::epsilon() * (hnorm > T{} ? hnorm : T{1});
+
+  std::vector<C> M(m * m);
+  for (std::size_t i = 0; i < m * m; ++i) M[i] = H[i];
+  for (std::size_t i = 0; i < m; ++i) M[i * m + i] -= lambda;
+
+  std::vector<std::size_t> perm(m);
+  std::iota(perm.begin(), perm.end(), std::size_t{0});
+  for (std::size_t k = 0; k < m; ++k) {
+    std::size_t p = k;
+    for (std::size_t i = k + 1; i < m; ++i)
+      if (std::abs(M[i * m + k]) > std::abs(M[p * m + k])) p = i;
+    if (p != k) {
+      std::swap_ranges(M.begin() + k * m, M.begin() + (k + 1) * m, M.begin() + p * m);
+      std::swap(perm[k], perm[p]);
+    }
+    if (std::abs(M[k * m + k]) < tiny) M[k * m + k] = tiny;
+    for (std::size_t i = k + 1; i < m; ++i) {
+      const C l = M[i * m + k] / M[k * m + k];
+      M[i * m + k] = l;
+      for (std::size_t j = k + 1; j < m; ++j) M[i * m + j] -= l * M[k * m + j];
+    }
+  }
+
+  std::vector<C> y(m, C{1}), b(m);
+  for (int iter = 0; iter < 3; ++iter) {
+    for (std::size_t i = 0; i < m; ++i) b[i] = y[perm[i]];
+    for (std::size_t i = 0; i < m; ++i)
+      for (std::size_t k = 0; k < i; ++k) b[i] -= M[i * m + k] * b[k];
+    for (std::size_t i = m; i-- > 0;) {
+      for (std::size_t k = i + 1; k < m; ++k) b[i] -= M[i * m + k] * b[k];
+      b[i] /= M[i * m + i];
+    }
+    T norm = 0;
+    for (const C& x : b) norm += std::norm(x);
+    norm = std::sqrt(norm);
+    for (std::size_t i = 0; i < m; ++i) y[i] = b[i] / norm;
+  }
+  return y;
+}
+
+/** One explicitly shifted QR step `H - μI = QR, H ← RQ + μI` by Givens rotations, accumulated into Q. */
+template <std::floating_point T>
+void hessenberg_shift(std::size_t m, T* H, T* Q, T mu)
+{
+  std::vector<T> c(m), s(m);
+  for (std::size_t i = 0; i < m; ++i) H[i * m + i] -= mu;
+  for (std::size_t i = 0; i + 1 < m; ++i) {
+    const T x = H[i * m + i], y = H[(i + 1) * m + i];
+    const T r = std::hypot(x, y);
+    c[i] = r == T{} ? T{1} : x / r;
+    s[i] = r == T{} ? T{} : y / r;
+    for (std::size_t j = i; j < m; ++j) {
+      const T a = H[i * m + j], b = H[(i + 1) * m + j];
+      H[i * m + j] = c[i] * a + s[i] * b;
+      H[(i + 1) * m + j] = -s[i] * a + c[i] * b;
+    }
+  }
+  for (std::size_t i = 0; i + 1 < m; ++i) {
+    for (std::size_t r = 0; r < std::min(i + 2, m); ++r) {
+      const T a = H[r * m + i], b = H[r * m + i + 1];
+      H[r * m + i] = c[i] * a + s[i] * b;
+      H[r * m + i + 1] = -s[i] * a + c[i] * b;
+    }
+    for (std::size_t r = 0; r < m; ++r) {
+      const T a = Q[r * m + i], b = Q[r * m + i + 1];
+      Q[r * m + i] = c[i] * a + s[i] * b;
+      Q[r * m + i + 1] = -s[i] * a + c[i] * b;
+    }
+  }
+  for (std::size_t i = 0; i < m; ++i) H[i * m + i] += mu;
+}
+
+/**
+ * @brief One implicit Francis double-shift QR step with the shifts μ and μ̄,
+ * given as `s = 2 Re μ` and `t = |μ|²`, accumulated into Q. Real arithmetic only.
+ */
+template <std::floating_point T>
+void hessenberg_double_shift(std::size_t m, T* H, T* Q, T s, T t)
+{
+  T x = H[0] * H[0] + H[1] * H[m] - s * H[0] + t;
+  T y = H[m] * (H[0] + H[m + 1] - s);
+  T z = m > 2 ? H[m] * H[2 * m + 1] : T{};
+
+  for (std::size_t k = 0; k + 1 < m; ++k) {
+    const std::size_t len = std::min<std::size_t>(3, m - k);
+    T u[3] = {x, y, len == 3 ? z : T{}};
+    const T norm = std::sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    if (norm != T{}) {
+      u[0] += std::copysign(norm, u[0]);
+      const T uu = u[0] * u[0] + u[1] * u[1] + u[2] * u[2];
+
+      // P = I - 2 u uᵀ / uᵀu from the left, then from the right
+      for (std::size_t j = k == 0 ? 0 : k - 1; j < m; ++j) {
+        T p = 0;
+        for (std::size_t i = 0; i < len; ++i) p += u[i] * H[(k + i) * m + j];
+        p *= 2 / uu;
+        for (std::size_t i = 0; i < len; ++i) H[(k + i) * m + j] -= p * u[i];
+      }
+      auto right = [&](T* X, std::size_t rows) {
+        for (std::size_t r = 0; r < rows; ++r) {
+          T p = 0;
+          for (std::size_t i = 0; i < len; ++i) p += X[r * m + k + i] * u[i];
+          p *= 2 / uu;
+          for (std::size_t i = 0; i < len; ++i) X[r * m + k + i] -= p * u[i];
+        }
+      };
+      right(H, std::min(k + 4, m));
+      right(Q, m);
+    }
+    if (k + 2 < m) {
+      x = H[(k + 1) * m + k];
+      y = H[(k + 2) * m + k];
+      z = k + 3 < m ? H[(k + 3) * m + k] : T{};
+    }
+  }
+  for (std::size_t i = 2; i < m; ++i)
+    for (std::size_t j = 0; j + 1 < i; ++j) H[i * m + j] = T{};
+}
+
+/**
+ * @brief Compresses the factorization to its first @p keep steps after applying
+ * the given shifts to H (complex shifts as conjugate pairs, listed once each
+ * with positive imaginary part).
+ */
+template <std::floating_point T>
+void krylov_restart(KrylovFactorization<T>& K, std::size_t keep, const std::vector<std::complex<T>>& shifts)
+{
+  const std::size_t n = K.n, m = K.m;
+  std::vector<T> Q(m * m);
+  for (std::size_t i = 0; i < m; ++i) Q[i * m + i] = T{1};
+
+  for (const std::complex<T>& mu : shifts) {
+    if (mu.imag() == T{})
+      hessenberg_shift(m, K.H.data(), Q.data(), mu.real());
+    else
+      hessenberg_double_shift(m, K.H.data(), Q.data(), 2 * mu.real(), std::norm(mu));
+  }
+  if (K.symmetric) {
+    for (std::size_t i = 0; i < m; ++i)
+      for (std::size_t j = 0; j < m; ++j)
+        if (j > i + 1 || i > j + 1) K.H[i * m + j] = T{};
+    for (std::size_t i = 0; i + 1 < m; ++i) K.H[i * m + i + 1] = K.H[(i + 1) * m + i];
+  }
+
+  // New basis rows 0..keep are Qᵀ V restricted to the first keep + 1 columns of Q
+  std::vector<T> Qt((keep + 1) * m), W((keep + 1) * n);
+  for (std::size_t r = 0; r <= keep; ++r)
+    for (std::size_t i = 0; i < m; ++i) Qt[r * m + i] = Q[i * m + r];
+  gemm_blocked(keep + 1, n, m, Qt.data(), K.V.data(), W.data());
+
+  // f ← V⁺_keep H⁺[keep][keep-1] + f Q[m-1][keep-1]
+  const T beta = K.H[keep * m + keep - 1], sigma = Q[(m - 1) * m + keep - 1];
+  parallel_for(0, n, KRYLOV_GRAIN, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) K.f[i] = W[keep * n + i] * beta + K.f[i] * sigma;
+  });
+  std::copy(W.begin(), W.begin() + keep * n, K.V.begin());
+
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t j = 0; j < m; ++j)
+      if (i >= keep || j >= keep) K.H[i * m + j] = T{};
+
+  // Continue the factorization from the residual direction
+  std::vector<T> h(keep);
+  const T scale = std::sqrt(dot(n, K.f.data(), K.f.data()));
+  const T norm = orthogonalize(K, keep, K.f.data(), h.data());
+  if (norm <= std::numeric_limits<T>::epsilon() * static_cast<T>(n) * scale) {
+    random_basis_vector(K, keep);
+  } else {
+    K.H[keep * m + keep - 1] = norm;
+    for (std::size_t i = 0; i < n; ++i) K.V[keep * n + i] = K.f[i] / norm;
+  }
+}
+
+/** Wanted Ritz values of a restart cycle: indices into the Ritz values, most wanted first. */
+struct RitzSelection {
+  std::vector<std::size_t> order;
+  std::size_t converged = 0;
+};
+
+/**
+ * @brief Runs the implicitly restarted iteration until the @p k Ritz pairs with
+ * the largest @p score have converged.
+ *
+ * @param K Set to the final Krylov factorization.
+ * @param ritz Set to the @p k wanted Ritz values of the final H, most wanted first.
+ * @param Y Set to their eigenvectors in H's coordinates (m x k, column j for
+ * ritz[j]).
+ * @return The number of restarts performed.
+ *
+ * @throws std::invalid_argument If @p op is not square or @p k is out of range.
+ * @throws std::runtime_error If the iteration does not converge within
+ * KrylovOptions::max_restarts.
+ */
+template <std::floating_point T, LinearOperator Op, typename Score>
+std::size_t krylov_iterate(const Op& op, std::size_t k, const KrylovOptions& opts, bool symmetric, Score score,
+    KrylovFactorization<T>& K, std::vector<std::complex<T>>& ritz, std::vector<std::complex<T>>& Y)
+{
+  const std::size_t n = op.rows();
+  if (op.cols() != n)
+    throw std::invalid_argument("Krylov eigensolvers require a square operator.");
+  if (k == 0 || k >= n)
+    throw std::invalid_argument("Number of eigenpairs must be between 1 and the operator order minus one.");
+
+  const std::size_t m = opts.subspace ? std::clamp(opts.subspace, k + 1, n) : std::min(n, std::max(2 * k + 1, k + 20));
+  K.n = n;
+  K.m = m;
+  K.symmetric = symmetric;
+  K.V.assign(m * n, T{});
+  K.H.assign(m * m, T{});
+  K.f.assign(n, T{});
+  K.seed = opts.seed;
+  K.draws = 0;
+
+  random_basis_vector(K, 0);
+  krylov_extend(op, K, 0);
+
+  const T eps23 = std::cbrt(std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon());
+  std::vector<T> U, d, e;
+
+  for (std::size_t restart = 0;; ++restart) {
+    // Ritz values, and the eigenvectors of H needed for the wanted ones
+    std::vector<std::vector<std::complex<T>>> vectors(m);
+    if (symmetric) {
+      d.resize(m);
+      e.assign(m, T{});
+      U.assign(m * m, T{});
+      for (std::size_t i = 0; i < m; ++i) {
+        d[i] = K.H[i * m + i];
+        if (i + 1 < m) e[i] = K.H[(i + 1) * m + i];
+        U[i * m + i] = T{1};
+      }
+      tridiagonal_ql(m, d.data(), e.data(), U.data(), m);
+      ritz.resize(m);
+      for (std::size_t i = 0; i < m; ++i) ritz[i] = d[i];
+    } else {
+      ritz = hessenberg_eigenvalues(m, K.H);
+    }
+
+    std::vector<std::size_t> order(m);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return score(ritz[a]) > score(ritz[b]); });
+
+    T hnorm = 0;
+    for (const T& x : K.H) hnorm = std::max(hnorm, std::abs(x));
+    const T fnorm = std::sqrt(dot(n, K.f.data(), K.f.data()));
+
+    std::size_t converged = 0;
+    for (std::size_t w = 0; w < k; ++w) {
+      const std::size_t i = order[w];
+      if (symmetric) {
+        vectors[i].resize(m);
+        for (std::size_t r = 0; r < m; ++r) vectors[i][r] = U[r * m + i];
+      } else {
+        vectors[i] = hessenberg_eigenvector(m, K.H, ritz[i]);
+      }
+      const T estimate = fnorm * std::abs(vectors[i][m - 1]);
+      if (estimate <= std::max(T(opts.tolerance) * std::abs(ritz[i]), eps23 * hnorm)) ++converged;
+    }
+
+    if (converged == k || fnorm == T{} || m == n) {
+      Y.assign(m * k, std::complex<T>{});
+      for (std::size_t w = 0; w < k; ++w)
+        for (std::size_t r = 0; r < m; ++r) Y[r * k + w] = vectors[order[w]][r];
+      std::vector<std::complex<T>> wanted(k);
+      for (std::size_t w = 0; w < k; ++w) wanted[w] = ritz[order[w]];
+      ritz = std::move(wanted);
+      return restart;
+    }
+    if (restart == opts.max_restarts)
+      throw std::runtime_error("Krylov eigensolver did not converge.");
+
+    // Keep a few extra Ritz values once some have converged, and never split a conjugate pair
+    std::size_t keep = std::min(k + std::min(converged, (m - k) / 2), m - 1);
+    if (keep < m && ritz[order[keep - 1]].imag() != T{} && ritz[order[keep]] == std::conj(ritz[order[keep - 1]]))
+      keep = keep + 1 < m ? keep + 1 : std::max<std::size_t>(keep - 1, 1);
+
+    std::vector<std::complex<T>> shifts;
+    for (std::size_t w = keep; w < m; ++w)
+      if (ritz[order[w]].imag() >= T{}) shifts.push_back(ritz[order[w]]);
+    krylov_restart(K, keep, shifts);
+    krylov_extend(op, K, keep);
+  }
+}
+
+/** Ritz vectors `Vᵀ Y`, as an n x k matrix of type R (T or std::complex<T>). */
+template <typename R, std::floating_point T>
+Matrix<R> ritz_vectors(const KrylovFactorization<T>& K, std::size_t k, const std::vector<std::complex<T>>& Y)
+{
+  const std::size_t n = K.n, m = K.m;
+  std::vector<T> Yt(k * m), Xr(k * n), Xi;
+  for (std::size_t r = 0; r < m; ++r)
+    for (std::size_t j = 0; j < k; ++j) Yt[j * m + r] = Y[r * k + j].real();
+  gemm_blocked(k, n, m, Yt.data(), K.V.data(), Xr.data());
+  if constexpr (!std::same_as<R, T>) {
+    Xi.resize(k * n);
+    for (std::size_t r = 0; r < m; ++r)
+      for (std::size_t j = 0; j < k; ++j) Yt[j * m + r] = Y[r * k + j].imag();
+    gemm_blocked(k, n, m, Yt.data(), K.V.data(), Xi.data());
+  }
+
+  Matrix<R> X(n, k);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < k; ++j) {
+      if constexpr (std::same_as<R, T>)
+        X.data()[i * k + j] = Xr[j * n + i];
+      else
+        X.data()[i * k + j] = R(Xr[j * n + i], Xi[j * n + i]);
+    }
+  return X;
+}
+
+/** Sorts eigenpairs by @p less on the eigenvalues, permuting eigenvector columns to match. */
+template <typename R, typename Less>
+void sort_ritz_pairs(std::vector<R>& values, Matrix<R>& vectors, Less less)
+{
+  const std::size_t k = values.size();
+  std::vector<std::size_t> order(k);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return less(values[a], values[b]); });
+
+  std::vector<R> sorted(k), row(k);
+  for (std::size_t j = 0; j < k; ++j) sorted[j] = values[order[j]];
+  values = std::move(sorted);
+  for (std::size_t i = 0; i < vectors.rows(); ++i) {
+    R* x = vectors.data().data() + i * k;
+    for (std::size_t j = 0; j < k; ++j) row[j] = x[order[j]];
+    std::copy(row.begin(), row.end(), x);
+  }
+}
+
+template <std::floating_point T, LinearOperator Op, typename Score, typename Map>
+LanczosResult<T> lanczos_run(const Op& op, std::size_t k, const KrylovOptions& opts, Score score, Map map)
+{
+  KrylovFactorization<T> K;
+  std::vector<std::complex<T>> ritz, Y;
+  const std::size_t restarts = krylov_iterate<T>(op, k, opts, true, score, K, ritz, Y);
+
+  std::vector<T> values(k);
+  for (std::size_t j = 0; j < k; ++j) values[j] = map(ritz[j].real());
+  LanczosResult<T> result{std::move(values), ritz_vectors<T>(K, k, Y), restarts};
+  sort_ritz_pairs(result.eigenvalues, result.eigenvectors, std::less<T>());
+  return result;
+}
+
+template <std::floating_point T, LinearOperator Op, typename Score, typename Map>
+ArnoldiResult<T> arnoldi_run(const Op& op, std::size_t k, const KrylovOptions& opts, Score score, Map map)
+{
+  KrylovFactorization<T> K;
+  std::vector<std::complex<T>> ritz, Y;
+  const std::size_t restarts = krylov_iterate<T>(op, k, opts, false, score, K, ritz, Y);
+
+  for (std::complex<T>& v : ritz) v = map(v);
+  ArnoldiResult<T> result{std::move(ritz), ritz_vectors<std::complex<T>>(K, k, Y), restarts};
+  sort_ritz_pairs(result.eigenvalues, result.eigenvectors, [](const std::complex<T>& a, const std::complex<T>& b) {
+    return a.real() != b.real() ? a.real() < b.real() : a.imag() < b.imag();
+  });
+  return result;
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Computes the @p k smallest or largest eigenpairs of a symmetric
+ * operator by implicitly restarted Lanczos iteration.
+ *
+ * @param A A symmetric LinearOperator, e.g. a Matrix or SparseMatrix.
+ * @param k Number of eigenpairs, less than the order of @p A.
+ * @param which Which end of the spectrum to compute.
+ *
+ * @throws std::invalid_argument If @p A is not square or @p k is out of range.
+ * @throws std::runtime_error If the iteration does not converge within
+ * KrylovOptions::max_restarts restarts.
+ */
+template <LinearOperator Op, std::floating_point T = typename Op::value_type>
+LanczosResult<T> lanczos(const Op& A, std::size_t k, Spectrum which = Spectrum::Smallest, const KrylovOptions& opts = {})
+{
+  const T sign = which == Spectrum::Largest ? T{1} : T{-1};
+  return lin_alg::detail::lanczos_run<T>(A, k, opts,
+      [sign](const std::complex<T>& v) { return sign * v.real(); },
+      [](const T& v) { return v; });
+}
+
+/**
+ * @brief Computes the @p k eigenpairs of a symmetric matrix nearest the shift
+ * of @p op by Lanczos iteration on `(A - σI)⁻¹`.
+ *
+ * @throws std::invalid_argument If @p k is out of range.
+ * @throws std::runtime_error If the iteration does not converge.
+ */
+template <std::floating_point T>
+LanczosResult<T> lanczos(const ShiftInvert<T>& op, std::size_t k, const KrylovOptions& opts = {})
+{
+  const T sigma = op.sigma();
+  return lin_alg::detail::lanczos_run<T>(op, k, opts,
+      [](const std::complex<T>& v) { return std::abs(v.real()); },
+      [sigma](const T& v) { return sigma + T{1} / v; });
+}
+
+/**
+ * @brief Computes the @p k eigenpairs with the smallest or largest real part of
+ * a general real operator by implicitly restarted Arnoldi iteration.
+ *
+ * Complex eigenvalues come in conjugate pairs; if the k-th wanted eigenvalue
+ * is complex, its conjugate may take the last place instead of a value with the
+ * same real part.
+ *
+ * @throws std::invalid_argument If @p A is not square or @p k is out of range.
+ * @throws std::runtime_error If the iteration does not converge.
+ */
+template <LinearOperator Op, std::floating_point T = typename Op::value_type>
+ArnoldiResult<T> arnoldi(const Op& A, std::size_t k, Spectrum which = Spectrum::Largest, const KrylovOptions& opts = {})
+{
+  const T sign = which == Spectrum::Largest ? T{1} : T{-1};
+  return lin_alg::detail::arnoldi_run<T>(A, k, opts,
+      [sign](const std::complex<T>& v) { return sign * v.real(); },
+      [](const std::complex<T>& v) { return v; });
+}
+
+/**
+ * @brief Computes the @p k eigenpairs of a general matrix nearest the shift of
+ * @p op by Arnoldi iteration on `(A - σI)⁻¹`.
+ *
+ * @throws std::invalid_argument If @p k is out of range.
+ * @throws std::runtime_error If the iteration does not converge.
+ */
+template <std::floating_point T>
+ArnoldiResult<T> arnoldi(const ShiftInvert<T>& op, std::size_t k, const KrylovOptions& opts = {})
+{
+  const T sigma = op.sigma();
+  return lin_alg::detail::arnoldi_run<T>(op, k, opts,
+      [](const std::complex<T>& v) { return std::abs(v); },
+      [sigma](const std::complex<T>& v) { return sigma + T{1} / v; });
+}
+
+#endif
@@ -0,0 +1,231 @@
+#pragma once
+
+#ifndef WOJI_LU_HPP
+#define WOJI_LU_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Triangular.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief LU factorization with row pivoting, `P A = L U`, of a square matrix.
+ *
+ * @tparam T Element type; a Field such as @c double or Rational.
+ *
+ * Factorizing once costs O(n³); every later solve costs O(n²) per right-hand
+ * side, so an LU is the way to solve repeatedly against the same matrix.
+ *
+ * L (unit lower triangular) and U are packed into one matrix. Floating types
+ * (see ApproximateField) use partial pivoting and treat pivots no larger than
+ * `epsilon * n * max|a_ij|` as zero; other types pivot on the first nonzero
+ * element.
+ */
+template <typename T>
+class LU {
+private:
+  /** L below the diagonal (its unit diagonal is implied) and U on and above it. */
+  Matrix<T> _lu;
+
+  /** Row i of P A is row _perm[i] of A. */
+  std::vector<std::size_t> _perm;
+
+  /** True if P is an odd permutation. */
+  bool _odd_swaps = false;
+
+  /** True if some pivot was (numerically) zero. */
+  bool _singular = false;
+
+  constexpr void substitute(Matrix<T>& X) const;
+
+public:
+  /**
+   * @brief Factorizes @p A.
+   *
+   * @throws std::invalid_argument If @p A is not square.
+   *
+   * @note A singular @p A is factorized anyway; see singular().
+   */
+  explicit constexpr LU(const Matrix<T>& A);
+
+  /** Returns the order of the factorized matrix. */
+  constexpr std::size_t size() const noexcept { return _lu.rows(); }
+
+  /** Returns true if the factorized matrix is singular, so solve() would fail. */
+  constexpr bool singular() const noexcept { return _singular; }
+
+  /** Returns L and U packed into one matrix; L's unit diagonal is not stored. */
+  constexpr const Matrix<T>& packed() const noexcept { return _lu; }
+
+  /** Returns the unit lower triangular factor L as a view into packed(). */
+  constexpr TriangularView<T> lower() const { return TriangularView<T>(_lu.view(), Uplo::Lower, Diag::Unit); }
+
+  /** Returns the upper triangular factor U as a view into packed(). */
+  constexpr TriangularView<T> upper() const { return TriangularView<T>(_lu.view(), Uplo::Upper); }
+
+  /** Returns the row permutation: row i of P A is row `permutation()[i]` of A. */
+  constexpr const std::vector<std::size_t>& permutation() const noexcept { return _perm; }
+
+  /** Returns the determinant of the factorized matrix. */
+  constexpr T det() const;
+
+  /**
+   * @brief Solves A x = b.
+   *
+   * @param b A vector of size size().
+   * @return The solution x.
+   *
+   * @throws std::invalid_argument If @p b has the wrong size.
+   * @throws std::runtime_error If the matrix is singular.
+   */
+  constexpr std::vector<T> solve(std::span<const T> b) const;
+
+  /**
+   * @brief Solves A X = B for every column of B at once.
+   *
+   * Substitution sweeps whole rows of B, so the inner loops stay contiguous.
+   *
+   * @throws std::invalid_argument If B.rows() differs from size().
+   * @throws std::runtime_error If the matrix is singular.
+   */
+  constexpr Matrix<T> solve(const Matrix<T>& B) const;
+};
+
+// ==============================================================================
+// Factorization Definitions
+// ==============================================================================
+
+template <typename T>
+constexpr LU<T>::LU(const Matrix<T>& A)
+  : _lu(A), _perm(A.rows())
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("LU factorization requires a square matrix.");
+
+  const std::size_t n = A.rows();
+  std::iota(_perm.begin(), _perm.end(), std::size_t{0});
+  T* a = _lu.data().data();
+
+  T tol{};
+  if constexpr (ApproximateField<T>)
+    tol = lin_alg::detail::elimination_tolerance(n, n, a);
+
+  for (std::size_t k = 0; k < n; ++k) {
+    std::size_t p = k;
+    if constexpr (ApproximateField<T>) {
+      using lin_alg::detail::magnitude;
+      for (std::size_t i = k + 1; i < n; ++i)
+        if (magnitude(a[i * n + k]) > magnitude(a[p * n + k])) p = i;
+      if (magnitude(a[p * n + k]) <= tol) {
+        _singular = true;
+        continue;
+      }
+    } else {
+      while (p < n && a[p * n + k] == T{}) ++p;
+      if (p == n) {
+        _singular = true;
+        continue;
+      }
+    }
+
+    if (p != k) {
+      std::swap_ranges(a + k * n, a + k * n + n, a + p * n);
+      std::swap(_perm[k], _perm[p]);
+      _odd_swaps = !_odd_swaps;
+    }
+
+    const T pivot = a[k * n + k];
+    for (std::size_t i = k + 1; i < n; ++i) {
+      const T l = a[i * n + k] / pivot;
+      a[i * n + k] = l;
+      if (l != T{})
+        lin_alg::detail::axpy(n - k - 1, -l, a + k * n + k + 1, a + i * n + k + 1);
+    }
+  }
+}
+
+template <typename T>
+constexpr T LU<T>::det() const
+{
+  if (_singular) return T{};
+  T det = T{1};
+  for (std::size_t i = 0; i < size(); ++i)
+    det *= _lu.data()[i * size() + i];
+  return _odd_swaps ? -det : det;
+}
+
+// ==============================================================================
+// Solve Definitions
+// ==============================================================================
+
+template <typename T>
+constexpr void LU<T>::substitute(Matrix<T>& X) const
+{
+  if (_singular)
+    throw std::runtime_error("Cannot solve with a singular matrix.");
+
+  // At run time, use the blocked triangular kernels
+  if (!std::is_constant_evaluated()) {
+    lower().solve_in_place(X.view());
+    upper().solve_in_place(X.view());
+    return;
+  }
+
+  const std::size_t n = size();
+  const std::size_t m = X.cols();
+  const T* a = _lu.data().data();
+  T* x = X.data().data();
+
+  // L y = P b
+  for (std::size_t i = 1; i < n; ++i)
+    for (std::size_t k = 0; k < i; ++k)
+      if (a[i * n + k] != T{})
+        lin_alg::detail::axpy(m, -a[i * n + k], x + k * m, x + i * m);
+
+  // U x = y
+  for (std::size_t i = n; i-- > 0;) {
+    for (std::size_t k = i + 1; k < n; ++k)
+      if (a[i * n + k] != T{})
+        lin_alg::detail::axpy(m, -a[i * n + k], x + k * m, x + i * m);
+    lin_alg::detail::scal(m, T{1} / a[i * n + i], x + i * m);
+  }
+}
+
+template <typename T>
+constexpr std::vector<T> LU<T>::solve(std::span<const T> b) const
+{
+  if (b.size() != size())
+    throw std::invalid_argument("Vector must have the same number of rows as the matrix!");
+
+  std::vector<T> pb(size());
+  for (std::size_t i = 0; i < size(); ++i) pb[i] = b[_perm[i]];
+
+  Matrix<T> x(size(), 1, std::move(pb));
+  substitute(x);
+  return std::move(x.data());
+}
+
+template <typename T>
+constexpr Matrix<T> LU<T>::solve(const Matrix<T>& B) const
+{
+  if (B.rows() != size())
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+
+  Matrix<T> X(B.rows(), B.cols());
+  for (std::size_t i = 0; i < size(); ++i)
+    X.set_block(i, 0, B.block(_perm[i], 0, 1, B.cols()));
+  substitute(X);
+  return X;
+}
+
+#endif
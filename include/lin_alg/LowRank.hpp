@@ -0,0 +1,259 @@
+#pragma once
+
+#ifndef WOJI_LOW_RANK_HPP
+#define WOJI_LOW_RANK_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+#include <lin_alg/Random.hpp>
+#include <lin_alg/SVD.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file LowRank.hpp
+ * @brief Randomized low-rank SVD and rank estimation by sketching.
+ *
+ * The range of A is captured by a sketch `Y = A Ω` with a random n x l test
+ * matrix Ω (l = k plus oversampling), sharpened by a few power iterations
+ * `Y = (A Aᵀ)^q A Ω`, and orthonormalized to Q. The small l x n matrix `Qᵀ A`
+ * then gets an exact SVD. The cost is a handful of m x n x l products, all on
+ * the threaded GEMM kernel, instead of an O(m n min(m, n)) decomposition
+ * (Halko, Martinsson and Tropp).
+ *
+ * Random numbers come from the counter-based generator in Random.hpp: entry
+ * i of the test matrix is a pure function of (seed, i), so threads fill
+ * disjoint ranges without shared state and the result does not depend on the
+ * thread count.
+ */
+
+/** Distribution of the random test matrix used by low_rank(). */
+enum class Sketch {
+  /** Independent standard normal entries; the most robust choice. */
+  Gaussian,
+  /**
+   * A few ±1 entries per row at random positions, so the sketch `A Ω` costs
+   * O(m n) instead of a dense m x n x l product.
+   */
+  SparseSign
+};
+
+/** Tuning parameters of low_rank() and approx_rank(). */
+struct LowRankOptions {
+  /** Extra sketch columns beyond the requested rank. */
+  std::size_t oversampling = 10;
+
+  /** Number of power iterations `(A Aᵀ)`; each costs two more products with A. */
+  std::size_t power_iterations = 2;
+
+  /** Distribution of the test matrix. */
+  Sketch sketch = Sketch::Gaussian;
+
+  /** Seed of the counter-based random number generator. */
+  std::uint64_t seed = 1;
+};
+
+/** A rank-k approximation `A ≈ U Σ Vᵀ`; see low_rank(). */
+template <typename T>
+struct LowRankSVD {
+  /** The k largest singular values, in descending order. */
+  std::vector<T> singular_values;
+  /** U, m x k with orthonormal columns. */
+  Matrix<T> left_singular_vectors;
+  /** V, n x k with orthonormal columns. */
+  Matrix<T> right_singular_vectors;
+};
+
+namespace lin_alg::detail {
+
+/** Nonzeros per row of a sparse sign test matrix. */
+inline constexpr std::size_t SPARSE_SIGN_NONZEROS = 8;
+
+/** Minimum number of test matrix entries generated by one thread. */
+inline constexpr std::size_t SKETCH_GRAIN = std::size_t{1} << 14;
+
+/**
+ * @brief Orthonormalizes the @p count rows of @p X (each of length @p len) in
+ * place by modified Gram–Schmidt with one reorthogonalization pass.
+ *
+ * Rows that are numerically dependent on earlier ones are set to zero.
+ */
+template <std::floating_point T>
+void orthonormalize_rows(std::size_t count, std::size_t len, T* X)
+{
+  const T drop = std::numeric_limits<T>::epsilon() * static_cast<T>(len);
+  for (std::size_t i = 0; i < count; ++i) {
+    T* x = X + i * len;
+    const T original = std::sqrt(dot(len, x, x));
+    for (int pass = 0; pass < 2; ++pass)
+      for (std::size_t j = 0; j < i; ++j) {
+        const T* q = X + j * len;
+        axpy(len, -dot(len, q, x), q, x);
+      }
+    const T norm = std::sqrt(dot(len, x, x));
+    if (norm <= drop * original || norm == T{})
+      std::fill(x, x + len, T{});
+    else
+      scal(len, T{1} / norm, x);
+  }
+}
+
+/** Returns the @p rows x @p cols transpose of the row-major matrix @p X. */
+template <typename T>
+std::vector<T> transposed(std::size_t rows, std::size_t cols, const T* X)
+{
+  std::vector<T> Xt(rows * cols);
+  for (std::size_t i = 0; i < rows; ++i)
+    for (std::size_t j = 0; j < cols; ++j) Xt[j * rows + i] = X[i * cols + j];
+  return Xt;
+}
+
+/**
+ * @brief Returns the sketch `A Ω` (m x l) for a random n x l test matrix Ω
+ * drawn from @p opts.
+ */
+template <std::floating_point T>
+std::vector<T> sketch(const Matrix<T>& A, std::size_t l, const LowRankOptions& opts)
+{
+  const std::size_t m = A.rows(), n = A.cols();
+  const T* a = A.data().data();
+  std::vector<T> Y(m * l);
+
+  if (opts.sketch == Sketch::Gaussian) {
+    std::vector<T> omega(n * l);
+    parallel_for(0, n * l, SKETCH_GRAIN, [&](std::size_t lo, std::size_t hi) {
+      for (std::size_t i = lo; i < hi; ++i) omega[i] = counter_normal<T>(opts.seed, i);
+    });
+    gemm_blocked(m, l, n, a, omega.data(), Y.data());
+    return Y;
+  }
+
+  // Row j of Ω has z entries ±1 in distinct columns cols[j z .. j z + z). Each
+  // row draws from its own stream, since rejections make its draw count unbounded
+  const std::size_t z = std::min(SPARSE_SIGN_NONZEROS, l);
+  std::vector<std::size_t> cols(n * z);
+  std::vector<T> signs(n * z);
+  parallel_for(0, n, std::max<std::size_t>(1, SKETCH_GRAIN / z), [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t j = lo; j < hi; ++j) {
+      const std::uint64_t stream = counter_random(opts.seed, j);
+      std::uint64_t counter = 0;
+      for (std::size_t t = 0; t < z; ++t) {
+        std::uint64_t bits;
+        std::size_t c;
+        do {
+          bits = counter_random(stream, counter++);
+          c = static_cast<std::size_t>((bits >> 1) % l);
+        } while (std::find(cols.begin() + j * z, cols.begin() + j * z + t, c) != cols.begin() + j * z + t);
+        cols[j * z + t] = c;
+        signs[j * z + t] = (bits & 1) ? T{1} : T{-1};
+      }
+    }
+  });
+  parallel_for(0, m, std::max<std::size_t>(1, SKETCH_GRAIN / (n * z + 1)), [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) {
+      T* y = Y.data() + i * l;
+      for (std::size_t j = 0; j < n; ++j) {
+        const T aij = a[i * n + j];
+        if (aij == T{}) continue;
+        for (std::size_t t = 0; t < z; ++t) y[cols[j * z + t]] += signs[j * z + t] * aij;
+      }
+    }
+  });
+  return Y;
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Computes a rank-@p k approximation of @p A by a randomized SVD.
+ *
+ * The result is close to the truncated SVD: with the default two power
+ * iterations, the error `‖A - U Σ Vᵀ‖` is within a small factor of the
+ * optimal σₖ₊₁ unless the spectrum decays very slowly. The result is
+ * deterministic for a given seed, independent of the number of threads.
+ *
+ * @param A The matrix to approximate.
+ * @param k The target rank, at most min(m, n).
+ *
+ * @throws std::invalid_argument If @p k is zero or larger than min(m, n).
+ * @throws std::runtime_error If the small exact SVD fails to converge.
+ */
+template <std::floating_point T>
+LowRankSVD<T> low_rank(const Matrix<T>& A, std::size_t k, const LowRankOptions& opts = {})
+{
+  const std::size_t m = A.rows(), n = A.cols();
+  if (k == 0 || k > std::min(m, n))
+    throw std::invalid_argument("Target rank must be between 1 and the smaller matrix dimension.");
+
+  using namespace lin_alg::detail;
+  const std::size_t l = std::min(k + opts.oversampling, std::min(m, n));
+  const T* a = A.data().data();
+
+  // Qt (l x m) holds an orthonormal basis of the sketched range as rows
+  std::vector<T> Qt = transposed(m, l, sketch(A, l, opts).data());
+  orthonormalize_rows(l, m, Qt.data());
+
+  std::vector<T> Zt(l * n), Y(m * l);
+  for (std::size_t q = 0; q < opts.power_iterations; ++q) {
+    gemm_blocked(l, n, m, Qt.data(), a, Zt.data());
+    orthonormalize_rows(l, n, Zt.data());
+    const std::vector<T> Z = transposed(l, n, Zt.data());
+    gemm_blocked(m, l, n, a, Z.data(), Y.data());
+    Qt = transposed(m, l, Y.data());
+    orthonormalize_rows(l, m, Qt.data());
+  }
+
+  // B = Qᵀ A is l x n; its SVD B = W Σ Vᵀ gives U = Q W
+  Matrix<T> B(l, n);
+  gemm_blocked(l, n, m, Qt.data(), a, B.data().data());
+  const SVD<T> small(B);
+
+  const Matrix<T>& W = small.left_singular_vectors();
+  const Matrix<T>& V = small.right_singular_vectors();
+  const std::vector<T> Q = transposed(l, m, Qt.data());
+  std::vector<T> Wk(l * k);
+  for (std::size_t r = 0; r < l; ++r)
+    for (std::size_t c = 0; c < k; ++c) Wk[r * k + c] = W.data()[r * l + c];
+
+  LowRankSVD<T> result{std::vector<T>(small.singular_values().begin(), small.singular_values().begin() + k),
+      Matrix<T>(m, k), Matrix<T>(n, k)};
+  gemm_blocked(m, k, l, Q.data(), Wk.data(), result.left_singular_vectors.data().data());
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t c = 0; c < k; ++c) result.right_singular_vectors.data()[i * k + c] = V.data()[i * l + c];
+  return result;
+}
+
+/**
+ * @brief Estimates the numerical rank of @p A: the number of singular values
+ * larger than `tol σ₀`.
+ *
+ * Sketches of growing rank (16, 32, 64, ...) are computed with low_rank()
+ * until one resolves a singular value at or below the threshold, so the cost
+ * scales with the rank found rather than with the matrix dimensions.
+ *
+ * @param tol Threshold relative to the largest singular value.
+ *
+ * @throws std::runtime_error If an exact SVD fails to converge.
+ */
+template <std::floating_point T>
+std::size_t approx_rank(const Matrix<T>& A, T tol, const LowRankOptions& opts = {})
+{
+  const std::size_t p = std::min(A.rows(), A.cols());
+  for (std::size_t k = std::min<std::size_t>(16, p);; k = std::min(2 * k, p)) {
+    const LowRankSVD<T> approx = low_rank(A, k, opts);
+    const std::vector<T>& s = approx.singular_values;
+    const T cutoff = tol * s.front();
+    const auto rank = static_cast<std::size_t>(std::count_if(s.begin(), s.end(), [cutoff](const T& x) { return x > cutoff; }));
+    if (rank < k || k == p) return rank;
+  }
+}
+
+#endif
@@ -0,0 +1,138 @@
+#pragma once
+
+#ifndef WOJI_MAPPED_FILE_HPP
+#define WOJI_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define WOJI_HAS_MMAP 1
+#else
+#define WOJI_HAS_MMAP 0
+#endif
+
+/**
+ * @brief Read-only view of a whole file's contents.
+ *
+ * On POSIX systems the file is memory-mapped, so opening it costs no copy and
+ * pages are faulted in on demand. Elsewhere the file is read into an owned buffer.
+ */
+class MappedFile {
+private:
+  const char* _data = nullptr;
+  std::size_t _size = 0;
+  bool _mapped = false;
+  std::vector<char> _buffer;
+
+  void release() noexcept
+  {
+#if WOJI_HAS_MMAP
+    if (_mapped && _size > 0)
+      ::munmap(const_cast<char*>(_data), _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+    _mapped = false;
+    _buffer.clear();
+  }
+
+  void read_into_buffer(const std::filesystem::path& path)
+  {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+      throw std::runtime_error("Unable to open file: " + path.string());
+    in.seekg(0, std::ios::end);
+    _buffer.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+    if (!in)
+      throw std::runtime_error("Unable to read file: " + path.string());
+    _data = _buffer.data();
+    _size = _buffer.size();
+  }
+
+public:
+  /**
+   * @brief Opens and maps @p path for reading.
+   *
+   * @throws std::runtime_error If the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const std::filesystem::path& path)
+  {
+#if WOJI_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error("Unable to open file: " + path.string());
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Unable to stat file: " + path.string());
+    }
+
+    _size = static_cast<std::size_t>(st.st_size);
+    if (_size > 0) {
+      void* p = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (p == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("Unable to map file: " + path.string());
+      }
+      ::madvise(p, _size, MADV_SEQUENTIAL);
+      _data = static_cast<const char*>(p);
+      _mapped = true;
+    }
+    ::close(fd);
+#else
+    read_into_buffer(path);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept
+    : _data(other._data), _size(other._size), _mapped(other._mapped), _buffer(std::move(other._buffer))
+  {
+    other._data = nullptr;
+    other._size = 0;
+    other._mapped = false;
+  }
+
+  MappedFile& operator=(MappedFile&& other) noexcept
+  {
+    if (this != &other) {
+      release();
+      _data = other._data;
+      _size = other._size;
+      _mapped = other._mapped;
+      _buffer = std::move(other._buffer);
+      other._data = nullptr;
+      other._size = 0;
+      other._mapped = false;
+    }
+    return *this;
+  }
+
+  ~MappedFile() { release(); }
+
+  /** Returns a pointer to the first byte of the file. */
+  const char* data() const noexcept { return _data; }
+  /** Returns the size of the file in bytes. */
+  std::size_t size() const noexcept { return _size; }
+  /** Returns the file contents as a string view. */
+  std::string_view view() const noexcept { return {_data, _size}; }
+  /** Returns true if the contents are memory-mapped rather than copied. */
+  bool mapped() const noexcept { return _mapped; }
+};
+
+#endif
@@ -3,14 +3,51 @@
 #ifndef WOJI_MATRIX_HPP
 #define WOJI_MATRIX_HPP
 
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/MatrixView.hpp>
+
 #include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <concepts>
 #include <initializer_list>
 #include <iostream>
+#include <limits>
 #include <optional>
 #include <span>
+#include <sstream>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Options controlling how a matrix is rendered as text.
+ *
+ * @see Matrix::format()
+ */
+struct FormatOptions {
+  /**
+   * Significant digits for floating-point elements, as with `%g`. A negative value
+   * selects the shortest representation that round-trips exactly.
+   */
+  int precision = 6;
+
+  /** Text written between two elements of the same row. */
+  std::string_view delimiter = ", ";
+
+  /** Text written after every row. */
+  std::string_view row_delimiter = "\n";
+};
+
 /**
  * @brief A row-major matrix stored internally as a one-dimensional std::vector.
  *
@@ -34,6 +71,8 @@ private:
 
 
 public:
+  using value_type = T;
+
   /**
    * @brief Represents the result of a Reduced Row Echelon Form operation.
    *
@@ -65,7 +104,7 @@ public:
    *
    * @note All matrix entries will be default-initialized.
    */
-  explicit Matrix(const size_t rows, const size_t cols);
+  explicit constexpr Matrix(const size_t rows, const size_t cols);
 
   /** 
    * @brief Constructs a matrix with the given dimensions and initializer list.
@@ -77,7 +116,19 @@ public:
    * @throws std::invalid_argument If matrix dimensions are zero or @p initializer
    * is not of size `rows * cols`.
    */
-  Matrix(std::size_t rows, std::size_t cols, std::initializer_list<T> initializer);
+  constexpr Matrix(std::size_t rows, std::size_t cols, std::initializer_list<T> initializer);
+
+  /**
+   * @brief Constructs a matrix that takes ownership of existing row-major storage.
+   *
+   * @param rows Number of rows.
+   * @param cols Number of columns.
+   * @param data Elements in row-major order. The vector is moved from, not copied.
+   *
+   * @throws std::invalid_argument If matrix dimensions are zero or @p data is not
+   * of size `rows * cols`.
+   */
+  constexpr Matrix(std::size_t rows, std::size_t cols, std::vector<T>&& data);
 
   /** 
    * @brief Constructs a matrix with the given initializer list of rows.
@@ -86,7 +137,7 @@ public:
    * @throws std::invalid_argument If the matrix would have zero rows or zero columns,
    * or if the rows have different lengths.
    */
-  Matrix(std::initializer_list<std::initializer_list<T>> initializer);
+  constexpr Matrix(std::initializer_list<std::initializer_list<T>> initializer);
 
   /** 
    * @brief Constructs a matrix with the given initializer list of columns.
@@ -95,7 +146,7 @@ public:
    * @throws std::invalid_argument If the matrix would have zero rows or zero columns,
    * or if the columns have different lengths.
    */
-  static Matrix<T> from_columns(std::initializer_list<std::initializer_list<T>> columns);
+  static constexpr Matrix<T> from_columns(std::initializer_list<std::initializer_list<T>> columns);
 
   /**
    * @brief Constructs a matrix with the given initializer list of columns.
@@ -108,7 +159,7 @@ public:
    * @note This overload is useful when columns are already stored as std::vector
    * objects rather than initializer lists.
    */
-  static Matrix<T> from_columns(std::initializer_list<std::vector<T>> columns);
+  static constexpr Matrix<T> from_columns(std::initializer_list<std::vector<T>> columns);
 
   /**
    * @brief Construct a matrix from a vector of column vectors.
@@ -122,7 +173,7 @@ public:
    * @note The elements of each column vector become contiguous in memory row-wise
    * within the resulting matrix.
    */
-  static Matrix<T> from_columns(std::vector<std::vector<T>>& columns);
+  static constexpr Matrix<T> from_columns(std::vector<std::vector<T>>& columns);
 
   /**
    * @brief Constructs a new matrix as a copy of another matrix.
@@ -131,23 +182,23 @@ public:
    *
    * @note Performs a deep copy of all elements, preserving the original matrix dimensions.
    */
-  Matrix(const Matrix<T>& other) = default;
-  Matrix(Matrix&&) noexcept = default;
-  Matrix& operator=(const Matrix&) = default;
-  Matrix& operator=(Matrix&&) noexcept = default;
+  constexpr Matrix(const Matrix<T>& other) = default;
+  constexpr Matrix(Matrix&&) noexcept = default;
+  constexpr Matrix& operator=(const Matrix&) = default;
+  constexpr Matrix& operator=(Matrix&&) noexcept = default;
 
   // ==============================================================================
   // Accessors
   // ==============================================================================
   
   /** Returns the number of rows. */
-  size_t rows() const noexcept { return _rows; }
+  constexpr size_t rows() const noexcept { return _rows; }
   /** Returns the number of columns. */
-  size_t cols() const noexcept { return _cols; }
+  constexpr size_t cols() const noexcept { return _cols; }
   /** Returns a mutable reference to the underlying data vector of the matrix. */
-  std::vector<T>& data() noexcept { return _data; }
+  constexpr std::vector<T>& data() noexcept { return _data; }
   /** Returns a const reference to the underlying data vector of the matrix. */
-  const std::vector<T>& data() const noexcept { return _data; }
+  constexpr const std::vector<T>& data() const noexcept { return _data; }
 
   // ==============================================================================
   // Arithmetic
@@ -161,7 +212,7 @@ public:
    *
    * @throws std::invalid_argument If the matrices have incompatible sizes.
    */
-  Matrix<T> operator*(const Matrix<T>& other) const;
+  constexpr Matrix<T> operator*(const Matrix<T>& other) const;
 
   /**
    * @brief Multiplies this matrix by a scalar and returns the result.
@@ -170,7 +221,7 @@ public:
    * @returns A new Matrix<T> containing the product of this matrix and the scalar.
    *
    */
-  Matrix<T> operator*(const T& scalar) const;
+  constexpr Matrix<T> operator*(const T& scalar) const;
 
   /**
    * @brief Multiplies every element of this matrix by a scalar in place.
@@ -178,7 +229,7 @@ public:
    * @param scalar The scalar value to multiply by.
    * @return Reference to this matrix after scaling.
    */
-  Matrix<T>& operator*=(const T& scalar);
+  constexpr Matrix<T>& operator*=(const T& scalar);
 
   /**
    * @brief Adds this matrix to another matrix and returns the result.
@@ -189,7 +240,7 @@ public:
    * @throws std::invalid_argument If the matrices have different dimensions.
    *
    */
-  Matrix<T> operator+(const Matrix<T>& other) const;
+  constexpr Matrix<T> operator+(const Matrix<T>& other) const;
 
   /**
    * @brief Adds another matrix to this matrix in place.
@@ -199,7 +250,170 @@ public:
    *
    * @throws std::invalid_argument If the matricies have different dimensions.
    */
-  Matrix<T>& operator+=(const Matrix<T>& other);
+  constexpr Matrix<T>& operator+=(const Matrix<T>& other);
+
+  /**
+   * @brief Subtracts another matrix from this matrix and returns the result.
+   *
+   * @param other The matrix to subtract from this matrix.
+   * @return A new Matrix<T> representing the element-wise difference.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T> operator-(const Matrix<T>& other) const;
+
+  /**
+   * @brief Subtracts another matrix from this matrix in place.
+   *
+   * @param other The matrix to subtract.
+   * @return Reference to this matrix after subtraction.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T>& operator-=(const Matrix<T>& other);
+
+  /** Returns a new matrix with every element negated. */
+  constexpr Matrix<T> operator-() const;
+
+  /**
+   * @brief Divides this matrix by a scalar and returns the result.
+   *
+   * @param scalar The scalar to divide every element by.
+   * @returns A new Matrix<T> containing the quotient.
+   */
+  constexpr Matrix<T> operator/(const T& scalar) const;
+
+  /**
+   * @brief Divides every element of this matrix by a scalar in place.
+   *
+   * @param scalar The scalar value to divide by.
+   * @return Reference to this matrix after division.
+   */
+  constexpr Matrix<T>& operator/=(const T& scalar);
+
+  /**
+   * @brief Applies the rank-1 update `A += alpha * x * yᵀ` in place (GER).
+   *
+   * @param alpha Scale of the outer product.
+   * @param x A vector of size rows().
+   * @param y A vector of size cols().
+   * @return Reference to this matrix.
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   *
+   * @note No temporary matrices are formed; each row receives one vectorized
+   * update, and rows are spread across threads.
+   */
+  constexpr Matrix<T>& rank1_update(const T& alpha, std::span<const T> x, std::span<const T> y);
+
+  /**
+   * @brief Computes `y = A x` into caller-provided storage (GEMV).
+   *
+   * This is the LinearOperator interface used by matrix-free solvers; it does
+   * not allocate.
+   *
+   * @param x A vector of size cols().
+   * @param y A vector of size rows(); overwritten. Must not overlap @p x.
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  constexpr void apply(std::span<const T> x, std::span<T> y) const;
+
+  /**
+   * @brief Returns the Gram matrix `Aᵀ A` (SYRK).
+   *
+   * @return A symmetric cols() x cols() matrix.
+   *
+   * @note Only the upper triangle is computed; the lower one is mirrored from it.
+   */
+  constexpr Matrix<T> gram() const;
+
+  // ==============================================================================
+  // Element-wise Operations
+  // ==============================================================================
+
+  /**
+   * @brief Returns the Hadamard (element-wise) product of this matrix and another.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T> hadamard(const Matrix<T>& other) const;
+
+  /**
+   * @brief Multiplies this matrix element-wise by another in place.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T>& hadamard_in_place(const Matrix<T>& other);
+
+  /**
+   * @brief Returns the element-wise quotient of this matrix and another.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T> element_divide(const Matrix<T>& other) const;
+
+  /**
+   * @brief Divides this matrix element-wise by another in place.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr Matrix<T>& element_divide_in_place(const Matrix<T>& other);
+
+  /**
+   * @brief Applies a function to every element and returns the results.
+   *
+   * @param f Callable `U(const T&)`; the result element type is its return type,
+   * which must not be bool (use unsigned char for masks).
+   * @return A Matrix<U> of the same dimensions holding `f(a_ij)`.
+   *
+   * @note All element-wise operations share one kernel, which vectorizes inlined
+   * callables and splits large matrices across threads. @p f may therefore be
+   * called concurrently and in any order.
+   */
+  template <typename F>
+  constexpr auto transform(F f) const -> Matrix<std::decay_t<std::invoke_result_t<F&, const T&>>>;
+
+  /**
+   * @brief Replaces every element with `f(a_ij)`.
+   *
+   * @param f Callable `T(const T&)`.
+   * @return Reference to this matrix.
+   *
+   * @see transform()
+   */
+  template <typename F>
+  constexpr Matrix<T>& transform_in_place(F f);
+
+  /**
+   * @brief Combines this matrix element-wise with another and returns the results.
+   *
+   * @param g Callable `V(const T&, const U&)`; the result element type is its
+   * return type, which must not be bool.
+   * @param other A matrix with the same dimensions.
+   * @return A Matrix<V> holding `g(a_ij, b_ij)`.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   *
+   * @see transform()
+   */
+  template <typename G, typename U>
+  constexpr auto zip_transform(G g, const Matrix<U>& other) const
+    -> Matrix<std::decay_t<std::invoke_result_t<G&, const T&, const U&>>>;
+
+  /**
+   * @brief Replaces every element with `g(a_ij, b_ij)`.
+   *
+   * @param g Callable `T(const T&, const U&)`.
+   * @param other A matrix with the same dimensions.
+   * @return Reference to this matrix.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   *
+   * @see transform()
+   */
+  template <typename G, typename U>
+  constexpr Matrix<T>& zip_transform_in_place(G g, const Matrix<U>& other);
 
   // ==============================================================================
   // Operator Overloads
@@ -211,7 +425,7 @@ public:
    * @param other The matrix to compare with this matrix.
    * @returns True if both matrices are equal. False otherwise.
    */
-  bool operator==(const Matrix<T>& other) const;
+  constexpr bool operator==(const Matrix<T>& other) const;
 
   /**
    * @brief Checks whether this matrix is not equal to another matrix.
@@ -219,7 +433,7 @@ public:
    * @param other The matrix to compare with this matrix.
    * @returns True if both matrices are not equal. False otherwise.
    */
-  bool operator!=(const Matrix<T>& other) const;
+  constexpr bool operator!=(const Matrix<T>& other) const;
 
 
   // ==============================================================================
@@ -236,7 +450,7 @@ public:
    * similar to a 2D array. The returned span is a direct view into the
    * underlying storage. Modifying it affects the matrix.
    */
-  std::span<T> operator[](int i);
+  constexpr std::span<T> operator[](int i);
 
   /**
    * @brief Returns a mutable span representing a specific row.
@@ -248,7 +462,7 @@ public:
    * similar to a 2D array. The returned span is a direct view into the
    * underlying storage. Modifying it affects the matrix.
    */
-  std::span<const T> operator[](int i) const;
+  constexpr std::span<const T> operator[](int i) const;
 
   /**
    * @brief Returns a reference to the element at (r, c).
@@ -259,7 +473,7 @@ public:
    *
    * @throws std::out_of_range If @p r or @p c is outside the valid range.
    */
-  T& at(size_t r, size_t c);
+  constexpr T& at(size_t r, size_t c);
 
   /**
    * @brief Returns a const reference to the element at (r, c).
@@ -270,7 +484,7 @@ public:
    *
    * @throws std::out_of_range If @p r or @p c is outside the valid range.
    */
-  const T& at(size_t r, size_t c) const;
+  constexpr const T& at(size_t r, size_t c) const;
 
   // ==============================================================================
   // Row Access
@@ -287,7 +501,7 @@ public:
    * @note The returned span is a direct view into the underlying storage. Modifying
    * the span will modify the corresponding entries in the matrix.
    */
-  std::span<T> row_at(size_t r);
+  constexpr std::span<T> row_at(size_t r);
 
   /**
    * @brief Returns a const span representing the specified row.
@@ -297,7 +511,42 @@ public:
    *
    * @throws std::out_of_range If the row index is outside the valid range.
    */
-  std::span<const T> row_at(size_t r) const;
+  constexpr std::span<const T> row_at(size_t r) const;
+
+  // ==============================================================================
+  // Views and Blocks
+  // ==============================================================================
+
+  /** Returns a mutable view of the whole matrix. */
+  constexpr MatrixView<T> view() noexcept { return MatrixView<T>(_data.data(), _rows, _cols, _cols); }
+  /** Returns a read-only view of the whole matrix. */
+  constexpr MatrixView<const T> view() const noexcept { return MatrixView<const T>(_data.data(), _rows, _cols, _cols); }
+
+  /**
+   * @brief Returns a mutable view of the @p h x @p w block whose top-left element is (r, c).
+   *
+   * Writing through the view (or assigning to it with MatrixView::assign()) modifies
+   * this matrix; nothing is copied.
+   *
+   * @throws std::out_of_range If the block does not fit inside the matrix.
+   */
+  constexpr MatrixView<T> block(size_t r, size_t c, size_t h, size_t w);
+
+  /**
+   * @brief Returns a read-only view of the @p h x @p w block whose top-left element is (r, c).
+   *
+   * @throws std::out_of_range If the block does not fit inside the matrix.
+   */
+  constexpr MatrixView<const T> block(size_t r, size_t c, size_t h, size_t w) const;
+
+  /**
+   * @brief Overwrites the block whose top-left element is (r, c) with @p src.
+   *
+   * @throws std::out_of_range If @p src does not fit inside the matrix at (r, c).
+   *
+   * @note @p src must not overlap the destination block.
+   */
+  constexpr void set_block(size_t r, size_t c, MatrixView<const T> src);
 
   // ==============================================================================
   // Row Operations
@@ -310,7 +559,7 @@ public:
    *
    * @throws std::out_of_range If either @p r1 or @p r2 is outside the valid row range.
    */
-  void swap_rows(size_t r1, size_t r2);
+  constexpr void swap_rows(size_t r1, size_t r2);
 
   /**
    * @brief Scales a row.
@@ -320,7 +569,7 @@ public:
    *
    * @throws std::out_of_range If @p r is outside the valid row range.
    */
-  void scale_row(size_t r, const T& scalar);
+  constexpr void scale_row(size_t r, const T& scalar);
 
   /**
    * @brief Adds one row of the matrix, multiplied by a scalar to another row of the matrix.
@@ -333,7 +582,7 @@ public:
    *
    * @throws std::out_of_range If @p r1 or @p r2 is outside the valid row range.
    */
-  void add_row(size_t r1, size_t r2, const T& scalar);
+  constexpr void add_row(size_t r1, size_t r2, const T& scalar);
 
   // ==============================================================================
   // Linear Algebra Operations
@@ -356,11 +605,15 @@ public:
    *  - Arithmetic operations.
    *  - Constructions from literals (i.e., @c T{1}).
    *
+   * @note Floating types (see ApproximateField) use partial pivoting and treat
+   * elements no larger than `epsilon * max(rows, cols) * max|a_ij|` as zero; other
+   * types pivot on the first nonzero element and compare exactly.
+   *
    * @warning Usage of floating types such as @c double or @c float are recommended,
    * as division of integral types such as @c int may yield truncated results.
    *  
    */
-  RrefResult rref_stats(std::optional<std::span<T>> opt_rhs = std::nullopt) const;
+  constexpr RrefResult rref_stats(std::optional<std::span<T>> opt_rhs = std::nullopt) const;
 
   /**
    * @brief Computes the Reduced Row Echelon Form (RREF) of the matrix.
@@ -384,7 +637,7 @@ public:
    *
    * @see rref_stats()
    */
-  Matrix<T> rref() const;
+  constexpr Matrix<T> rref() const;
 
   /**
    * @brief Computes the determinant of a square matrix.
@@ -394,20 +647,19 @@ public:
    * @throws std::invalid_argument If the matrix is not square.
    *
    * @note The determinant is computed using Gaussian elimination through a RREF routine.
-   *
-   * @warning For best accuracy, use floating-point element types such as @c double or
-   *          @c float. Integral element types may yield truncated due to integer division.
+   * Integral element types (see EuclideanRing) instead use fraction-free Bareiss
+   * elimination, which is exact as long as intermediate minors fit in @p T.
    *
    * @see rref_stats()
    */
-  T det() const;
+  constexpr T det() const;
 
   /**
    * @brief Checks whether the matrix is linearly independent.
    *
    * @return True if there is a pivot in every column, false otherwise.
    */
-  bool linearly_independent() const;
+  constexpr bool linearly_independent() const;
 
   /**
    * @brief Solves A x = b for x, where this matrix is A and b is a column vector.
@@ -418,12 +670,79 @@ public:
    * @note If the system has infinitely many solutions, this returns one solution
    * with all free variables set to zero.
    *
-   * @warning This operation can be fairly expensive! It is recommended to simply
-   * construct an augmented matrix and retrieve the last row.
+   * @warning This operation can be fairly expensive! When the matrix is not needed
+   * afterwards, reduce an AugmentedView of it and @p b with rref_in_place() instead,
+   * which works in place without copying either.
    *
    * @throws std::invalid_argument If b.size != rows().
    */
-  std::optional<std::vector<T>> solution(std::span<const T> b) const;
+  constexpr std::optional<std::vector<T>> solution(std::span<const T> b) const;
+
+  // ==============================================================================
+  // Reductions
+  // ==============================================================================
+
+  /**
+   * @brief Folds every element into an accumulator in a single pass over memory.
+   *
+   * This is the building block for the other reductions, and lets several of
+   * them be fused: an accumulator struct can collect, e.g., a sum, a sum of
+   * squares and a maximum at once.
+   *
+   * @param identity Starting accumulator; must be neutral for @p merge.
+   * @param step Callable `Acc(Acc, const T&)` folding one element into an accumulator.
+   * @param merge Associative callable `Acc(Acc, Acc)` combining partial results.
+   * @return The accumulated value.
+   *
+   * @note Elements are folded in blocks that are merged pairwise, and large matrices
+   * are split across threads, so @p step and @p merge may run concurrently.
+   *
+   * @snippet tests/test_matrix.cpp fused_reduce_example
+   */
+  template <typename Acc, typename Step, typename Merge>
+  constexpr Acc reduce(const Acc& identity, Step step, Merge merge) const;
+
+  /** Returns the sum of all elements. */
+  constexpr T sum() const;
+
+  /**
+   * @brief Returns the sum of the diagonal elements.
+   *
+   * @throws std::invalid_argument If the matrix is not square.
+   */
+  constexpr T trace() const;
+
+  /**
+   * @brief Returns the Frobenius inner product, the sum of `a_ij * b_ij`.
+   *
+   * @param other A matrix with the same dimensions.
+   *
+   * @throws std::invalid_argument If the matrices have different dimensions.
+   */
+  constexpr T dot(const Matrix<T>& other) const;
+
+  /** Returns a vector of size rows() holding the sum of each row. */
+  constexpr std::vector<T> row_sums() const;
+
+  /** Returns a vector of size cols() holding the sum of each column. */
+  constexpr std::vector<T> col_sums() const;
+
+  /** Returns the largest absolute value of any element. */
+  constexpr T max_abs() const requires std::totally_ordered<T>;
+
+  /** Returns the induced 1-norm: the largest absolute column sum. */
+  constexpr T norm_1() const requires std::totally_ordered<T>;
+
+  /** Returns the induced infinity-norm: the largest absolute row sum. */
+  constexpr T norm_inf() const requires std::totally_ordered<T>;
+
+  /**
+   * @brief Returns the Frobenius norm: the square root of the sum of squared elements.
+   *
+   * Elements are scaled by max_abs() before squaring, so the result neither
+   * overflows nor underflows unless the norm itself does.
+   */
+  T norm_fro() const requires std::floating_point<T>;
 
   // ==============================================================================
   // Printing Utility
@@ -431,21 +750,69 @@ public:
 
   /** Prints the matrix to the standard output stream in row-major format. */
   void print() const;
+
+  /**
+   * @brief Writes the matrix as text to an output stream.
+   *
+   * Elements are rendered with std::to_chars into a large buffer that is handed to
+   * @p out in a few bulk writes, rather than streamed element by element.
+   *
+   * @param out Destination stream.
+   * @param opts Precision and delimiters to use.
+   *
+   * @note Arithmetic types are rendered with std::to_chars. Other types are rendered
+   * with a `to_chars(char*, char*, const T&)` overload found by argument-dependent
+   * lookup (as provided for Rational) if one exists, and with `operator<<` otherwise.
+   */
+  void format(std::ostream& out, const FormatOptions& opts = {}) const;
+
+#if defined(__unix__) || defined(__APPLE__)
+  /**
+   * @brief Writes the matrix as text to a POSIX file descriptor.
+   *
+   * @param fd An open, writable file descriptor.
+   * @param opts Precision and delimiters to use.
+   *
+   * @throws std::runtime_error If writing to @p fd fails.
+   */
+  void format(int fd, const FormatOptions& opts = {}) const;
+#endif
+
+private:
+  /**
+   * @brief Renders the matrix in buffer-sized pieces.
+   *
+   * @param sink Callable invoked as `sink(const char* data, std::size_t size)`.
+   */
+  template <typename Sink>
+  void format_to(Sink&& sink, const FormatOptions& opts) const;
 };
 
+/**
+ * @brief Writes @p m to @p os using the default FormatOptions.
+ *
+ * @see Matrix::format()
+ */
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const Matrix<T>& m)
+{
+  m.format(os);
+  return os;
+}
+
 // ==============================================================================
 // Constructor Definitions
 // ==============================================================================
 
 template <typename T>
-Matrix<T>::Matrix(size_t rows, size_t cols) : _rows(rows), _cols(cols), _data(rows * cols) 
+constexpr Matrix<T>::Matrix(size_t rows, size_t cols) : _rows(rows), _cols(cols), _data(rows * cols) 
 {
   if (rows == 0 || cols == 0) 
     throw std::invalid_argument("Matrix dimensions cannot be zero.");
 }
 
 template <typename T>
-Matrix<T>::Matrix(std::size_t rows, std::size_t cols, std::initializer_list<T> initializer) 
+constexpr Matrix<T>::Matrix(std::size_t rows, std::size_t cols, std::initializer_list<T> initializer) 
   : _rows(rows), _cols(cols), _data(initializer) 
 { 
   if (rows == 0 || cols == 0) 
@@ -455,7 +822,17 @@ Matrix<T>::Matrix(std::size_t rows, std::size_t cols, std::initializer_list<T> i
 }
 
 template <typename T>
-Matrix<T>::Matrix(std::initializer_list<std::initializer_list<T>> initializer)
+constexpr Matrix<T>::Matrix(std::size_t rows, std::size_t cols, std::vector<T>&& data)
+  : _rows(rows), _cols(cols), _data(std::move(data))
+{
+  if (rows == 0 || cols == 0)
+    throw std::invalid_argument("Matrix dimensions cannot be zero.");
+  if (_data.size() != rows * cols)
+    throw std::invalid_argument("Data size does not match matrix dimensions.");
+}
+
+template <typename T>
+constexpr Matrix<T>::Matrix(std::initializer_list<std::initializer_list<T>> initializer)
 {
   _rows = initializer.size();
   if (_rows == 0) 
@@ -476,7 +853,7 @@ Matrix<T>::Matrix(std::initializer_list<std::initializer_list<T>> initializer)
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::initializer_list<T>> columns)
+constexpr Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::initializer_list<T>> columns)
 {
   std::vector<std::vector<T>> cols;
   cols.reserve(columns.size());
@@ -485,7 +862,7 @@ Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::initializer_list<T>
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::vector<T>> columns)
+constexpr Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::vector<T>> columns)
 {
   std::vector<std::vector<T>> cols;
   cols.reserve(columns.size());
@@ -494,7 +871,7 @@ Matrix<T> Matrix<T>::from_columns(std::initializer_list<std::vector<T>> columns)
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::from_columns(std::vector<std::vector<T>>& columns) {
+constexpr Matrix<T> Matrix<T>::from_columns(std::vector<std::vector<T>>& columns) {
   size_t cols = columns.size();
   if (cols == 0) 
     throw std::invalid_argument("Matrix must have at least one column.");
@@ -531,7 +908,7 @@ Matrix<T> Matrix<T>::from_columns(std::vector<std::vector<T>>& columns) {
 // ==============================================================================
 
 template <typename T>
-Matrix<T> Matrix<T>::operator*(const Matrix<T>& other) const
+constexpr Matrix<T> Matrix<T>::operator*(const Matrix<T>& other) const
 {
   if (cols() != other.rows()) 
     throw std::invalid_argument("Matrix sizes are mismatched!");
@@ -540,69 +917,169 @@ Matrix<T> Matrix<T>::operator*(const Matrix<T>& other) const
   // i.e. (AB)_ij = summation from k = 0 -> n - 1 (A_ik * B_kj)
   Matrix<T> product = Matrix<T>(rows(), other.cols());
 
-  for (size_t i = 0; i < rows(); ++i)
-  {
-    for (size_t j = 0; j < other.cols(); ++j)
-    {
-      T sum{};
-      for (size_t k = 0; k < cols(); ++k)
-      {
-        sum += _data[i * _cols + k] * other._data[k * other._cols + j];
-      }
-      product._data[i * product._cols + j] = sum;
-    }
-  }
+  if (std::is_constant_evaluated())
+    lin_alg::detail::gemm(rows(), other.cols(), cols(),
+        _data.data(), other._data.data(), product._data.data());
+  else
+    lin_alg::detail::gemm_blocked(rows(), other.cols(), cols(),
+        _data.data(), other._data.data(), product._data.data());
   return product;
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::operator*(const T& scalar) const
+constexpr Matrix<T> Matrix<T>::operator*(const T& scalar) const
 {
-  Matrix<T> product = Matrix<T>(*this);
-  
+  return transform([&scalar](const T& x) { return x * scalar; });
+}
 
-  for (auto it = product._data.begin(); it != product._data.end(); ++it)
-  {
-    (*it) *= scalar;
-  }
+template <typename T>
+constexpr Matrix<T>& Matrix<T>::operator*=(const T& scalar)
+{
+  return transform_in_place([&scalar](const T& x) { return x * scalar; });
+}
 
-  return product;
+template <typename T>
+constexpr Matrix<T> Matrix<T>::operator/(const T& scalar) const
+{
+  return transform([&scalar](const T& x) { return x / scalar; });
 }
 
 template <typename T>
-Matrix<T>& Matrix<T>::operator*=(const T& scalar)
+constexpr Matrix<T>& Matrix<T>::operator/=(const T& scalar)
 {
-  for (auto& x : _data) x *= scalar;
+  return transform_in_place([&scalar](const T& x) { return x / scalar; });
+}
+
+template <typename T>
+constexpr Matrix<T> Matrix<T>::operator+(const Matrix<T>& other) const
+{
+  return zip_transform([](const T& a, const T& b) { return a + b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T>& Matrix<T>::operator+=(const Matrix<T>& other)
+{
+  return zip_transform_in_place([](const T& a, const T& b) { return a + b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T> Matrix<T>::operator-(const Matrix<T>& other) const
+{
+  return zip_transform([](const T& a, const T& b) { return a - b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T>& Matrix<T>::operator-=(const Matrix<T>& other)
+{
+  return zip_transform_in_place([](const T& a, const T& b) { return a - b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T> Matrix<T>::operator-() const
+{
+  return transform([](const T& x) { return -x; });
+}
+
+template <typename T>
+constexpr Matrix<T>& Matrix<T>::rank1_update(const T& alpha, std::span<const T> x, std::span<const T> y)
+{
+  if (x.size() != rows() || y.size() != cols())
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  lin_alg::detail::ger(rows(), cols(), alpha, x.data(), y.data(), _data.data());
   return *this;
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::operator+(const Matrix<T>& other) const
+constexpr void Matrix<T>::apply(std::span<const T> x, std::span<T> y) const
 {
-  if (rows() != other.rows() || cols() != other.cols()) 
-    throw std::invalid_argument("Matrix sizes are mismatched!");
-  Matrix<T> sum = Matrix<T>(rows(), cols());
+  if (x.size() != cols() || y.size() != rows())
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
 
-  auto sum_it = sum.data().begin();
-  auto lhs_it = data().cbegin();
-  auto lhs_end = data().cend();
-  auto other_it = other.data().cbegin();
-  for (; lhs_it != lhs_end; ++lhs_it, ++other_it, ++sum_it)
-  {
-    *sum_it = *lhs_it + *other_it;
-  }
+  lin_alg::detail::gemv(rows(), cols(), _data.data(), x.data(), y.data());
+}
 
-  return sum;
+template <typename T>
+constexpr Matrix<T> Matrix<T>::gram() const
+{
+  Matrix<T> C(cols(), cols());
+  lin_alg::detail::syrk(rows(), cols(), _data.data(), C._data.data());
+  return C;
+}
+
+// ==============================================================================
+// Element-wise Operation Definitions
+// ==============================================================================
+
+template <typename T>
+constexpr Matrix<T> Matrix<T>::hadamard(const Matrix<T>& other) const
+{
+  return zip_transform([](const T& a, const T& b) { return a * b; }, other);
 }
 
 template <typename T>
-Matrix<T>& Matrix<T>::operator+=(const Matrix<T>& other)
+constexpr Matrix<T>& Matrix<T>::hadamard_in_place(const Matrix<T>& other)
 {
-  if (_rows != other._rows || _cols != other._cols) 
+  return zip_transform_in_place([](const T& a, const T& b) { return a * b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T> Matrix<T>::element_divide(const Matrix<T>& other) const
+{
+  return zip_transform([](const T& a, const T& b) { return a / b; }, other);
+}
+
+template <typename T>
+constexpr Matrix<T>& Matrix<T>::element_divide_in_place(const Matrix<T>& other)
+{
+  return zip_transform_in_place([](const T& a, const T& b) { return a / b; }, other);
+}
+
+template <typename T>
+template <typename F>
+constexpr auto Matrix<T>::transform(F f) const -> Matrix<std::decay_t<std::invoke_result_t<F&, const T&>>>
+{
+  using U = std::decay_t<std::invoke_result_t<F&, const T&>>;
+  static_assert(!std::is_same_v<U, bool>,
+      "transform() cannot produce Matrix<bool> (std::vector<bool> is not contiguous); return unsigned char instead.");
+  Matrix<U> result(rows(), cols());
+  lin_alg::detail::elementwise(_data.size(), result.data().data(), f, _data.data());
+  return result;
+}
+
+template <typename T>
+template <typename F>
+constexpr Matrix<T>& Matrix<T>::transform_in_place(F f)
+{
+  lin_alg::detail::elementwise(_data.size(), _data.data(), f, std::as_const(_data).data());
+  return *this;
+}
+
+template <typename T>
+template <typename G, typename U>
+constexpr auto Matrix<T>::zip_transform(G g, const Matrix<U>& other) const
+  -> Matrix<std::decay_t<std::invoke_result_t<G&, const T&, const U&>>>
+{
+  if (rows() != other.rows() || cols() != other.cols())
     throw std::invalid_argument("Matrix sizes are mismatched!");
 
-  for (size_t idx = 0; idx < _data.size(); ++idx)
-    _data[idx] += other._data[idx];
+  using V = std::decay_t<std::invoke_result_t<G&, const T&, const U&>>;
+  static_assert(!std::is_same_v<V, bool>,
+      "zip_transform() cannot produce Matrix<bool> (std::vector<bool> is not contiguous); return unsigned char instead.");
+  Matrix<V> result(rows(), cols());
+  lin_alg::detail::elementwise(_data.size(), result.data().data(), g, _data.data(), other.data().data());
+  return result;
+}
+
+template <typename T>
+template <typename G, typename U>
+constexpr Matrix<T>& Matrix<T>::zip_transform_in_place(G g, const Matrix<U>& other)
+{
+  if (rows() != other.rows() || cols() != other.cols())
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+
+  lin_alg::detail::elementwise(_data.size(), _data.data(), g,
+      std::as_const(_data).data(), other.data().data());
   return *this;
 }
 
@@ -611,15 +1088,15 @@ Matrix<T>& Matrix<T>::operator+=(const Matrix<T>& other)
 // ==============================================================================
 
 template <typename T>
-bool Matrix<T>::operator==(const Matrix<T>& other) const
+constexpr bool Matrix<T>::operator==(const Matrix<T>& other) const
 {
   return _rows == other._rows && _cols == other._cols && _data == other._data;
 }
 
 template <typename T>
-bool Matrix<T>::operator!=(const Matrix<T>& other) const
+constexpr bool Matrix<T>::operator!=(const Matrix<T>& other) const
 {
-  return !(*this == *other);
+  return !(*this == other);
 }
 
 // ==============================================================================
@@ -627,20 +1104,20 @@ bool Matrix<T>::operator!=(const Matrix<T>& other) const
 // ==============================================================================
 
 template <typename T>
-std::span<T> Matrix<T>::operator[](int i)
+constexpr std::span<T> Matrix<T>::operator[](int i)
 {
   return row_at(i);
 }
 
 
 template <typename T>
-std::span<const T> Matrix<T>::operator[](int i) const
+constexpr std::span<const T> Matrix<T>::operator[](int i) const
 {
   return row_at(i);
 }
 
 template <typename T>
-inline T& Matrix<T>::at(size_t r, size_t c)
+constexpr T& Matrix<T>::at(size_t r, size_t c)
 {
   if (r >= _rows  || c >= _cols ) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
@@ -648,7 +1125,7 @@ inline T& Matrix<T>::at(size_t r, size_t c)
 }
 
 template <typename T>
-inline const T& Matrix<T>::at(size_t r, size_t c) const
+constexpr const T& Matrix<T>::at(size_t r, size_t c) const
 {
   if (r >= _rows  || c >= _cols ) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
@@ -660,7 +1137,7 @@ inline const T& Matrix<T>::at(size_t r, size_t c) const
 // ==============================================================================
 
 template <typename T>
-std::span<T> Matrix<T>::row_at(size_t r)
+constexpr std::span<T> Matrix<T>::row_at(size_t r)
 {
   if (r >= _rows) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
@@ -668,19 +1145,41 @@ std::span<T> Matrix<T>::row_at(size_t r)
 }
 
 template <typename T>
-std::span<const T> Matrix<T>::row_at(size_t r) const
+constexpr std::span<const T> Matrix<T>::row_at(size_t r) const
 {
   if (r >= _rows) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
   return std::span(&_data[r * _cols], _cols);
 }
 
+// ==============================================================================
+// View and Block Definitions
+// ==============================================================================
+
+template <typename T>
+constexpr MatrixView<T> Matrix<T>::block(size_t r, size_t c, size_t h, size_t w)
+{
+  return view().block(r, c, h, w);
+}
+
+template <typename T>
+constexpr MatrixView<const T> Matrix<T>::block(size_t r, size_t c, size_t h, size_t w) const
+{
+  return view().block(r, c, h, w);
+}
+
+template <typename T>
+constexpr void Matrix<T>::set_block(size_t r, size_t c, MatrixView<const T> src)
+{
+  block(r, c, src.rows(), src.cols()).assign(src);
+}
+
 // ==============================================================================
 // Row Operation Definitions
 // ==============================================================================
 
 template <typename T>
-void Matrix<T>::swap_rows(size_t r1, size_t r2)
+constexpr void Matrix<T>::swap_rows(size_t r1, size_t r2)
 {
   if (r1 >= rows() || r2 >= rows()) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
@@ -694,36 +1193,22 @@ void Matrix<T>::swap_rows(size_t r1, size_t r2)
 }
 
 template <typename T>
-void Matrix<T>::scale_row(size_t r, const T& scalar)
+constexpr void Matrix<T>::scale_row(size_t r, const T& scalar)
 {
   if (r >= rows()) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
 
-  std::for_each(
-      data().begin() + r * cols(),
-      data().begin() + r * cols() + cols(),
-      [scalar](T& x) { x *= scalar; }
-  );
+  lin_alg::detail::scal(cols(), scalar, _data.data() + r * cols());
 }
 
 template <typename T>
-void Matrix<T>::add_row(size_t r1, size_t r2, const T& scalar)
+constexpr void Matrix<T>::add_row(size_t r1, size_t r2, const T& scalar)
 {
   if (r1 >= rows() || r2 >= rows()) 
     throw std::out_of_range("Requested position outside of matrix dimensions.");
 
-  auto row1_it = data().begin() + r1 * cols();
-  auto row1_end = data().begin() + r1 * cols() + cols();
-
-  auto row2_begin = data().begin() + r2 * cols();
-
-  std::transform(
-    row1_it, row1_end,            // first range
-    row2_begin, row2_begin,       // second range (target)
-    [scalar](const T& a, T& b) { 
-      b += scalar * a;            // r2(i) += r1(i) * scalar
-      return b;
-    });
+  // r2(i) += r1(i) * scalar
+  lin_alg::detail::axpy(cols(), scalar, _data.data() + r1 * cols(), _data.data() + r2 * cols());
 }
 
 // ==============================================================================
@@ -731,96 +1216,49 @@ void Matrix<T>::add_row(size_t r1, size_t r2, const T& scalar)
 // ==============================================================================
 
 template <typename T>
-Matrix<T>::RrefResult Matrix<T>::rref_stats(std::optional<std::span<T>> opt_rhs) const
+constexpr Matrix<T>::RrefResult Matrix<T>::rref_stats(std::optional<std::span<T>> opt_rhs) const
 {
-  // NOTE: POSSIBLY ADD STATIC_ASSERT TO FORCE FLOATING POINT
   Matrix<T> m(*this);
-  size_t swaps = 0;
-  T scale_prod = T{1};
-  std::vector<std::size_t> pivot_cols;
 
   if (opt_rhs && opt_rhs->size() != m.rows())
     throw std::invalid_argument("rhs size must match matrix rows!");
-  
-  auto rhs_at = [&](size_t i) -> T& { return (*opt_rhs)[i]; };
-
-  size_t c = 0;
-  for (size_t r = 0; r < m.rows(); ++r)
-  {
-    if (c >= m.cols()) break;
 
-    // Find a row `r` with non-zero in column[c]
-    size_t i = r;
-    while (i < m.rows() && m.at(i, c) == T{})
-      ++i;
-
-    // Move to next col if no pivot found
-    if (i == m.rows())
-    {
-      ++c;
-      --r; // redo row
-      continue;
-    }
-
-    // Swap pivot row up
-    if (i != r) 
-    { 
-      m.swap_rows(i, r);
-      ++swaps;
-
-      // Swap rhs 'rows' (if exists)
-      if (opt_rhs) std::swap(rhs_at(i), rhs_at(r));
-    }
-
-    const T pivot_val = m.at(r, c);
-    if (pivot_val != T{1}) {
-      m.scale_row(r, T{1} / pivot_val);
-      scale_prod *= pivot_val;
-
-      if (opt_rhs) rhs_at(r) *= T{1} / pivot_val;
-    }
-
-    pivot_cols.push_back(c);
-
-    // Eliminate column in other rows
-    for (size_t row_idx = 0; row_idx < m.rows(); ++row_idx)
-    {
-      if (row_idx == r) continue;
-      const T f = m.at(row_idx, c);
-      if (f != T{})
-      {
-        m.add_row(r, row_idx, -f);
-        if (opt_rhs) rhs_at(row_idx) += -f * rhs_at(r);
-      }
-    }
-
-    // Now move on to next column
-    ++c;
-  }
-
-  const size_t rank = pivot_cols.size();
+  // The rhs (if any) rides along as a one-column right half
+  const MatrixView<T> rhs = opt_rhs
+    ? MatrixView<T>(opt_rhs->data(), m.rows(), 1, 1)
+    : MatrixView<T>(nullptr, m.rows(), 0, 0);
+  auto res = rref_in_place(AugmentedView<T>(m.view(), rhs));
 
   return RrefResult{
-    std::move(m), 
-    swaps, 
-    scale_prod, 
-    std::move(pivot_cols), 
-    rank
+    std::move(m),
+    res.swaps,
+    res.scale_prod,
+    std::move(res.pivots),
+    res.rank
   };
 }
 
 template <typename T>
-Matrix<T> Matrix<T>::rref() const
+constexpr Matrix<T> Matrix<T>::rref() const
 {
   return rref_stats().m;
 }
 
 template <typename T>
-T Matrix<T>::det() const
+constexpr T Matrix<T>::det() const
 {
   if (rows() != cols()) 
     throw std::invalid_argument("Finding a determinant requires a square matrix.");
   if (rows() == 1) return data()[0];
+
+  if constexpr (EuclideanRing<T>)
+  {
+    // Fraction-free elimination keeps every intermediate value integral
+    std::vector<T> a(_data);
+    const auto res = lin_alg::detail::fraction_free_eliminate(rows(), cols(), a.data());
+    if (res.rank < rows()) return T{};
+    return res.odd_swaps ? -a.back() : a.back();
+  }
   
   // RrefResult represents the collected result of performing an rref operation
   RrefResult res = rref_stats();
@@ -841,13 +1279,19 @@ T Matrix<T>::det() const
 }
 
 template <typename T>
-bool Matrix<T>::linearly_independent() const
+constexpr bool Matrix<T>::linearly_independent() const
 {
-  return this->cols() == rref_stats().rank;
+  if constexpr (EuclideanRing<T>)
+  {
+    std::vector<T> a(_data);
+    return cols() == lin_alg::detail::fraction_free_eliminate(rows(), cols(), a.data()).rank;
+  }
+  else
+    return this->cols() == rref_stats().rank;
 }
 
 template <typename T>
-std::optional<std::vector<T>> Matrix<T>::solution(std::span<const T> b) const
+constexpr std::optional<std::vector<T>> Matrix<T>::solution(std::span<const T> b) const
 {
   if (b.size() != rows())
     throw std::invalid_argument("Vector must have the same number of rows as the matrix!");
@@ -857,6 +1301,17 @@ std::optional<std::vector<T>> Matrix<T>::solution(std::span<const T> b) const
   auto rhs_span = std::span<T>(rhs);
   auto res = rref_stats(rhs_span);
   
+  // Rows reduced to zero are exactly zero; their rhs only needs a tolerance for
+  // floating types
+  T rhs_tol{};
+  if constexpr (ApproximateField<T>)
+  {
+    using lin_alg::detail::magnitude;
+    for (size_t idx = 0; idx < rhs.size(); ++idx)
+      rhs_tol = std::max({rhs_tol, magnitude(b[idx]), magnitude(rhs[idx])});
+    rhs_tol *= std::numeric_limits<T>::epsilon() * static_cast<T>(std::max(rows(), cols()));
+  }
+
   // Check for inconsistency
   for (size_t r = 0; r < res.m.rows(); ++r) {
     bool all_zeroes = true;
@@ -866,7 +1321,12 @@ std::optional<std::vector<T>> Matrix<T>::solution(std::span<const T> b) const
         break;
       }
     }
-    if (all_zeroes && rhs[r] != T{})
+    if constexpr (ApproximateField<T>)
+    {
+      if (all_zeroes && lin_alg::detail::magnitude(rhs[r]) > rhs_tol)
+        return std::nullopt;
+    }
+    else if (all_zeroes && rhs[r] != T{})
       return std::nullopt;
   }
 
@@ -882,20 +1342,413 @@ std::optional<std::vector<T>> Matrix<T>::solution(std::span<const T> b) const
   return solution_vector;
 }
 
+// ==============================================================================
+// Reduction Definitions
+// ==============================================================================
+
+template <typename T>
+template <typename Acc, typename Step, typename Merge>
+constexpr Acc Matrix<T>::reduce(const Acc& identity, Step step, Merge merge) const
+{
+  const T* a = _data.data();
+  return lin_alg::detail::reduce(_data.size(), identity,
+      [a, &step](const Acc& acc, size_t i) { return step(acc, a[i]); },
+      merge);
+}
+
+template <typename T>
+constexpr T Matrix<T>::sum() const
+{
+  const auto add = [](const T& a, const T& b) { return a + b; };
+  return reduce(T{}, add, add);
+}
+
+template <typename T>
+constexpr T Matrix<T>::trace() const
+{
+  if (rows() != cols())
+    throw std::invalid_argument("Finding a trace requires a square matrix.");
+
+  T sum{};
+  for (size_t idx = 0; idx < rows(); ++idx)
+    sum += _data[idx * _cols + idx];
+  return sum;
+}
+
+template <typename T>
+constexpr T Matrix<T>::dot(const Matrix<T>& other) const
+{
+  if (rows() != other.rows() || cols() != other.cols())
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+  return lin_alg::detail::dot(_data.size(), _data.data(), other._data.data());
+}
+
+template <typename T>
+constexpr std::vector<T> Matrix<T>::row_sums() const
+{
+  return lin_alg::detail::row_reduce(rows(), cols(), _data.data(), [](const T& x) { return x; });
+}
+
+template <typename T>
+constexpr std::vector<T> Matrix<T>::col_sums() const
+{
+  return lin_alg::detail::column_reduce(rows(), cols(), _data.data(), [](const T& x) { return x; });
+}
+
+template <typename T>
+constexpr T Matrix<T>::max_abs() const requires std::totally_ordered<T>
+{
+  using lin_alg::detail::magnitude;
+  return reduce(T{},
+      [](const T& acc, const T& x) { return std::max(acc, magnitude(x)); },
+      [](const T& a, const T& b) { return std::max(a, b); });
+}
+
+template <typename T>
+constexpr T Matrix<T>::norm_1() const requires std::totally_ordered<T>
+{
+  const auto sums = lin_alg::detail::column_reduce(rows(), cols(), _data.data(),
+      [](const T& x) { return lin_alg::detail::magnitude(x); });
+  return *std::max_element(sums.begin(), sums.end());
+}
+
+template <typename T>
+constexpr T Matrix<T>::norm_inf() const requires std::totally_ordered<T>
+{
+  const auto sums = lin_alg::detail::row_reduce(rows(), cols(), _data.data(),
+      [](const T& x) { return lin_alg::detail::magnitude(x); });
+  return *std::max_element(sums.begin(), sums.end());
+}
+
+template <typename T>
+T Matrix<T>::norm_fro() const requires std::floating_point<T>
+{
+  // Sum squares relative to the largest magnitude, so that neither tiny nor huge
+  // elements underflow or overflow when squared
+  const T scale = max_abs();
+  if (scale == T{} || !std::isfinite(scale)) return scale;
+  const T sum = reduce(T{},
+      [scale](const T& acc, const T& x) { return lin_alg::detail::fma(x / scale, x / scale, acc); },
+      [](const T& a, const T& b) { return a + b; });
+  return scale * std::sqrt(sum);
+}
+
 // ==============================================================================
 // Printing Utility Definitions
 // ==============================================================================
 
+namespace lin_alg::detail {
+
+/** Size of the text buffer used when formatting a matrix. */
+inline constexpr std::size_t FORMAT_BUFFER_BYTES = std::size_t{1} << 16;
+
 template <typename T>
-void Matrix<T>::print() const
+concept AdlToChars = requires(char* p, const T& value) {
+  { to_chars(p, p, value) } -> std::same_as<std::to_chars_result>;
+};
+
+/** Appends the text form of @p value to @p buf. */
+template <typename T>
+void append_element(std::string& buf, const T& value, int precision)
+{
+  char tmp[128];
+  std::to_chars_result res{};
+
+  if constexpr (std::is_floating_point_v<T>) {
+    res = precision < 0
+      ? std::to_chars(tmp, tmp + sizeof(tmp), value)
+      : std::to_chars(tmp, tmp + sizeof(tmp), value, std::chars_format::general, precision);
+  } else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+    res = std::to_chars(tmp, tmp + sizeof(tmp), value);
+  } else if constexpr (AdlToChars<T>) {
+    res = to_chars(tmp, tmp + sizeof(tmp), value);
+  } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    buf.append(std::string_view(value));
+    return;
+  } else {
+    std::ostringstream os;
+    os << value;
+    buf.append(os.str());
+    return;
+  }
+
+  if (res.ec != std::errc{})
+    throw std::runtime_error("Unable to format matrix element.");
+  buf.append(tmp, res.ptr);
+}
+
+} // namespace lin_alg::detail
+
+template <typename T>
+template <typename Sink>
+void Matrix<T>::format_to(Sink&& sink, const FormatOptions& opts) const
 {
+  std::string buf;
+  buf.reserve(lin_alg::detail::FORMAT_BUFFER_BYTES + 256);
+
+  const T* p = _data.data();
   for (std::size_t r = 0; r < _rows; ++r) {
-      for (std::size_t c = 0; c < _cols; ++c) {
-          std::cout << at(r, c);
-          if (c + 1 < _cols) std::cout << ", ";
+    for (std::size_t c = 0; c < _cols; ++c, ++p) {
+      lin_alg::detail::append_element(buf, *p, opts.precision);
+      if (c + 1 < _cols) buf.append(opts.delimiter);
+    }
+    buf.append(opts.row_delimiter);
+
+    if (buf.size() >= lin_alg::detail::FORMAT_BUFFER_BYTES) {
+      sink(buf.data(), buf.size());
+      buf.clear();
+    }
+  }
+  if (!buf.empty()) sink(buf.data(), buf.size());
+}
+
+template <typename T>
+void Matrix<T>::format(std::ostream& out, const FormatOptions& opts) const
+{
+  format_to([&](const char* data, std::size_t n) {
+    out.write(data, static_cast<std::streamsize>(n));
+  }, opts);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+template <typename T>
+void Matrix<T>::format(int fd, const FormatOptions& opts) const
+{
+  format_to([fd](const char* data, std::size_t n) {
+    while (n > 0) {
+      const ssize_t written = ::write(fd, data, n);
+      if (written < 0) {
+        if (errno == EINTR) continue;
+        throw std::runtime_error("Failed to write matrix to file descriptor.");
       }
-      std::cout << '\n';
+      data += written;
+      n -= static_cast<std::size_t>(written);
+    }
+  }, opts);
+}
+#endif
+
+template <typename T>
+void Matrix<T>::print() const
+{
+  format(std::cout);
+}
+
+// ==============================================================================
+// Concatenation
+// ==============================================================================
+
+/**
+ * @brief Places matrices side by side: `[first | rest...]`.
+ *
+ * The result is allocated once and each input is copied in with one bulk copy
+ * per row.
+ *
+ * @throws std::invalid_argument If the matrices have different numbers of rows.
+ */
+template <typename T, typename... Rest>
+  requires (std::same_as<Rest, Matrix<T>> && ...)
+constexpr Matrix<T> hstack(const Matrix<T>& first, const Rest&... rest)
+{
+  if (((rest.rows() != first.rows()) || ...))
+    throw std::invalid_argument("Horizontally stacked matrices must have the same number of rows.");
+
+  Matrix<T> out(first.rows(), (first.cols() + ... + rest.cols()));
+  size_t c = 0;
+  for (const Matrix<T>* piece : {&first, &rest...}) {
+    out.set_block(0, c, piece->view());
+    c += piece->cols();
+  }
+  return out;
+}
+
+/**
+ * @brief Stacks matrices on top of each other.
+ *
+ * The result is allocated once and each input is copied in with a single bulk copy.
+ *
+ * @throws std::invalid_argument If the matrices have different numbers of columns.
+ */
+template <typename T, typename... Rest>
+  requires (std::same_as<Rest, Matrix<T>> && ...)
+constexpr Matrix<T> vstack(const Matrix<T>& first, const Rest&... rest)
+{
+  if (((rest.cols() != first.cols()) || ...))
+    throw std::invalid_argument("Vertically stacked matrices must have the same number of columns.");
+
+  Matrix<T> out((first.rows() + ... + rest.rows()), first.cols());
+  size_t r = 0;
+  for (const Matrix<T>* piece : {&first, &rest...}) {
+    out.set_block(r, 0, piece->view());
+    r += piece->rows();
   }
+  return out;
+}
+
+/**
+ * @brief Builds the augmented matrix `[A | B]`.
+ *
+ * @throws std::invalid_argument If @p A and @p B have different numbers of rows.
+ *
+ * @see AugmentedView for a zero-copy alternative.
+ */
+template <typename T>
+constexpr Matrix<T> augment(const Matrix<T>& A, const Matrix<T>& B)
+{
+  return hstack(A, B);
+}
+
+/**
+ * @brief Builds the augmented matrix `[A | b]` for a column vector @p b.
+ *
+ * @throws std::invalid_argument If @p b.size() differs from @p A.rows().
+ */
+template <typename T>
+constexpr Matrix<T> augment(const Matrix<T>& A, std::span<const std::type_identity_t<T>> b)
+{
+  if (b.size() != A.rows())
+    throw std::invalid_argument("Vector must have the same number of rows as the matrix!");
+
+  Matrix<T> out(A.rows(), A.cols() + 1);
+  out.set_block(0, 0, A.view());
+  out.set_block(0, A.cols(), MatrixView<const T>(b.data(), b.size(), 1, 1));
+  return out;
+}
+
+// ==============================================================================
+// Product Chains
+// ==============================================================================
+
+namespace lin_alg::detail {
+
+/**
+ * @brief The cheapest parenthesization of a chain of matrix products.
+ *
+ * For matrix i of shape `dims[i] x dims[i + 1]`, the best product of matrices
+ * i..j splits into (i..k)(k + 1..j) with `k = split[i * count + j]`.
+ */
+struct ChainOrder {
+  /** Number of matrices in the chain. */
+  std::size_t count = 0;
+  /** Multiply-adds needed by the best parenthesization. */
+  std::size_t cost = 0;
+  /** Split points, indexed by `i * count + j` for i < j. */
+  std::vector<std::size_t> split;
+};
+
+/**
+ * @brief Finds the parenthesization of a product chain with the fewest scalar
+ * multiply-adds, by the classic O(count³) dynamic program over the shapes.
+ *
+ * @param dims The count + 1 shared dimensions of the chain.
+ */
+constexpr ChainOrder chain_order(std::span<const std::size_t> dims)
+{
+  const std::size_t count = dims.size() - 1;
+  ChainOrder order{count, 0, std::vector<std::size_t>(count * count)};
+  std::vector<std::size_t> cost(count * count);
+
+  for (std::size_t len = 2; len <= count; ++len) {
+    for (std::size_t i = 0; i + len <= count; ++i) {
+      const std::size_t j = i + len - 1;
+      std::size_t best = std::numeric_limits<std::size_t>::max();
+      for (std::size_t k = i; k < j; ++k) {
+        const std::size_t c = cost[i * count + k] + cost[(k + 1) * count + j]
+          + dims[i] * dims[k + 1] * dims[j + 1];
+        if (c < best) {
+          best = c;
+          order.split[i * count + j] = k;
+        }
+      }
+      cost[i * count + j] = best;
+    }
+  }
+  order.cost = cost[count - 1];
+  return order;
+}
+
+/** Multiplies out @p chain in the order chosen by chain_order(); see multi_multiply(). */
+template <typename T>
+constexpr Matrix<T> multiply_chain(std::span<const Matrix<T>* const> chain)
+{
+  std::vector<std::size_t> dims{chain[0]->rows()};
+  for (std::size_t i = 0; i < chain.size(); ++i) {
+    if (chain[i]->rows() != dims.back())
+      throw std::invalid_argument("Matrix sizes are mismatched!");
+    dims.push_back(chain[i]->cols());
+  }
+  if (chain.size() == 1) return *chain[0];
+
+  const ChainOrder order = chain_order(dims);
+
+  // Storage of consumed intermediates, handed to later products
+  std::vector<std::vector<T>> spare;
+  auto storage = [&](std::size_t size) {
+    if (spare.empty()) return std::vector<T>(size);
+    std::vector<T> v = std::move(spare.back());
+    spare.pop_back();
+    v.resize(size);
+    return v;
+  };
+
+  // Product of chain[i..j]; a lone matrix is read in place, never copied
+  auto product = [&](auto&& self, std::size_t i, std::size_t j) -> Matrix<T> {
+    const std::size_t k = order.split[i * order.count + j];
+    std::optional<Matrix<T>> left, right;
+    if (k > i) left = self(self, i, k);
+    if (k + 1 < j) right = self(self, k + 1, j);
+    const Matrix<T>& L = left ? *left : *chain[i];
+    const Matrix<T>& R = right ? *right : *chain[j];
+
+    Matrix<T> out(L.rows(), R.cols(), storage(L.rows() * R.cols()));
+    if (std::is_constant_evaluated())
+      gemm(L.rows(), R.cols(), L.cols(), L.data().data(), R.data().data(), out.data().data());
+    else
+      gemm_blocked(L.rows(), R.cols(), L.cols(), L.data().data(), R.data().data(), out.data().data());
+
+    if (left) spare.push_back(std::move(left->data()));
+    if (right) spare.push_back(std::move(right->data()));
+    return out;
+  };
+  return product(product, 0, chain.size() - 1);
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Computes the product `first * rest...` in the cheapest order.
+ *
+ * `operator*` chains evaluate left to right, which can cost orders of magnitude
+ * more than necessary for skewed shapes: `(1000x10)(10x1000)(1000x10)` takes
+ * 2·10⁷ multiply-adds left to right but 2·10⁵ as `A (B C)`. This function picks
+ * the optimal parenthesization from the shapes alone, then evaluates it, handing
+ * the storage of each consumed intermediate to the next product.
+ *
+ * @throws std::invalid_argument If adjacent shapes do not conform.
+ */
+template <typename T, typename... Rest>
+  requires (std::same_as<Rest, Matrix<T>> && ...)
+constexpr Matrix<T> multi_multiply(const Matrix<T>& first, const Rest&... rest)
+{
+  const Matrix<T>* chain[] = {&first, &rest...};
+  return lin_alg::detail::multiply_chain<T>(chain);
+}
+
+/**
+ * @brief Computes the product of @p chain, in order, with the cheapest
+ * parenthesization; see the variadic overload.
+ *
+ * @throws std::invalid_argument If @p chain is empty or adjacent shapes do not conform.
+ */
+template <typename T>
+constexpr Matrix<T> multi_multiply(const std::vector<Matrix<T>>& chain)
+{
+  if (chain.empty())
+    throw std::invalid_argument("Cannot multiply an empty chain of matrices.");
+
+  std::vector<const Matrix<T>*> pointers;
+  for (const Matrix<T>& m : chain) pointers.push_back(&m);
+  return lin_alg::detail::multiply_chain<T>(pointers);
 }
 
 #endif
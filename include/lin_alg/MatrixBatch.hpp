@@ -0,0 +1,280 @@
+#pragma once
+
+#ifndef WOJI_MATRIX_BATCH_HPP
+#define WOJI_MATRIX_BATCH_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file MatrixBatch.hpp
+ * @brief Many small matrices of one shape in a single allocation, multiplied
+ * together in one call.
+ *
+ * The batch is stored in the interleaved ("compact") layout: matrices are
+ * grouped into packs of lanes() consecutive indices, and within a pack the
+ * lanes() copies of each element sit next to each other. A batched product then
+ * runs the ordinary triple loop once per pack with a unit-stride innermost loop
+ * over the lanes, so it vectorizes across the batch regardless of how small
+ * the matrices are, and packs are spread across threads.
+ */
+
+namespace lin_alg::detail {
+
+/**
+ * @brief Number of matrices interleaved in one pack: one 64-byte vector register
+ * (or cache line) of elements for arithmetic types, 1 otherwise.
+ */
+template <typename T>
+inline constexpr std::size_t BATCH_LANES =
+    TriviallyRelocatableArithmetic<T> ? std::max<std::size_t>(1, 64 / sizeof(T)) : 1;
+
+/**
+ * @brief C = A * B for @p packs packs of lanes-interleaved @p m x @p k matrices
+ * A and @p k x @p n matrices B.
+ *
+ * Element (i, j) of lane l of pack p lives at `(p * rows * cols + i * cols + j) * L + l`
+ * with L = BATCH_LANES<T>. Packs are split across threads at run time.
+ *
+ * @note C must not alias A or B.
+ */
+template <typename T>
+void gemm_batched(std::size_t packs, std::size_t m, std::size_t n, std::size_t k, const T* A, const T* B, T* C)
+{
+  constexpr std::size_t L = BATCH_LANES<T>;
+  auto range = [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t p = lo; p < hi; ++p) {
+      const T* a = A + p * m * k * L;
+      const T* b = B + p * k * n * L;
+      T* c = C + p * m * n * L;
+      std::fill(c, c + m * n * L, T{});
+      for (std::size_t i = 0; i < m; ++i) {
+        T* row = c + i * n * L;
+        for (std::size_t q = 0; q < k; ++q) {
+          const T* aiq = a + (i * k + q) * L;
+          const T* bq = b + q * n * L;
+          for (std::size_t j = 0; j < n; ++j)
+            for (std::size_t l = 0; l < L; ++l)
+              row[j * L + l] += aiq[l] * bq[j * L + l];
+        }
+      }
+    }
+  };
+
+  const std::size_t work = std::max<std::size_t>(1, m * n * k * L);
+  parallel_for(0, packs, std::max<std::size_t>(1, ELEMENTWISE_GRAIN / work), range);
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief A fixed-size collection of same-shape matrices in interleaved storage.
+ *
+ * @tparam T Element type, as for Matrix.
+ *
+ * Individual matrices are addressed by index; they are not separate objects,
+ * so creating, copying and multiplying a batch costs one allocation and one
+ * shape check for the whole batch. The storage is padded to a whole number of
+ * packs and the padding is kept zero.
+ */
+template <typename T>
+class MatrixBatch {
+private:
+  std::size_t _count;
+  std::size_t _rows;
+  std::size_t _cols;
+
+  /** Interleaved storage; see lin_alg::detail::gemm_batched() for the layout. */
+  std::vector<T> _data;
+
+  std::size_t offset(std::size_t b, std::size_t r, std::size_t c) const noexcept
+  {
+    constexpr std::size_t L = lanes();
+    return ((b / L) * _rows * _cols + r * _cols + c) * L + b % L;
+  }
+
+  template <typename U>
+  friend void batch_multiply(const MatrixBatch<U>& A, const MatrixBatch<U>& B, MatrixBatch<U>& C);
+
+public:
+  using value_type = T;
+
+  // ==============================================================================
+  // Constructors
+  // ==============================================================================
+
+  /**
+   * @brief Constructs @p count matrices of size @p rows x @p cols, all zero.
+   *
+   * @throws std::invalid_argument If @p rows or @p cols is zero.
+   */
+  MatrixBatch(std::size_t count, std::size_t rows, std::size_t cols);
+
+  /**
+   * @brief Constructs a batch holding copies of @p matrices, in order.
+   *
+   * @throws std::invalid_argument If @p matrices is empty or the shapes differ.
+   */
+  explicit MatrixBatch(std::span<const Matrix<T>> matrices);
+
+  // ==============================================================================
+  // Accessors
+  // ==============================================================================
+
+  /** Returns the number of matrices in the batch. */
+  std::size_t size() const noexcept { return _count; }
+  /** Returns the number of rows of every matrix. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns of every matrix. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns the number of matrices interleaved in one pack. */
+  static constexpr std::size_t lanes() noexcept { return lin_alg::detail::BATCH_LANES<T>; }
+  /** Returns the interleaved storage, including padding. */
+  const std::vector<T>& data() const noexcept { return _data; }
+
+  /**
+   * @brief Returns a reference to element (r, c) of matrix @p b.
+   *
+   * @throws std::out_of_range If @p b, @p r or @p c is outside the valid range.
+   */
+  T& at(std::size_t b, std::size_t r, std::size_t c);
+
+  /** @overload */
+  const T& at(std::size_t b, std::size_t r, std::size_t c) const;
+
+  /**
+   * @brief Returns a copy of matrix @p b.
+   *
+   * @throws std::out_of_range If @p b >= size().
+   */
+  Matrix<T> matrix(std::size_t b) const;
+
+  /**
+   * @brief Overwrites matrix @p b with @p m.
+   *
+   * @throws std::out_of_range If @p b >= size().
+   * @throws std::invalid_argument If @p m does not have the batch's shape.
+   */
+  void set(std::size_t b, const Matrix<T>& m);
+
+  // ==============================================================================
+  // Arithmetic
+  // ==============================================================================
+
+  /**
+   * @brief Returns the batch whose matrix b is `matrix(b) * other.matrix(b)`.
+   *
+   * @throws std::invalid_argument If the batch sizes differ or the shapes are
+   * incompatible.
+   */
+  MatrixBatch<T> operator*(const MatrixBatch<T>& other) const;
+};
+
+/**
+ * @brief Computes `C.matrix(b) = A.matrix(b) * B.matrix(b)` for every b, reusing
+ * the storage of @p C.
+ *
+ * @throws std::invalid_argument If the batch sizes differ, the shapes of @p A and
+ * @p B are incompatible, or @p C is not A.rows() x B.cols().
+ *
+ * @note @p C must not be the same object as @p A or @p B.
+ */
+template <typename T>
+void batch_multiply(const MatrixBatch<T>& A, const MatrixBatch<T>& B, MatrixBatch<T>& C);
+
+// ==============================================================================
+// Definitions
+// ==============================================================================
+
+template <typename T>
+MatrixBatch<T>::MatrixBatch(std::size_t count, std::size_t rows, std::size_t cols)
+  : _count(count), _rows(rows), _cols(cols)
+{
+  if (rows == 0)
+    throw std::invalid_argument("Matrix must have at least one row.");
+  if (cols == 0)
+    throw std::invalid_argument("Matrix must have at least one column.");
+
+  const std::size_t packs = (count + lanes() - 1) / lanes();
+  _data.assign(packs * lanes() * rows * cols, T{});
+}
+
+template <typename T>
+MatrixBatch<T>::MatrixBatch(std::span<const Matrix<T>> matrices)
+  : MatrixBatch(matrices.size(), matrices.empty() ? 0 : matrices.front().rows(),
+        matrices.empty() ? 0 : matrices.front().cols())
+{
+  for (std::size_t b = 0; b < matrices.size(); ++b) set(b, matrices[b]);
+}
+
+template <typename T>
+T& MatrixBatch<T>::at(std::size_t b, std::size_t r, std::size_t c)
+{
+  if (b >= _count || r >= _rows || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  return _data[offset(b, r, c)];
+}
+
+template <typename T>
+const T& MatrixBatch<T>::at(std::size_t b, std::size_t r, std::size_t c) const
+{
+  if (b >= _count || r >= _rows || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  return _data[offset(b, r, c)];
+}
+
+template <typename T>
+Matrix<T> MatrixBatch<T>::matrix(std::size_t b) const
+{
+  if (b >= _count)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+
+  Matrix<T> m(_rows, _cols);
+  for (std::size_t r = 0; r < _rows; ++r)
+    for (std::size_t c = 0; c < _cols; ++c) m.data()[r * _cols + c] = _data[offset(b, r, c)];
+  return m;
+}
+
+template <typename T>
+void MatrixBatch<T>::set(std::size_t b, const Matrix<T>& m)
+{
+  if (b >= _count)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  if (m.rows() != _rows || m.cols() != _cols)
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+
+  for (std::size_t r = 0; r < _rows; ++r)
+    for (std::size_t c = 0; c < _cols; ++c) _data[offset(b, r, c)] = m.data()[r * _cols + c];
+}
+
+template <typename T>
+MatrixBatch<T> MatrixBatch<T>::operator*(const MatrixBatch<T>& other) const
+{
+  MatrixBatch<T> result(_count, _rows, other._cols);
+  batch_multiply(*this, other, result);
+  return result;
+}
+
+template <typename T>
+void batch_multiply(const MatrixBatch<T>& A, const MatrixBatch<T>& B, MatrixBatch<T>& C)
+{
+  if (A.size() != B.size() || A.cols() != B.rows())
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+  if (C.size() != A.size() || C.rows() != A.rows() || C.cols() != B.cols())
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+
+  const std::size_t packs = (A.size() + A.lanes() - 1) / A.lanes();
+  // Padding lanes are zero in A and B, so they stay zero in C
+  lin_alg::detail::gemm_batched(packs, A.rows(), B.cols(), A.cols(),
+      A._data.data(), B._data.data(), C._data.data());
+}
+
+#endif
@@ -0,0 +1,189 @@
+#pragma once
+
+#ifndef WOJI_MATRIX_BUILDER_HPP
+#define WOJI_MATRIX_BUILDER_HPP
+
+#include <lin_alg/Matrix.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Incrementally assembles a Matrix<T> from streamed rows and columns.
+ *
+ * @tparam T Element type stored in the matrix.
+ *
+ * Elements are kept row-major with a row stride (column capacity) that may
+ * exceed the current column count, inside a buffer whose row capacity may
+ * exceed the current row count. Both capacities grow geometrically, so
+ * appending rows, columns, or any mix of the two runs in amortized constant
+ * time per element. `build()` compacts the rows in place and moves the buffer
+ * into the resulting matrix without copying it.
+ *
+ * The first append fixes the other dimension: the first row fixes the column
+ * count, the first column fixes the row count.
+ */
+template <typename T>
+class MatrixBuilder {
+private:
+  /** Number of rows appended so far. */
+  std::size_t _rows = 0;
+
+  /** Number of columns appended so far. */
+  std::size_t _cols = 0;
+
+  /** Allocated columns per row; always at least `_cols`. */
+  std::size_t _stride = 0;
+
+  /** Allocated rows; always at least `_rows`. */
+  std::size_t _row_cap = 0;
+
+  /** Storage of `_row_cap * _stride` elements, row-major with stride `_stride`. */
+  std::vector<T> _data;
+
+  void grow_rows(std::size_t row_cap);
+  void grow_stride(std::size_t stride);
+
+public:
+  MatrixBuilder() = default;
+
+  /**
+   * @brief Preallocates room for a @p rows x @p cols matrix.
+   *
+   * @note Capacity never shrinks.
+   */
+  void reserve(std::size_t rows, std::size_t cols);
+
+  /** Returns the number of rows appended so far. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns appended so far. */
+  std::size_t cols() const noexcept { return _cols; }
+
+  /**
+   * @brief Appends a row to the bottom of the matrix.
+   *
+   * @param row The row's elements.
+   *
+   * @throws std::invalid_argument If @p row is empty or its size differs from cols().
+   */
+  void append_row(std::span<const T> row);
+
+  /**
+   * @brief Appends a column to the right of the matrix.
+   *
+   * @param column The column's elements, top to bottom.
+   *
+   * @throws std::invalid_argument If @p column is empty or its size differs from rows().
+   */
+  void append_column(std::span<const T> column);
+
+  /**
+   * @brief Moves the assembled elements into a new matrix and resets the builder.
+   *
+   * @return A rows() x cols() matrix that owns the builder's former buffer.
+   *
+   * @throws std::invalid_argument If nothing has been appended.
+   */
+  Matrix<T> build();
+};
+
+// ==============================================================================
+// Capacity Definitions
+// ==============================================================================
+
+template <typename T>
+void MatrixBuilder<T>::grow_rows(std::size_t row_cap)
+{
+  _data.resize(row_cap * _stride);
+  _row_cap = row_cap;
+}
+
+template <typename T>
+void MatrixBuilder<T>::grow_stride(std::size_t stride)
+{
+  std::vector<T> data(_row_cap * stride);
+  for (std::size_t r = 0; r < _rows; ++r)
+    std::move(_data.begin() + r * _stride, _data.begin() + r * _stride + _cols,
+        data.begin() + r * stride);
+  _data = std::move(data);
+  _stride = stride;
+}
+
+template <typename T>
+void MatrixBuilder<T>::reserve(std::size_t rows, std::size_t cols)
+{
+  if (cols > _stride) grow_stride(cols);
+  if (rows > _row_cap) grow_rows(rows);
+}
+
+// ==============================================================================
+// Append Definitions
+// ==============================================================================
+
+template <typename T>
+void MatrixBuilder<T>::append_row(std::span<const T> row)
+{
+  if (row.empty())
+    throw std::invalid_argument("Appended row cannot be empty.");
+  if (_rows == 0 && _cols == 0) {
+    _cols = row.size();
+    if (_cols > _stride) grow_stride(_cols);
+  } else if (row.size() != _cols) {
+    throw std::invalid_argument("Appended row must have the same number of columns as the matrix.");
+  }
+
+  if (_rows == _row_cap)
+    grow_rows(std::max<std::size_t>(4, 2 * _row_cap));
+
+  std::copy(row.begin(), row.end(), _data.begin() + _rows * _stride);
+  ++_rows;
+}
+
+template <typename T>
+void MatrixBuilder<T>::append_column(std::span<const T> column)
+{
+  if (column.empty())
+    throw std::invalid_argument("Appended column cannot be empty.");
+  if (_rows == 0 && _cols == 0) {
+    _rows = column.size();
+    if (_stride == 0) grow_stride(1);
+    if (_rows > _row_cap) grow_rows(_rows);
+  } else if (column.size() != _rows) {
+    throw std::invalid_argument("Appended column must have the same number of rows as the matrix.");
+  }
+
+  if (_cols == _stride)
+    grow_stride(std::max<std::size_t>(4, 2 * _stride));
+
+  for (std::size_t r = 0; r < _rows; ++r)
+    _data[r * _stride + _cols] = column[r];
+  ++_cols;
+}
+
+// ==============================================================================
+// Build Definition
+// ==============================================================================
+
+template <typename T>
+Matrix<T> MatrixBuilder<T>::build()
+{
+  if (_rows == 0 || _cols == 0)
+    throw std::invalid_argument("Matrix dimensions cannot be zero.");
+
+  // Close the gaps between rows; destinations never overlap later sources
+  if (_stride != _cols)
+    for (std::size_t r = 1; r < _rows; ++r)
+      std::move(_data.begin() + r * _stride, _data.begin() + r * _stride + _cols,
+          _data.begin() + r * _cols);
+  _data.resize(_rows * _cols);
+
+  Matrix<T> m(_rows, _cols, std::move(_data));
+  *this = MatrixBuilder<T>();
+  return m;
+}
+
+#endif
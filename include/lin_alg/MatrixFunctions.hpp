@@ -0,0 +1,380 @@
+#pragma once
+
+#ifndef WOJI_MATRIX_FUNCTIONS_HPP
+#define WOJI_MATRIX_FUNCTIONS_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/LU.hpp>
+#include <lin_alg/Matrix.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file MatrixFunctions.hpp
+ * @brief Functions of a square matrix: integer powers, polynomials and the
+ * exponential.
+ *
+ * Powers and polynomials work for any Ring element type (e.g. @c double,
+ * Rational or a modular integer); the exponential needs floating point. Every
+ * routine keeps the number of allocations fixed: products are written into
+ * preallocated buffers that are swapped rather than reallocated.
+ */
+
+namespace lin_alg::detail {
+
+/** Returns the n x n identity matrix. */
+template <typename T>
+constexpr Matrix<T> identity(std::size_t n)
+{
+  Matrix<T> I(n, n);
+  for (std::size_t i = 0; i < n; ++i) I.data()[i * n + i] = T{1};
+  return I;
+}
+
+/** Writes A B into @p C for square matrices of the same order, reusing C's storage. */
+template <typename T>
+constexpr void multiply_into(const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C)
+{
+  const std::size_t n = A.rows();
+  if (std::is_constant_evaluated())
+    gemm(n, n, n, A.data().data(), B.data().data(), C.data().data());
+  else
+    gemm_blocked(n, n, n, A.data().data(), B.data().data(), C.data().data());
+}
+
+/**
+ * @brief Largest 1-norms for which the [m/m] Padé approximant of exp has
+ * double-precision backward error, for m = 3, 5, 7, 9 and 13 (Higham, 2005).
+ */
+inline constexpr std::array<double, 5> PADE_THETA = {
+  1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1, 2.097847961257068e0, 5.371920351148152e0
+};
+
+/**
+ * @brief Pairs (m, θₘ) for expm_multiply(): the degree-m truncated Taylor series
+ * of exp(A / s) is accurate to double precision when `‖A‖₁ / s ≤ θₘ`
+ * (Al-Mohy and Higham, 2011).
+ */
+inline constexpr std::array<std::pair<std::size_t, double>, 11> TAYLOR_THETA = {{
+  {5, 2.4e-3}, {10, 1.4e-1}, {15, 6.4e-1}, {20, 1.4e0}, {25, 2.4e0}, {30, 3.5e0},
+  {35, 4.7e0}, {40, 6.0e0}, {45, 7.2e0}, {50, 8.5e0}, {55, 9.9e0}
+}};
+
+/** out = Σ c[i] terms[i] + c0 I over matrices of the same order, reusing out's storage. */
+template <typename T>
+void combine(Matrix<T>& out, const T& c0, std::initializer_list<std::pair<T, const Matrix<T>*>> terms)
+{
+  const std::size_t n = out.rows();
+  T* o = out.data().data();
+  std::fill(o, o + n * n, T{});
+  for (const auto& [c, M] : terms) axpy(n * n, c, M->data().data(), o);
+  for (std::size_t i = 0; i < n; ++i) o[i * n + i] += c0;
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Computes `Aᵏ` by exponentiation by squaring.
+ *
+ * @param A A square matrix.
+ * @param k The exponent; `A⁰` is the identity.
+ * @return The matrix power.
+ *
+ * @throws std::invalid_argument If @p A is not square.
+ *
+ * @note At most `2 log₂ k` products are formed, each written into one of two
+ * preallocated scratch buffers, so the cost is independent of allocation even
+ * for exponents near 10¹⁸.
+ */
+template <typename T>
+constexpr Matrix<T> pow(const Matrix<T>& A, std::uint64_t k)
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("Matrix power requires a square matrix.");
+
+  const std::size_t n = A.rows();
+  if (k == 0) return lin_alg::detail::identity<T>(n);
+
+  // result and base are the live values; scratch receives each product
+  Matrix<T> base(A), result(n, n), scratch(n, n);
+  bool first = true;
+  for (;;) {
+    if (k & 1) {
+      if (first) {
+        result = base;
+        first = false;
+      } else {
+        lin_alg::detail::multiply_into(result, base, scratch);
+        std::swap(result, scratch);
+      }
+    }
+    k >>= 1;
+    if (k == 0) break;
+    lin_alg::detail::multiply_into(base, base, scratch);
+    std::swap(base, scratch);
+  }
+  return result;
+}
+
+/**
+ * @brief Evaluates the matrix polynomial `c₀ I + c₁ A + ... + c_d Aᵈ`.
+ *
+ * @param coeffs Coefficients in increasing degree: `coeffs[i]` multiplies `Aⁱ`.
+ * @param A A square matrix.
+ * @return The value of the polynomial at @p A; zero if @p coeffs is empty.
+ *
+ * @throws std::invalid_argument If @p A is not square.
+ *
+ * @note Uses the Paterson–Stockmeyer scheme: with `s ≈ √d`, the powers
+ * `A² ... Aˢ` are formed once and the polynomial is evaluated by Horner's rule
+ * in `Aˢ`, with blocks of `s` coefficients as the Horner terms. That takes
+ * about `2√d` matrix products instead of the `d` Horner's rule needs; the
+ * remaining work is O(d n²) scaled additions.
+ */
+template <typename T>
+constexpr Matrix<T> polyval(std::span<const std::type_identity_t<T>> coeffs, const Matrix<T>& A)
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("Matrix polynomial requires a square matrix.");
+
+  const std::size_t n = A.rows();
+  Matrix<T> acc(n, n);
+  if (coeffs.empty()) return acc;
+
+  const std::size_t d = coeffs.size() - 1;
+  std::size_t s = 1;
+  while (s * s < d) ++s;
+
+  // powers[i] = A^(i + 1) for i < s
+  std::vector<Matrix<T>> powers;
+  powers.reserve(s);
+  powers.push_back(A);
+  for (std::size_t i = 1; i < s; ++i) {
+    powers.emplace_back(n, n);
+    lin_alg::detail::multiply_into(powers[i - 1], A, powers[i]);
+  }
+
+  // acc += sum of coeffs[j s + i] A^i over the block's coefficients
+  auto add_block = [&](std::size_t j) {
+    T* a = acc.data().data();
+    for (std::size_t i = 0; i < s && j * s + i <= d; ++i) {
+      const T& c = coeffs[j * s + i];
+      if (c == T{}) continue;
+      if (i == 0)
+        for (std::size_t r = 0; r < n; ++r) a[r * n + r] += c;
+      else
+        lin_alg::detail::axpy(n * n, c, powers[i - 1].data().data(), a);
+    }
+  };
+
+  // Horner's rule in A^s, one block of s coefficients per step
+  const Matrix<T>& As = powers[s - 1];
+  std::size_t j = d / s;
+  add_block(j);
+  if (j > 0) {
+    Matrix<T> scratch(n, n);
+    while (j-- > 0) {
+      lin_alg::detail::multiply_into(acc, As, scratch);
+      std::swap(acc, scratch);
+      add_block(j);
+    }
+  }
+  return acc;
+}
+
+/**
+ * @brief Computes the matrix exponential `exp(A)`.
+ *
+ * @param A A square matrix.
+ * @return The exponential of @p A.
+ *
+ * @throws std::invalid_argument If @p A is not square.
+ * @throws std::runtime_error If the Padé denominator is singular, which only
+ * happens for non-finite input.
+ *
+ * @note Uses Higham's scaling and squaring algorithm: the smallest Padé degree
+ * m ∈ {3, 5, 7, 9, 13} whose error bound covers ‖A‖₁ is chosen, scaling A by
+ * 2⁻ˢ first if even degree 13 needs it. The approximant `q(A)⁻¹ p(A)` costs at
+ * most six products and one LU factorization reused for all n columns, and
+ * the s squarings alternate between two fixed buffers.
+ */
+template <std::floating_point T>
+Matrix<T> expm(const Matrix<T>& A)
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("Matrix exponential requires a square matrix.");
+
+  using lin_alg::detail::combine;
+  using lin_alg::detail::multiply_into;
+  using lin_alg::detail::PADE_THETA;
+
+  const std::size_t n = A.rows();
+  const T norm = A.norm_1();
+
+  // Degree and scaling from the 1-norm
+  std::size_t degree = 13;
+  int s = 0;
+  constexpr std::array<std::size_t, 4> low = {3, 5, 7, 9};
+  for (std::size_t i = 0; i < low.size(); ++i)
+    if (norm <= static_cast<T>(PADE_THETA[i])) {
+      degree = low[i];
+      break;
+    }
+  if (degree == 13 && norm > static_cast<T>(PADE_THETA[4]))
+    s = static_cast<int>(std::ceil(std::log2(norm / static_cast<T>(PADE_THETA[4]))));
+
+  Matrix<T> X(A);
+  if (s > 0) lin_alg::detail::scal(n * n, std::ldexp(T{1}, -s), X.data().data());
+
+  // Even powers of the scaled matrix, and U = X (odd part), V = even part
+  Matrix<T> A2(n, n), A4(n, n), A6(n, n), U(n, n), V(n, n), W(n, n);
+  multiply_into(X, X, A2);
+  if (degree >= 5) multiply_into(A2, A2, A4);
+  if (degree >= 7) multiply_into(A2, A4, A6);
+
+  if (degree == 13) {
+    constexpr std::array<double, 14> b = {
+      64764752532480000.0, 32382376266240000.0, 7771770303897600.0, 1187353796428800.0, 129060195264000.0,
+      10559470521600.0, 670442572800.0, 33522128640.0, 1323241920.0, 40840800.0, 960960.0, 16380.0, 182.0, 1.0
+    };
+    auto c = [&](std::size_t i) { return static_cast<T>(b[i]); };
+    // V serves as scratch for A6 (b13 A6 + b11 A4 + b9 A2) until U is formed
+    combine(W, T{}, {{c(13), &A6}, {c(11), &A4}, {c(9), &A2}});
+    multiply_into(A6, W, V);
+    combine(W, c(1), {{c(7), &A6}, {c(5), &A4}, {c(3), &A2}});
+    lin_alg::detail::axpy(n * n, T{1}, V.data().data(), W.data().data());
+    multiply_into(X, W, U);
+
+    combine(W, T{}, {{c(12), &A6}, {c(10), &A4}, {c(8), &A2}});
+    multiply_into(A6, W, V);
+    combine(W, c(0), {{c(6), &A6}, {c(4), &A4}, {c(2), &A2}});
+    lin_alg::detail::axpy(n * n, T{1}, W.data().data(), V.data().data());
+  } else {
+    constexpr std::array<std::array<double, 10>, 4> table = {{
+      {120.0, 60.0, 12.0, 1.0},
+      {30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0},
+      {17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0},
+      {17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0, 2162160.0, 110880.0, 3960.0, 90.0, 1.0}
+    }};
+    const auto& b = table[(degree - 3) / 2];
+    auto c = [&](std::size_t i) { return static_cast<T>(b[i]); };
+
+    // A8 only for degree 9, computed into the spare buffer
+    Matrix<T>& A8 = U;
+    if (degree == 9) multiply_into(A4, A4, A8);
+    const Matrix<T>* powers[] = {&A2, &A4, &A6, &A8};
+
+    T* w = W.data().data();
+    T* v = V.data().data();
+    combine(W, c(1), {});
+    combine(V, c(0), {});
+    for (std::size_t k = 1; 2 * k <= degree; ++k) {
+      lin_alg::detail::axpy(n * n, c(2 * k + 1), powers[k - 1]->data().data(), w);
+      lin_alg::detail::axpy(n * n, c(2 * k), powers[k - 1]->data().data(), v);
+    }
+    multiply_into(X, W, U);
+  }
+
+  // exp(X) ≈ (V - U)⁻¹ (V + U)
+  T* u = U.data().data();
+  T* v = V.data().data();
+  T* w = W.data().data();
+  for (std::size_t i = 0; i < n * n; ++i) {
+    w[i] = v[i] - u[i];
+    v[i] += u[i];
+  }
+  const LU<T> lu(W);
+  if (lu.singular())
+    throw std::runtime_error("Cannot solve with a singular matrix.");
+  X = lu.solve(V);
+
+  for (int i = 0; i < s; ++i) {
+    multiply_into(X, X, W);
+    std::swap(X, W);
+  }
+  return X;
+}
+
+/**
+ * @brief Computes `exp(A) v` without forming exp(A).
+ *
+ * @param A A square matrix.
+ * @param v A vector of size A.rows().
+ * @return The vector `exp(A) v`.
+ *
+ * @throws std::invalid_argument If @p A is not square or @p v has the wrong size.
+ *
+ * @note Uses the truncated Taylor method of Al-Mohy and Higham: after shifting
+ * A by its mean diagonal entry, exp(A / s) is applied s times as a degree-m
+ * Taylor polynomial, with (m, s) chosen to minimize the m s matrix-vector
+ * products from ‖A‖₁. Each term is one Matrix::apply(), and the series stops
+ * early once two consecutive terms are negligible. Memory is O(n) beyond a
+ * copy of A.
+ */
+template <std::floating_point T>
+std::vector<T> expm_multiply(const Matrix<T>& A, std::span<const std::type_identity_t<T>> v)
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("Matrix exponential requires a square matrix.");
+  if (v.size() != A.rows())
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  const std::size_t n = A.rows();
+  const T mu = A.trace() / static_cast<T>(n);
+  Matrix<T> B(A);
+  for (std::size_t i = 0; i < n; ++i) B.data()[i * n + i] -= mu;
+  const T norm = B.norm_1();
+
+  // Cheapest (m, s) with ‖B‖₁ / s ≤ θₘ
+  std::size_t degree = 0, steps = 1;
+  if (norm > T{}) {
+    std::size_t best = std::numeric_limits<std::size_t>::max();
+    for (const auto& [m, theta] : lin_alg::detail::TAYLOR_THETA) {
+      const auto s = std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(norm / static_cast<T>(theta))));
+      if (m * s < best) {
+        best = m * s;
+        degree = m;
+        steps = s;
+      }
+    }
+  }
+
+  auto inf_norm = [](const std::vector<T>& x) {
+    T r{};
+    for (const T& e : x) r = std::max(r, std::abs(e));
+    return r;
+  };
+
+  const T tol = std::numeric_limits<T>::epsilon() / 2;
+  const T eta = std::exp(mu / static_cast<T>(steps));
+  std::vector<T> F(v.begin(), v.end()), b(F), w(n);
+  for (std::size_t i = 0; i < steps; ++i) {
+    T c1 = inf_norm(b);
+    for (std::size_t j = 1; j <= degree; ++j) {
+      B.apply(b, w);
+      lin_alg::detail::scal(n, T{1} / static_cast<T>(steps * j), w.data());
+      std::swap(b, w);
+      const T c2 = inf_norm(b);
+      lin_alg::detail::axpy(n, T{1}, b.data(), F.data());
+      if (c1 + c2 <= tol * inf_norm(F)) break;
+      c1 = c2;
+    }
+    lin_alg::detail::scal(n, eta, F.data());
+    b = F;
+  }
+  return F;
+}
+
+#endif
@@ -0,0 +1,525 @@
+#pragma once
+
+#ifndef WOJI_MATRIX_MARKET_HPP
+#define WOJI_MATRIX_MARKET_HPP
+
+#include <lin_alg/MappedFile.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+#include <lin_alg/SparseMatrix.hpp>
+#include <lin_alg/TextParsing.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file MatrixMarket.hpp
+ * @brief Reading and writing of Matrix Market (.mtx) files.
+ *
+ * Supports the `coordinate` and `array` formats with `real`, `integer` and
+ * `pattern` fields, stored as `general`, `symmetric` or `skew-symmetric`.
+ * Files are memory-mapped and the body is split at line boundaries into chunks
+ * that are parsed concurrently with std::from_chars.
+ */
+
+// ==============================================================================
+// Header Description
+// ==============================================================================
+
+/** Storage format of a Matrix Market file. */
+enum class MatrixMarketFormat { Coordinate, Array };
+
+/** Value field of a Matrix Market file. */
+enum class MatrixMarketField { Real, Integer, Pattern };
+
+/** Symmetry structure of a Matrix Market file. */
+enum class MatrixMarketSymmetry { General, Symmetric, SkewSymmetric };
+
+/** Parsed banner and size line of a Matrix Market file. */
+struct MatrixMarketHeader {
+  MatrixMarketFormat format;
+  MatrixMarketField field;
+  MatrixMarketSymmetry symmetry;
+  std::size_t rows;
+  std::size_t cols;
+  /** Number of stored entries (for array files, the number of listed values). */
+  std::size_t entries;
+};
+
+namespace lin_alg::detail {
+
+/** Minimum number of body bytes handed to a single parsing thread. */
+inline constexpr std::size_t MM_MIN_CHUNK_BYTES = std::size_t{1} << 20;
+
+inline std::string lowercase(std::string_view s)
+{
+  std::string out(s);
+  std::transform(out.begin(), out.end(), out.begin(),
+      [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return out;
+}
+
+/** Reads the next whitespace-delimited word on the current line. */
+inline std::string_view next_word(const char*& p, const char* end)
+{
+  p = skip_blanks(p, end);
+  const char* start = p;
+  while (p != end && !is_blank(*p) && *p != '\n') ++p;
+  return {start, static_cast<std::size_t>(p - start)};
+}
+
+/** Returns true if the line at @p p holds no data (blank or a comment). */
+inline bool is_skippable_line(const char* p, const char* end)
+{
+  p = skip_blanks(p, end);
+  return p == end || *p == '\n' || *p == '%';
+}
+
+/** Throws unless only blanks remain on the line at @p p. */
+inline void expect_mm_line_end(const char* p, const char* end)
+{
+  p = skip_blanks(p, end);
+  if (p != end && *p != '\n')
+    throw std::runtime_error("Unexpected trailing data on a Matrix Market line.");
+}
+
+/**
+ * @brief Parses the banner, comments and size line.
+ *
+ * @param text Whole file contents.
+ * @param body Set to the first character after the size line.
+ */
+inline MatrixMarketHeader parse_mm_header(std::string_view text, const char*& body)
+{
+  const char* p = text.data();
+  const char* end = p + text.size();
+
+  if (lowercase(next_word(p, end)) != "%%matrixmarket")
+    throw std::runtime_error("Missing %%MatrixMarket banner.");
+  if (lowercase(next_word(p, end)) != "matrix")
+    throw std::runtime_error("Only Matrix Market 'matrix' objects are supported.");
+
+  MatrixMarketHeader h{};
+  const std::string format = lowercase(next_word(p, end));
+  if (format == "coordinate") h.format = MatrixMarketFormat::Coordinate;
+  else if (format == "array") h.format = MatrixMarketFormat::Array;
+  else throw std::runtime_error("Unknown Matrix Market format: " + format);
+
+  const std::string field = lowercase(next_word(p, end));
+  if (field == "real" || field == "double") h.field = MatrixMarketField::Real;
+  else if (field == "integer") h.field = MatrixMarketField::Integer;
+  else if (field == "pattern") h.field = MatrixMarketField::Pattern;
+  else throw std::runtime_error("Unsupported Matrix Market field: " + field);
+
+  const std::string symmetry = lowercase(next_word(p, end));
+  if (symmetry == "general") h.symmetry = MatrixMarketSymmetry::General;
+  else if (symmetry == "symmetric" || symmetry == "hermitian") h.symmetry = MatrixMarketSymmetry::Symmetric;
+  else if (symmetry == "skew-symmetric") h.symmetry = MatrixMarketSymmetry::SkewSymmetric;
+  else throw std::runtime_error("Unknown Matrix Market symmetry: " + symmetry);
+
+  if (h.format == MatrixMarketFormat::Array && h.field == MatrixMarketField::Pattern)
+    throw std::runtime_error("Matrix Market array files cannot use the pattern field.");
+
+  p = next_line(p, end);
+  while (p != end && is_skippable_line(p, end)) p = next_line(p, end);
+  if (p == end)
+    throw std::runtime_error("Missing Matrix Market size line.");
+
+  p = parse_number(skip_blanks(p, end), end, h.rows);
+  p = parse_number(skip_blanks(p, end), end, h.cols);
+  if (h.format == MatrixMarketFormat::Coordinate)
+    p = parse_number(skip_blanks(p, end), end, h.entries);
+  expect_mm_line_end(p, end);
+
+  if (h.rows == 0 || h.cols == 0)
+    throw std::invalid_argument("Matrix dimensions cannot be zero.");
+  if (h.symmetry != MatrixMarketSymmetry::General && h.rows != h.cols)
+    throw std::runtime_error("Symmetric Matrix Market files must be square.");
+
+  if (h.format == MatrixMarketFormat::Array) {
+    if (h.cols > std::numeric_limits<std::size_t>::max() / h.rows)
+      throw std::runtime_error("Matrix Market dimensions are too large.");
+    const std::size_t n = h.rows;
+    if (h.symmetry == MatrixMarketSymmetry::General) h.entries = h.rows * h.cols;
+    else if (h.symmetry == MatrixMarketSymmetry::Symmetric) h.entries = n * (n + 1) / 2;
+    else h.entries = n * (n - 1) / 2;
+  }
+
+  body = next_line(p, end);
+  return h;
+}
+
+/** Splits the body into line-aligned chunks sized for concurrent parsing. */
+inline std::vector<const char*> mm_chunks(const char* body, const char* end)
+{
+  const std::size_t bytes = static_cast<std::size_t>(end - body);
+  const std::size_t parts = std::clamp<std::size_t>(bytes / MM_MIN_CHUNK_BYTES, 1, hardware_threads());
+  return split_lines(body, end, parts);
+}
+
+/** Parses one value of the given field, or yields one for pattern files. */
+template <typename T>
+const char* parse_mm_value(const char* p, const char* end, MatrixMarketField field, T& out)
+{
+  if (field == MatrixMarketField::Pattern) {
+    out = T{1};
+    return p;
+  }
+  return parse_number(skip_blanks(p, end), end, out);
+}
+
+/** Rejects a real field read into an integral element type, which would truncate every value. */
+template <typename T>
+void check_mm_field(const MatrixMarketHeader& h)
+{
+  if (std::is_integral_v<T> && h.field == MatrixMarketField::Real)
+    throw std::runtime_error("Cannot read a real Matrix Market field into an integer matrix.");
+}
+
+/**
+ * @brief Parses the body of a coordinate file into entries, mirroring symmetric ones.
+ */
+template <typename T>
+std::vector<Triplet<T>> parse_mm_coordinate(const MatrixMarketHeader& h, const char* body, const char* end)
+{
+  check_mm_field<T>(h);
+  const auto bounds = mm_chunks(body, end);
+  const std::size_t chunks = bounds.size() - 1;
+  std::vector<std::vector<Triplet<T>>> parts(chunks);
+  std::vector<std::size_t> counts(chunks, 0);
+
+  parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) {
+      auto& out = parts[i];
+      out.reserve(static_cast<std::size_t>(bounds[i + 1] - bounds[i]) / 16);
+      const char* stop = bounds[i + 1];
+      for (const char* p = bounds[i]; p != stop; p = next_line(p, stop)) {
+        if (is_skippable_line(p, stop)) continue;
+
+        std::size_t r, c;
+        T v;
+        const char* q = parse_number(skip_blanks(p, stop), stop, r);
+        q = parse_number(skip_blanks(q, stop), stop, c);
+        expect_mm_line_end(parse_mm_value(q, stop, h.field, v), stop);
+        if (r == 0 || c == 0 || r > h.rows || c > h.cols)
+          throw std::out_of_range("Matrix Market entry outside of matrix dimensions.");
+
+        --r;
+        --c;
+        out.push_back({r, c, v});
+        ++counts[i];
+        if (r != c && h.symmetry == MatrixMarketSymmetry::Symmetric)
+          out.push_back({c, r, v});
+        else if (r != c && h.symmetry == MatrixMarketSymmetry::SkewSymmetric)
+          out.push_back({c, r, T{} - v});
+      }
+    }
+  });
+
+  std::size_t total = 0, stored = 0;
+  for (std::size_t i = 0; i < chunks; ++i) {
+    total += counts[i];
+    stored += parts[i].size();
+  }
+  if (total != h.entries)
+    throw std::runtime_error("Matrix Market entry count does not match size line.");
+
+  if (chunks == 1) return std::move(parts[0]);
+  std::vector<Triplet<T>> entries;
+  entries.reserve(stored);
+  for (auto& part : parts)
+    entries.insert(entries.end(), part.begin(), part.end());
+  return entries;
+}
+
+/** Maps the k-th listed value of an array file to its (row, col) position. */
+inline void mm_array_position(const MatrixMarketHeader& h, std::size_t k, std::size_t& r, std::size_t& c)
+{
+  if (h.symmetry == MatrixMarketSymmetry::General) {
+    r = k % h.rows;
+    c = k / h.rows;
+    return;
+  }
+  const std::size_t skip = h.symmetry == MatrixMarketSymmetry::SkewSymmetric ? 1 : 0;
+  c = 0;
+  while (k >= h.rows - c - skip) {
+    k -= h.rows - c - skip;
+    ++c;
+  }
+  r = c + skip + k;
+}
+
+/** Advances (r, c) to the next listed value of an array file (column-major). */
+inline void mm_array_advance(const MatrixMarketHeader& h, std::size_t& r, std::size_t& c)
+{
+  if (++r < h.rows) return;
+  ++c;
+  r = h.symmetry == MatrixMarketSymmetry::General ? 0
+    : h.symmetry == MatrixMarketSymmetry::Symmetric ? c : c + 1;
+}
+
+/**
+ * @brief Parses the body of an array file directly into a dense matrix.
+ */
+template <typename T>
+Matrix<T> parse_mm_array(const MatrixMarketHeader& h, const char* body, const char* end)
+{
+  check_mm_field<T>(h);
+  const auto bounds = mm_chunks(body, end);
+  const std::size_t chunks = bounds.size() - 1;
+
+  // Pass 1: count values per chunk so every chunk knows its first position
+  std::vector<std::size_t> offsets(chunks + 1, 0);
+  parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i)
+      for (const char* p = bounds[i]; p != bounds[i + 1]; p = next_line(p, bounds[i + 1]))
+        if (!is_skippable_line(p, bounds[i + 1])) ++offsets[i + 1];
+  });
+  for (std::size_t i = 0; i < chunks; ++i) offsets[i + 1] += offsets[i];
+  if (offsets[chunks] != h.entries)
+    throw std::runtime_error("Matrix Market value count does not match size line.");
+
+  // Pass 2: parse values straight into their final positions
+  Matrix<T> m(h.rows, h.cols);
+  T* out = m.data().data();
+  parallel_for(0, chunks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) {
+      if (offsets[i] == offsets[i + 1]) continue;
+      std::size_t r, c;
+      mm_array_position(h, offsets[i], r, c);
+      const char* stop = bounds[i + 1];
+      for (const char* p = bounds[i]; p != stop; p = next_line(p, stop)) {
+        if (is_skippable_line(p, stop)) continue;
+        T v;
+        expect_mm_line_end(parse_mm_value(p, stop, h.field, v), stop);
+        out[r * h.cols + c] = v;
+        if (h.symmetry == MatrixMarketSymmetry::Symmetric)
+          out[c * h.cols + r] = v;
+        else if (h.symmetry == MatrixMarketSymmetry::SkewSymmetric)
+          out[c * h.cols + r] = T{} - v;
+        mm_array_advance(h, r, c);
+      }
+    }
+  });
+  return m;
+}
+
+/** Buffered sink that formats numbers with std::to_chars. */
+class MmWriter {
+private:
+  std::ostream& _os;
+  std::string _buf;
+
+public:
+  explicit MmWriter(std::ostream& os) : _os(os) { _buf.reserve(1 << 20); }
+
+  void flush()
+  {
+    _os.write(_buf.data(), static_cast<std::streamsize>(_buf.size()));
+    _buf.clear();
+    if (!_os)
+      throw std::runtime_error("Failed to write Matrix Market stream.");
+  }
+
+  void put(std::string_view s) { _buf.append(s); }
+  void put(char c) { _buf.push_back(c); }
+
+  template <typename T>
+  void put_number(const T& value)
+  {
+    char tmp[64];
+    auto res = std::to_chars(tmp, tmp + sizeof(tmp), value);
+    _buf.append(tmp, res.ptr);
+    if (_buf.size() > (1 << 20) - 128) flush();
+  }
+};
+
+template <typename T>
+constexpr std::string_view mm_field_name()
+{
+  return std::is_integral_v<T> ? "integer" : "real";
+}
+
+} // namespace lin_alg::detail
+
+// ==============================================================================
+// Reading
+// ==============================================================================
+
+/**
+ * @brief Parses Matrix Market text into a dense matrix.
+ *
+ * @tparam T Arithmetic element type. Pattern entries become @c T{1}.
+ * @param text The complete contents of a .mtx file.
+ * @return A dense matrix; unlisted coordinate entries are zero and duplicate
+ * ones are summed, as in parse_matrix_market_sparse().
+ *
+ * @throws std::runtime_error If the text is malformed, uses unsupported features,
+ * or has a real field and T is integral.
+ * @throws std::out_of_range If a coordinate entry lies outside the matrix.
+ */
+template <typename T>
+Matrix<T> parse_matrix_market(std::string_view text)
+{
+  const char* body = nullptr;
+  const MatrixMarketHeader h = lin_alg::detail::parse_mm_header(text, body);
+  const char* end = text.data() + text.size();
+
+  if (h.format == MatrixMarketFormat::Array)
+    return lin_alg::detail::parse_mm_array<T>(h, body, end);
+
+  const auto entries = lin_alg::detail::parse_mm_coordinate<T>(h, body, end);
+  Matrix<T> m(h.rows, h.cols);
+  for (const auto& e : entries)
+    m.data()[e.row * h.cols + e.col] += e.value;
+  return m;
+}
+
+/**
+ * @brief Parses Matrix Market text into a sparse matrix.
+ *
+ * @tparam T Arithmetic element type. Pattern entries become @c T{1}.
+ * @param text The complete contents of a .mtx file.
+ * @return A CSR matrix. Duplicate coordinate entries are summed; for array
+ * files, only non-zero values are stored.
+ *
+ * @throws std::runtime_error If the text is malformed, uses unsupported features,
+ * or has a real field and T is integral.
+ * @throws std::out_of_range If a coordinate entry lies outside the matrix.
+ */
+template <typename T>
+SparseMatrix<T> parse_matrix_market_sparse(std::string_view text)
+{
+  const char* body = nullptr;
+  const MatrixMarketHeader h = lin_alg::detail::parse_mm_header(text, body);
+  const char* end = text.data() + text.size();
+
+  if (h.format == MatrixMarketFormat::Coordinate) {
+    const auto entries = lin_alg::detail::parse_mm_coordinate<T>(h, body, end);
+    return SparseMatrix<T>::from_triplets(h.rows, h.cols, entries);
+  }
+
+  const Matrix<T> dense = lin_alg::detail::parse_mm_array<T>(h, body, end);
+  std::vector<Triplet<T>> entries;
+  for (std::size_t r = 0; r < h.rows; ++r)
+    for (std::size_t c = 0; c < h.cols; ++c)
+      if (dense.data()[r * h.cols + c] != T{})
+        entries.push_back({r, c, dense.data()[r * h.cols + c]});
+  return SparseMatrix<T>::from_triplets(h.rows, h.cols, entries);
+}
+
+/**
+ * @brief Reads a Matrix Market file into a dense matrix.
+ *
+ * @see parse_matrix_market()
+ */
+template <typename T>
+Matrix<T> read_matrix_market(const std::filesystem::path& path)
+{
+  MappedFile file(path);
+  return parse_matrix_market<T>(file.view());
+}
+
+/**
+ * @brief Reads a Matrix Market file into a sparse matrix.
+ *
+ * @see parse_matrix_market_sparse()
+ */
+template <typename T>
+SparseMatrix<T> read_matrix_market_sparse(const std::filesystem::path& path)
+{
+  MappedFile file(path);
+  return parse_matrix_market_sparse<T>(file.view());
+}
+
+// ==============================================================================
+// Writing
+// ==============================================================================
+
+/**
+ * @brief Writes a dense matrix in Matrix Market `array general` format.
+ *
+ * Values are written in column-major order, as required by the format, using
+ * the shortest representation that round-trips.
+ *
+ * @throws std::runtime_error If the stream fails.
+ */
+template <typename T>
+void write_matrix_market(std::ostream& os, const Matrix<T>& m)
+{
+  static_assert(std::is_arithmetic_v<T>, "Matrix Market output requires an arithmetic type.");
+  lin_alg::detail::MmWriter out(os);
+  out.put("%%MatrixMarket matrix array ");
+  out.put(lin_alg::detail::mm_field_name<T>());
+  out.put(" general\n");
+  out.put_number(m.rows());
+  out.put(' ');
+  out.put_number(m.cols());
+  out.put('\n');
+
+  for (std::size_t c = 0; c < m.cols(); ++c)
+    for (std::size_t r = 0; r < m.rows(); ++r) {
+      out.put_number(m.data()[r * m.cols() + c]);
+      out.put('\n');
+    }
+  out.flush();
+}
+
+/**
+ * @brief Writes a sparse matrix in Matrix Market `coordinate general` format.
+ *
+ * @throws std::runtime_error If the stream fails.
+ */
+template <typename T>
+void write_matrix_market(std::ostream& os, const SparseMatrix<T>& m)
+{
+  static_assert(std::is_arithmetic_v<T>, "Matrix Market output requires an arithmetic type.");
+  lin_alg::detail::MmWriter out(os);
+  out.put("%%MatrixMarket matrix coordinate ");
+  out.put(lin_alg::detail::mm_field_name<T>());
+  out.put(" general\n");
+  out.put_number(m.rows());
+  out.put(' ');
+  out.put_number(m.cols());
+  out.put(' ');
+  out.put_number(m.nnz());
+  out.put('\n');
+
+  for (std::size_t r = 0; r < m.rows(); ++r)
+    for (std::size_t k = m.row_ptr()[r]; k < m.row_ptr()[r + 1]; ++k) {
+      out.put_number(r + 1);
+      out.put(' ');
+      out.put_number(m.col_idx()[k] + 1);
+      out.put(' ');
+      out.put_number(m.values()[k]);
+      out.put('\n');
+    }
+  out.flush();
+}
+
+/**
+ * @brief Writes a dense or sparse matrix to a Matrix Market file at @p path.
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+template <typename M>
+void write_matrix_market(const std::filesystem::path& path, const M& m)
+{
+  std::ofstream os(path, std::ios::binary);
+  if (!os)
+    throw std::runtime_error("Unable to open file: " + path.string());
+  write_matrix_market(os, m);
+}
+
+#endif
@@ -0,0 +1,344 @@
+#pragma once
+
+#ifndef WOJI_MATRIX_VIEW_HPP
+#define WOJI_MATRIX_VIEW_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+template <typename T>
+class Matrix;
+
+/**
+ * @brief A non-owning, row-major window onto a rectangular block of elements.
+ *
+ * @tparam T Element type; `const T` gives a read-only view.
+ *
+ * Rows of the block are `stride()` elements apart in memory, so a view can
+ * describe a sub-block of a larger matrix without copying it. Views are cheap to
+ * copy and do not keep the underlying storage alive; a view is invalidated by
+ * anything that reallocates its matrix.
+ */
+template <typename T>
+class MatrixView {
+private:
+  /** First element of the block. */
+  T* _data = nullptr;
+
+  /** Number of rows in the block. */
+  std::size_t _rows = 0;
+
+  /** Number of columns in the block. */
+  std::size_t _cols = 0;
+
+  /** Distance in elements between the starts of consecutive rows. */
+  std::size_t _stride = 0;
+
+public:
+  using value_type = std::remove_const_t<T>;
+
+  constexpr MatrixView() noexcept = default;
+
+  /**
+   * @brief Views @p rows x @p cols elements starting at @p data, with rows
+   * @p stride elements apart.
+   */
+  constexpr MatrixView(T* data, std::size_t rows, std::size_t cols, std::size_t stride) noexcept
+    : _data(data), _rows(rows), _cols(cols), _stride(stride) { }
+
+  /** Allows a mutable view to be passed wherever a read-only view is expected. */
+  constexpr operator MatrixView<const T>() const noexcept requires (!std::is_const_v<T>)
+  {
+    return MatrixView<const T>(_data, _rows, _cols, _stride);
+  }
+
+  /** Returns the number of rows. */
+  constexpr std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns. */
+  constexpr std::size_t cols() const noexcept { return _cols; }
+  /** Returns the distance in elements between consecutive rows. */
+  constexpr std::size_t stride() const noexcept { return _stride; }
+  /** Returns a pointer to the first element. */
+  constexpr T* data() const noexcept { return _data; }
+
+  /**
+   * @brief Returns a reference to the element at (r, c) of the block.
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  constexpr T& at(std::size_t r, std::size_t c) const
+  {
+    if (r >= _rows || c >= _cols)
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    return _data[r * _stride + c];
+  }
+
+  /**
+   * @brief Returns a span over row @p r of the block.
+   *
+   * @throws std::out_of_range If @p r is outside the valid range.
+   */
+  constexpr std::span<T> row_at(std::size_t r) const
+  {
+    if (r >= _rows)
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    return std::span<T>(_data + r * _stride, _cols);
+  }
+
+  /** Same as row_at(); allows @c view[i][j] access. */
+  constexpr std::span<T> operator[](std::size_t r) const { return row_at(r); }
+
+  /**
+   * @brief Returns the @p h x @p w sub-block whose top-left element is (r, c).
+   *
+   * @throws std::out_of_range If the sub-block does not fit inside this view.
+   */
+  constexpr MatrixView block(std::size_t r, std::size_t c, std::size_t h, std::size_t w) const
+  {
+    if (r > _rows || c > _cols || h > _rows - r || w > _cols - c)
+      throw std::out_of_range("Requested block outside of matrix dimensions.");
+    return MatrixView(_data + r * _stride + c, h, w, _stride);
+  }
+
+  /**
+   * @brief Copies @p src into this block, one bulk copy per row.
+   *
+   * @throws std::invalid_argument If @p src has different dimensions.
+   *
+   * @note @p src must not overlap this block.
+   */
+  constexpr void assign(MatrixView<const value_type> src) const requires (!std::is_const_v<T>)
+  {
+    if (src.rows() != _rows || src.cols() != _cols)
+      throw std::invalid_argument("Block sizes are mismatched!");
+    lin_alg::detail::copy_block(_rows, _cols, src.data(), src.stride(), _data, _stride);
+  }
+
+  /** Sets every element of the block to @p value. */
+  constexpr void fill(const value_type& value) const requires (!std::is_const_v<T>)
+  {
+    for (std::size_t r = 0; r < _rows; ++r)
+      std::fill_n(_data + r * _stride, _cols, value);
+  }
+
+  /** Copies the block into a new, contiguous matrix. */
+  constexpr Matrix<value_type> to_matrix() const
+  {
+    Matrix<value_type> m(_rows, _cols);
+    lin_alg::detail::copy_block(_rows, _cols, _data, _stride, m.data().data(), _cols);
+    return m;
+  }
+};
+
+/**
+ * @brief A zero-copy view of the augmented matrix `[A | B]`.
+ *
+ * @tparam T Element type.
+ *
+ * The two halves may live anywhere in memory; row operations are applied to
+ * both, so elimination routines such as rref_in_place() can reduce `[A | B]`
+ * without first materializing it.
+ */
+template <typename T>
+class AugmentedView {
+private:
+  MatrixView<T> _left;
+  MatrixView<T> _right;
+
+public:
+  /**
+   * @brief Views @p left and @p right side by side.
+   *
+   * @throws std::invalid_argument If the halves have different numbers of rows.
+   */
+  constexpr AugmentedView(MatrixView<T> left, MatrixView<T> right)
+    : _left(left), _right(right)
+  {
+    if (left.rows() != right.rows())
+      throw std::invalid_argument("Augmented blocks must have the same number of rows.");
+  }
+
+  /** Returns the left half, A. */
+  constexpr MatrixView<T> left() const noexcept { return _left; }
+  /** Returns the right half, B. */
+  constexpr MatrixView<T> right() const noexcept { return _right; }
+
+  /** Returns the number of rows. */
+  constexpr std::size_t rows() const noexcept { return _left.rows(); }
+  /** Returns the combined number of columns. */
+  constexpr std::size_t cols() const noexcept { return _left.cols() + _right.cols(); }
+
+  /**
+   * @brief Returns a reference to the element at (r, c) of `[A | B]`.
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  constexpr T& at(std::size_t r, std::size_t c) const
+  {
+    return c < _left.cols() ? _left.at(r, c) : _right.at(r, c - _left.cols());
+  }
+
+  /**
+   * @brief Swaps two rows of both halves.
+   *
+   * @throws std::out_of_range If either row is outside the valid range.
+   */
+  constexpr void swap_rows(std::size_t r1, std::size_t r2) const
+  {
+    if (r1 >= rows() || r2 >= rows())
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    for (MatrixView<T> half : {_left, _right})
+      std::swap_ranges(half.data() + r1 * half.stride(), half.data() + r1 * half.stride() + half.cols(),
+          half.data() + r2 * half.stride());
+  }
+
+  /**
+   * @brief Multiplies row @p r of both halves by @p scalar.
+   *
+   * @throws std::out_of_range If @p r is outside the valid range.
+   */
+  constexpr void scale_row(std::size_t r, const T& scalar) const
+  {
+    if (r >= rows())
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    for (MatrixView<T> half : {_left, _right})
+      lin_alg::detail::scal(half.cols(), scalar, half.data() + r * half.stride());
+  }
+
+  /**
+   * @brief Performs row[r2] += scalar * row[r1] on both halves.
+   *
+   * @throws std::out_of_range If @p r1 or @p r2 is outside the valid range.
+   */
+  constexpr void add_row(std::size_t r1, std::size_t r2, const T& scalar) const
+  {
+    if (r1 >= rows() || r2 >= rows())
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    for (MatrixView<T> half : {_left, _right})
+      lin_alg::detail::axpy(half.cols(), scalar,
+          half.data() + r1 * half.stride(), half.data() + r2 * half.stride());
+  }
+};
+
+/**
+ * @brief Row operations recorded while reducing a matrix to RREF.
+ *
+ * @see rref_in_place()
+ */
+template <typename T>
+struct EliminationResult {
+  /** Number of row swaps performed. */
+  std::size_t swaps = 0;
+  /** Product of the pivots each row was divided by. */
+  T scale_prod = T{1};
+  /** Column of each pivot, in row order. */
+  std::vector<std::size_t> pivots;
+  /** Number of pivots. */
+  std::size_t rank = 0;
+};
+
+/**
+ * @brief Reduces `[A | B]` to Reduced Row Echelon Form in place, pivoting only
+ * in A.
+ *
+ * This is the elimination routine behind Matrix::rref_stats(): with B set to a
+ * right-hand side it solves a system, and with B set to the identity it leaves
+ * the inverse of a nonsingular A in B. Nothing is copied; both halves are
+ * overwritten.
+ *
+ * @param aug The augmented matrix to reduce.
+ * @return The row swaps, scaling and pivots that were applied.
+ *
+ * @note Floating types (see ApproximateField) use partial pivoting and treat
+ * elements of A no larger than `epsilon * max(rows, cols) * max|a_ij|` as zero;
+ * other types pivot on the first nonzero element and compare exactly.
+ */
+template <typename T>
+constexpr EliminationResult<T> rref_in_place(AugmentedView<T> aug)
+{
+  const MatrixView<T> a = aug.left();
+  EliminationResult<T> res;
+
+  // Floating types treat anything this small as an exact zero
+  T tol{};
+  if constexpr (ApproximateField<T>)
+    tol = lin_alg::detail::elimination_tolerance<T>(a.rows(), a.cols(), a.data(), a.stride());
+
+  std::size_t c = 0;
+  for (std::size_t r = 0; r < a.rows(); ++r)
+  {
+    if (c >= a.cols()) break;
+
+    std::size_t i = r;
+    if constexpr (ApproximateField<T>)
+    {
+      // Partial pivoting: pick the largest magnitude in column[c]
+      using lin_alg::detail::magnitude;
+      for (std::size_t k = r + 1; k < a.rows(); ++k)
+        if (magnitude(a.at(k, c)) > magnitude(a.at(i, c))) i = k;
+
+      if (magnitude(a.at(i, c)) <= tol)
+      {
+        for (std::size_t k = r; k < a.rows(); ++k) a.at(k, c) = T{};
+        i = a.rows();
+      }
+    }
+    else
+    {
+      // Find a row `r` with non-zero in column[c]
+      while (i < a.rows() && a.at(i, c) == T{})
+        ++i;
+    }
+
+    // Move to next col if no pivot found
+    if (i == a.rows())
+    {
+      ++c;
+      --r; // redo row
+      continue;
+    }
+
+    // Swap pivot row up
+    if (i != r)
+    {
+      aug.swap_rows(i, r);
+      ++res.swaps;
+    }
+
+    const T pivot_val = a.at(r, c);
+    if (pivot_val != T{1}) {
+      aug.scale_row(r, T{1} / pivot_val);
+      res.scale_prod *= pivot_val;
+      if constexpr (ApproximateField<T>) a.at(r, c) = T{1};
+    }
+
+    res.pivots.push_back(c);
+
+    // Eliminate column in other rows
+    for (std::size_t row_idx = 0; row_idx < a.rows(); ++row_idx)
+    {
+      if (row_idx == r) continue;
+      const T f = a.at(row_idx, c);
+      if (f != T{})
+      {
+        aug.add_row(r, row_idx, -f);
+        if constexpr (ApproximateField<T>) a.at(row_idx, c) = T{};
+      }
+    }
+
+    // Now move on to next column
+    ++c;
+  }
+
+  res.rank = res.pivots.size();
+  return res;
+}
+
+#endif
@@ -0,0 +1,726 @@
+#pragma once
+
+#ifndef WOJI_NPY_HPP
+#define WOJI_NPY_HPP
+
+#include <lin_alg/MappedFile.hpp>
+#include <lin_alg/Matrix.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file Npy.hpp
+ * @brief Reading and writing of NumPy `.npy` files and uncompressed `.npz` archives.
+ *
+ * Supported dtypes are float32, float64, int32 and int64 in either byte order,
+ * with C or Fortran element order. One-dimensional arrays load as column vectors.
+ *
+ * Files are memory-mapped. `NpyView` exposes the mapped data without any copy
+ * when the stored dtype, byte order and element order already match the
+ * requested type. `load_npy()` always returns an owning Matrix<T>: a single
+ * bulk copy when the layout matches, and a converting (and, for Fortran order,
+ * transposing) copy otherwise.
+ */
+
+/** Element type of a NumPy array, as recorded in its `descr` field. */
+enum class NpyDtype { Float32, Float64, Int32, Int64 };
+
+/** Parsed header of a `.npy` array. */
+struct NpyHeader {
+  NpyDtype dtype;
+  /** True if the stored data is little-endian. */
+  bool little_endian;
+  /** True if elements are stored column-major. */
+  bool fortran_order;
+  std::size_t rows;
+  std::size_t cols;
+  /** Offset of the first data byte from the start of the array. */
+  std::size_t data_offset;
+};
+
+namespace lin_alg::detail {
+
+inline constexpr std::string_view NPY_MAGIC = "\x93NUMPY";
+
+inline std::size_t npy_dtype_size(NpyDtype d)
+{
+  return d == NpyDtype::Float32 || d == NpyDtype::Int32 ? 4 : 8;
+}
+
+template <typename T>
+constexpr NpyDtype npy_dtype_of()
+{
+  if constexpr (std::is_same_v<T, float>) return NpyDtype::Float32;
+  else if constexpr (std::is_same_v<T, double>) return NpyDtype::Float64;
+  else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) == 4) return NpyDtype::Int32;
+  else if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) == 8) return NpyDtype::Int64;
+  else static_assert(sizeof(T) == 0, "NumPy I/O supports float, double, int32 and int64 elements.");
+}
+
+inline std::string_view npy_descr(NpyDtype d)
+{
+  constexpr bool little = std::endian::native == std::endian::little;
+  switch (d) {
+    case NpyDtype::Float32: return little ? "<f4" : ">f4";
+    case NpyDtype::Float64: return little ? "<f8" : ">f8";
+    case NpyDtype::Int32: return little ? "<i4" : ">i4";
+    default: return little ? "<i8" : ">i8";
+  }
+}
+
+/** Returns the text following `'key':` in a header dictionary. */
+inline std::string_view npy_dict_value(std::string_view dict, std::string_view key)
+{
+  for (char quote : {'\'', '"'}) {
+    const std::string needle = std::string(1, quote) + std::string(key) + quote;
+    auto pos = dict.find(needle);
+    if (pos == std::string_view::npos) continue;
+    pos = dict.find(':', pos + needle.size());
+    if (pos == std::string_view::npos) break;
+    pos = dict.find_first_not_of(" \t", pos + 1);
+    if (pos == std::string_view::npos) break;
+    return dict.substr(pos);
+  }
+  throw std::runtime_error("NumPy header is missing '" + std::string(key) + "'.");
+}
+
+/** Parses the magic string and header dictionary of an array starting at @p p. */
+inline NpyHeader parse_npy_header(const char* p, std::size_t size)
+{
+  if (size < 10 || std::string_view(p, 6) != NPY_MAGIC)
+    throw std::runtime_error("Not a NumPy .npy array.");
+
+  const auto* u = reinterpret_cast<const unsigned char*>(p);
+  const unsigned major = u[6];
+  std::size_t header_len, prefix;
+  if (major == 1) {
+    header_len = u[8] | (std::size_t{u[9]} << 8);
+    prefix = 10;
+  } else if (major == 2 || major == 3) {
+    if (size < 12) throw std::runtime_error("Truncated NumPy header.");
+    header_len = u[8] | (std::size_t{u[9]} << 8) | (std::size_t{u[10]} << 16) | (std::size_t{u[11]} << 24);
+    prefix = 12;
+  } else {
+    throw std::runtime_error("Unsupported NumPy format version.");
+  }
+  if (prefix + header_len > size)
+    throw std::runtime_error("Truncated NumPy header.");
+
+  const std::string_view dict(p + prefix, header_len);
+  NpyHeader h{};
+  h.data_offset = prefix + header_len;
+
+  // descr, e.g. '<f8'
+  const std::string_view descr_raw = npy_dict_value(dict, "descr");
+  const char q = descr_raw.empty() ? '\0' : descr_raw[0];
+  const auto close = descr_raw.find(q, 1);
+  if ((q != '\'' && q != '"') || close == std::string_view::npos)
+    throw std::runtime_error("Malformed NumPy dtype.");
+  std::string_view descr = descr_raw.substr(1, close - 1);
+
+  h.little_endian = std::endian::native == std::endian::little;
+  if (!descr.empty() && (descr[0] == '<' || descr[0] == '>' || descr[0] == '=' || descr[0] == '|')) {
+    if (descr[0] == '<') h.little_endian = true;
+    else if (descr[0] == '>') h.little_endian = false;
+    descr.remove_prefix(1);
+  }
+  if (descr == "f4") h.dtype = NpyDtype::Float32;
+  else if (descr == "f8") h.dtype = NpyDtype::Float64;
+  else if (descr == "i4") h.dtype = NpyDtype::Int32;
+  else if (descr == "i8") h.dtype = NpyDtype::Int64;
+  else throw std::runtime_error("Unsupported NumPy dtype: " + std::string(descr));
+
+  h.fortran_order = npy_dict_value(dict, "fortran_order").starts_with("True");
+
+  // shape, e.g. (3, 4) or (5,) or ()
+  std::string_view shape = npy_dict_value(dict, "shape");
+  if (shape.empty() || shape[0] != '(')
+    throw std::runtime_error("Malformed NumPy shape.");
+  shape = shape.substr(1, shape.find(')') - 1);
+  std::vector<std::size_t> dims;
+  for (std::size_t i = 0; i < shape.size();) {
+    while (i < shape.size() && (shape[i] == ' ' || shape[i] == ',')) ++i;
+    if (i == shape.size()) break;
+    std::size_t v = 0;
+    auto [ptr, ec] = std::from_chars(shape.data() + i, shape.data() + shape.size(), v);
+    if (ec != std::errc{})
+      throw std::runtime_error("Malformed NumPy shape.");
+    dims.push_back(v);
+    i = static_cast<std::size_t>(ptr - shape.data());
+  }
+  if (dims.size() > 2)
+    throw std::runtime_error("Only NumPy arrays with at most two dimensions can be loaded as a matrix.");
+  h.rows = dims.empty() ? 1 : dims[0];
+  h.cols = dims.size() < 2 ? 1 : dims[1];
+  if (h.rows == 0 || h.cols == 0)
+    throw std::invalid_argument("Matrix dimensions cannot be zero.");
+
+  // rows * cols * element must be representable before anything multiplies it out
+  const std::size_t element = npy_dtype_size(h.dtype);
+  if (h.cols > std::numeric_limits<std::size_t>::max() / element / h.rows)
+    throw std::runtime_error("NumPy shape is too large.");
+  if (h.rows * h.cols * element > size - h.data_offset)
+    throw std::runtime_error("Truncated NumPy data.");
+  return h;
+}
+
+/** Builds the complete `.npy` header (magic, version, dictionary) for a matrix. */
+inline std::string make_npy_header(NpyDtype dtype, std::size_t rows, std::size_t cols)
+{
+  std::string dict = "{'descr': '" + std::string(npy_descr(dtype)) +
+      "', 'fortran_order': False, 'shape': (" + std::to_string(rows) + ", " +
+      std::to_string(cols) + "), }";
+  // Pad with spaces so the data starts on a 64 byte boundary
+  const std::size_t total = 10 + dict.size() + 1;
+  dict.append((64 - total % 64) % 64, ' ');
+  dict.push_back('\n');
+
+  std::string header(NPY_MAGIC);
+  header.push_back('\x01');
+  header.push_back('\x00');
+  header.push_back(static_cast<char>(dict.size() & 0xFF));
+  header.push_back(static_cast<char>(dict.size() >> 8));
+  return header + dict;
+}
+
+template <typename S>
+S npy_load_element(const unsigned char* p, bool swap)
+{
+  std::array<unsigned char, sizeof(S)> bytes;
+  std::memcpy(bytes.data(), p, sizeof(S));
+  if (swap) std::reverse(bytes.begin(), bytes.end());
+  return std::bit_cast<S>(bytes);
+}
+
+/** Copies or converts an array payload into a row-major matrix of T. */
+template <typename T, typename S>
+void npy_convert(const NpyHeader& h, const char* data, T* out)
+{
+  const bool swap = h.little_endian != (std::endian::native == std::endian::little);
+  const auto* src = reinterpret_cast<const unsigned char*>(data);
+  const std::size_t n = h.rows * h.cols;
+
+  if constexpr (std::is_same_v<T, S>) {
+    if (!swap && !h.fortran_order) {
+      std::memcpy(out, data, n * sizeof(T));
+      return;
+    }
+  }
+
+  if (!h.fortran_order) {
+    for (std::size_t i = 0; i < n; ++i)
+      out[i] = static_cast<T>(npy_load_element<S>(src + i * sizeof(S), swap));
+    return;
+  }
+
+  // Column-major source: transpose in tiles to keep both sides cache friendly
+  constexpr std::size_t tile = 32;
+  for (std::size_t c0 = 0; c0 < h.cols; c0 += tile)
+    for (std::size_t r0 = 0; r0 < h.rows; r0 += tile)
+      for (std::size_t c = c0; c < std::min(c0 + tile, h.cols); ++c)
+        for (std::size_t r = r0; r < std::min(r0 + tile, h.rows); ++r)
+          out[r * h.cols + c] = static_cast<T>(npy_load_element<S>(src + (c * h.rows + r) * sizeof(S), swap));
+}
+
+/** Decodes the array starting at @p p into an owning matrix. */
+template <typename T>
+Matrix<T> npy_decode(const char* p, std::size_t size)
+{
+  static_assert(std::is_arithmetic_v<T>, "NumPy loading requires an arithmetic element type.");
+  const NpyHeader h = parse_npy_header(p, size);
+  Matrix<T> m(h.rows, h.cols);
+  const char* data = p + h.data_offset;
+  switch (h.dtype) {
+    case NpyDtype::Float32: npy_convert<T, float>(h, data, m.data().data()); break;
+    case NpyDtype::Float64: npy_convert<T, double>(h, data, m.data().data()); break;
+    case NpyDtype::Int32: npy_convert<T, std::int32_t>(h, data, m.data().data()); break;
+    case NpyDtype::Int64: npy_convert<T, std::int64_t>(h, data, m.data().data()); break;
+  }
+  return m;
+}
+
+/** Bitwise CRC-32 (IEEE 802.3) used by the zip container, table driven. */
+inline std::uint32_t crc32(const void* data, std::size_t n, std::uint32_t crc = 0)
+{
+  static const auto table = [] {
+    std::array<std::uint32_t, 256> t{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+      std::uint32_t c = i;
+      for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      t[i] = c;
+    }
+    return t;
+  }();
+  const auto* p = static_cast<const unsigned char*>(data);
+  crc = ~crc;
+  for (std::size_t i = 0; i < n; ++i)
+    crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+inline std::uint64_t zip_read(const char* p, std::size_t bytes)
+{
+  std::uint64_t v = 0;
+  for (std::size_t i = 0; i < bytes; ++i)
+    v |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+  return v;
+}
+
+inline void zip_write(std::string& out, std::uint64_t v, std::size_t bytes)
+{
+  for (std::size_t i = 0; i < bytes; ++i)
+    out.push_back(static_cast<char>(v >> (8 * i)));
+}
+
+} // namespace lin_alg::detail
+
+// ==============================================================================
+// Zero-Copy View
+// ==============================================================================
+
+/**
+ * @brief Read-only, zero-copy view of a memory-mapped NumPy array.
+ *
+ * @tparam T Element type; must match the stored dtype exactly.
+ *
+ * The view keeps the underlying mapping alive, so it remains valid after the
+ * archive or path it was opened from goes away.
+ */
+template <typename T>
+class NpyView {
+private:
+  std::shared_ptr<const MappedFile> _file;
+  const T* _data;
+  std::size_t _rows;
+  std::size_t _cols;
+
+public:
+  /**
+   * @brief Views the array stored at byte @p offset of @p file.
+   *
+   * @throws std::runtime_error If the stored dtype, byte order or element order
+   * differ from @p T in native row-major layout, or the data is misaligned.
+   */
+  NpyView(std::shared_ptr<const MappedFile> file, std::size_t offset, std::size_t size)
+    : _file(std::move(file))
+  {
+    const char* base = _file->data() + offset;
+    const NpyHeader h = lin_alg::detail::parse_npy_header(base, size);
+    if (h.dtype != lin_alg::detail::npy_dtype_of<T>() || h.fortran_order ||
+        h.little_endian != (std::endian::native == std::endian::little))
+      throw std::runtime_error("NumPy array layout does not match the requested view; use load_npy().");
+
+    const char* data = base + h.data_offset;
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0)
+      throw std::runtime_error("NumPy array data is misaligned for a zero-copy view; use load_npy().");
+
+    _data = reinterpret_cast<const T*>(data);
+    _rows = h.rows;
+    _cols = h.cols;
+  }
+
+  /** Maps the `.npy` file at @p path and views its contents. */
+  static NpyView<T> open(const std::filesystem::path& path)
+  {
+    auto file = std::make_shared<const MappedFile>(path);
+    const std::size_t size = file->size();
+    return NpyView<T>(std::move(file), 0, size);
+  }
+
+  /** Returns the number of rows. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns all elements in row-major order. */
+  std::span<const T> data() const noexcept { return {_data, _rows * _cols}; }
+
+  /**
+   * @brief Returns the specified row.
+   *
+   * @throws std::out_of_range If @p r is outside the valid range.
+   */
+  std::span<const T> row_at(std::size_t r) const
+  {
+    if (r >= _rows)
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    return {_data + r * _cols, _cols};
+  }
+
+  /** Copies the viewed data into an owning matrix. */
+  Matrix<T> to_matrix() const
+  {
+    Matrix<T> m(_rows, _cols);
+    std::memcpy(m.data().data(), _data, _rows * _cols * sizeof(T));
+    return m;
+  }
+};
+
+// ==============================================================================
+// .npy Files
+// ==============================================================================
+
+/**
+ * @brief Loads a `.npy` file into a matrix.
+ *
+ * @tparam T Arithmetic element type. Stored values are converted with
+ * `static_cast` when the dtype differs.
+ *
+ * @throws std::runtime_error If the file is malformed or uses an unsupported dtype.
+ */
+template <typename T>
+Matrix<T> load_npy(const std::filesystem::path& path)
+{
+  MappedFile file(path);
+  return lin_alg::detail::npy_decode<T>(file.data(), file.size());
+}
+
+/**
+ * @brief Writes @p m as a C-ordered `.npy` array to @p os.
+ *
+ * @throws std::runtime_error If the stream fails.
+ */
+template <typename T>
+void save_npy(std::ostream& os, const Matrix<T>& m)
+{
+  const std::string header = lin_alg::detail::make_npy_header(
+      lin_alg::detail::npy_dtype_of<T>(), m.rows(), m.cols());
+  os.write(header.data(), static_cast<std::streamsize>(header.size()));
+  os.write(reinterpret_cast<const char*>(m.data().data()),
+      static_cast<std::streamsize>(m.data().size() * sizeof(T)));
+  if (!os)
+    throw std::runtime_error("Failed to write NumPy array.");
+}
+
+/**
+ * @brief Writes @p m as a C-ordered `.npy` file at @p path.
+ *
+ * @throws std::runtime_error If the file cannot be written.
+ */
+template <typename T>
+void save_npy(const std::filesystem::path& path, const Matrix<T>& m)
+{
+  std::ofstream os(path, std::ios::binary);
+  if (!os)
+    throw std::runtime_error("Unable to open file: " + path.string());
+  save_npy(os, m);
+}
+
+// ==============================================================================
+// .npz Archives
+// ==============================================================================
+
+/**
+ * @brief Read access to an uncompressed (`numpy.savez`) `.npz` archive.
+ *
+ * The archive is memory-mapped once; arrays are located through the zip central
+ * directory (including ZIP64 records) and decoded in place.
+ */
+class NpzArchive {
+private:
+  struct Entry {
+    std::string name;
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  std::shared_ptr<const MappedFile> _file;
+  std::vector<Entry> _entries;
+
+  const Entry& find(std::string_view name) const
+  {
+    for (const auto& e : _entries)
+      if (e.name == name) return e;
+    throw std::out_of_range("Array '" + std::string(name) + "' not found in archive.");
+  }
+
+public:
+  /**
+   * @brief Maps @p path and reads its directory.
+   *
+   * @throws std::runtime_error If the file is not a zip archive or contains
+   * compressed members.
+   */
+  explicit NpzArchive(const std::filesystem::path& path)
+    : _file(std::make_shared<const MappedFile>(path))
+  {
+    using lin_alg::detail::zip_read;
+    const char* base = _file->data();
+    const std::size_t size = _file->size();
+
+    // Locate the end of central directory record
+    if (size < 22)
+      throw std::runtime_error("Not a zip archive.");
+    std::size_t eocd = size - 22;
+    while (zip_read(base + eocd, 4) != 0x06054b50) {
+      if (eocd == 0 || size - eocd > 22 + 0xFFFF)
+        throw std::runtime_error("Not a zip archive.");
+      --eocd;
+    }
+
+    std::uint64_t count = zip_read(base + eocd + 10, 2);
+    std::uint64_t dir = zip_read(base + eocd + 16, 4);
+    if ((count == 0xFFFF || dir == 0xFFFFFFFF) && eocd >= 20 &&
+        zip_read(base + eocd - 20, 4) == 0x07064b50) {
+      const std::uint64_t z64 = zip_read(base + eocd - 12, 8);
+      if (size < 56 || z64 > size - 56 || zip_read(base + z64, 4) != 0x06064b50)
+        throw std::runtime_error("Corrupt ZIP64 directory.");
+      count = zip_read(base + z64 + 32, 8);
+      dir = zip_read(base + z64 + 48, 8);
+    }
+
+    // Every offset below is checked against the bytes left after it, so a
+    // corrupt field cannot wrap an addition past the end of the mapping
+    if (dir > size)
+      throw std::runtime_error("Corrupt zip central directory.");
+    std::size_t p = dir;
+    for (std::uint64_t i = 0; i < count; ++i) {
+      if (size - p < 46 || zip_read(base + p, 4) != 0x02014b50)
+        throw std::runtime_error("Corrupt zip central directory.");
+
+      const auto method = zip_read(base + p + 10, 2);
+      std::uint64_t csize = zip_read(base + p + 20, 4);
+      std::uint64_t usize = zip_read(base + p + 24, 4);
+      const std::size_t name_len = zip_read(base + p + 28, 2);
+      const std::size_t extra_len = zip_read(base + p + 30, 2);
+      const std::size_t comment_len = zip_read(base + p + 32, 2);
+      std::uint64_t local = zip_read(base + p + 42, 4);
+      if (name_len + extra_len + comment_len > size - p - 46)
+        throw std::runtime_error("Corrupt zip central directory.");
+      std::string name(base + p + 46, name_len);
+
+      // ZIP64 extended information replaces saturated fields, in order
+      const std::size_t extra_end = p + 46 + name_len + extra_len;
+      for (std::size_t e = p + 46 + name_len; extra_end - e >= 4;) {
+        const auto id = zip_read(base + e, 2);
+        const std::size_t len = zip_read(base + e + 2, 2);
+        if (len > extra_end - e - 4)
+          throw std::runtime_error("Corrupt zip extra field: " + name);
+        if (id == 0x0001) {
+          std::size_t f = e + 4;
+          const std::size_t f_end = f + len;
+          auto next = [&](std::uint64_t& field) {
+            if (field != 0xFFFFFFFF) return;
+            if (f_end - f < 8)
+              throw std::runtime_error("Corrupt zip extra field: " + name);
+            field = zip_read(base + f, 8);
+            f += 8;
+          };
+          next(usize);
+          next(csize);
+          next(local);
+        }
+        e += 4 + len;
+      }
+
+      if (method != 0 || csize != usize)
+        throw std::runtime_error("Compressed .npz members are not supported: " + name);
+      if (size < 30 || local > size - 30 || zip_read(base + local, 4) != 0x04034b50)
+        throw std::runtime_error("Corrupt zip local header.");
+
+      const std::size_t local_extra = zip_read(base + local + 26, 2) + zip_read(base + local + 28, 2);
+      if (local_extra > size - local - 30 || usize > size - local - 30 - local_extra)
+        throw std::runtime_error("Truncated zip member: " + name);
+      const std::size_t data = local + 30 + local_extra;
+
+      if (name.ends_with(".npy")) name.resize(name.size() - 4);
+      _entries.push_back({std::move(name), data, static_cast<std::size_t>(usize)});
+      p += 46 + name_len + extra_len + comment_len;
+    }
+  }
+
+  /** Returns the names of the stored arrays, without the `.npy` suffix. */
+  std::vector<std::string> names() const
+  {
+    std::vector<std::string> out;
+    for (const auto& e : _entries) out.push_back(e.name);
+    return out;
+  }
+
+  /**
+   * @brief Decodes the named array into a matrix.
+   *
+   * @throws std::out_of_range If no array has that name.
+   */
+  template <typename T>
+  Matrix<T> load(std::string_view name) const
+  {
+    const Entry& e = find(name);
+    return lin_alg::detail::npy_decode<T>(_file->data() + e.offset, e.size);
+  }
+
+  /**
+   * @brief Returns a zero-copy view of the named array.
+   *
+   * @throws std::out_of_range If no array has that name.
+   * @throws std::runtime_error If the stored layout does not match @p T.
+   */
+  template <typename T>
+  NpyView<T> view(std::string_view name) const
+  {
+    const Entry& e = find(name);
+    return NpyView<T>(_file, e.offset, e.size);
+  }
+};
+
+/**
+ * @brief Writes named matrices into an uncompressed `.npz` archive.
+ *
+ * Each `add()` appends one stored (uncompressed) zip member whose data is
+ * 64 byte aligned; `close()` writes the central directory. Members larger than
+ * 4 GiB are not supported.
+ */
+class NpzWriter {
+private:
+  struct Entry {
+    std::string name;
+    std::uint32_t crc;
+    std::uint32_t size;
+    std::uint32_t offset;
+  };
+
+  std::ofstream _os;
+  std::vector<Entry> _entries;
+  std::uint64_t _pos = 0;
+  bool _closed = false;
+
+  void put(const std::string& bytes)
+  {
+    _os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    _pos += bytes.size();
+  }
+
+public:
+  /**
+   * @brief Creates (or truncates) the archive at @p path.
+   *
+   * @throws std::runtime_error If the file cannot be opened.
+   */
+  explicit NpzWriter(const std::filesystem::path& path) : _os(path, std::ios::binary)
+  {
+    if (!_os)
+      throw std::runtime_error("Unable to open file: " + path.string());
+  }
+
+  ~NpzWriter()
+  {
+    if (!_closed) {
+      try { close(); } catch (...) {}
+    }
+  }
+
+  /**
+   * @brief Appends @p m to the archive under @p name (stored as `name.npy`).
+   *
+   * @throws std::runtime_error If the archive would grow past 4 GiB (the limit of
+   * the 32-bit zip offsets written without ZIP64 records) or writing fails.
+   */
+  template <typename T>
+  void add(const std::string& name, const Matrix<T>& m)
+  {
+    using lin_alg::detail::zip_write;
+    const std::string header = lin_alg::detail::make_npy_header(
+        lin_alg::detail::npy_dtype_of<T>(), m.rows(), m.cols());
+    const std::uint64_t payload = m.data().size() * sizeof(T);
+    const std::uint64_t size = header.size() + payload;
+
+    std::uint32_t crc = lin_alg::detail::crc32(header.data(), header.size());
+    crc = lin_alg::detail::crc32(m.data().data(), payload, crc);
+
+    const std::string file_name = name + ".npy";
+
+    // Pad the extra field so the array data is 64 byte aligned within the file,
+    // which keeps members viewable through NpzArchive::view()
+    const std::size_t pad = (64 - (_pos + 30 + file_name.size() + 4) % 64) % 64;
+
+    std::string local;
+    zip_write(local, 0x04034b50, 4);
+    zip_write(local, 20, 2);            // version needed
+    zip_write(local, 0, 2);             // flags
+    zip_write(local, 0, 2);             // method: stored
+    zip_write(local, 0, 4);             // time, date
+    zip_write(local, crc, 4);
+    zip_write(local, size, 4);
+    zip_write(local, size, 4);
+    zip_write(local, file_name.size(), 2);
+    zip_write(local, 4 + pad, 2);       // extra length
+    local += file_name;
+    zip_write(local, 0xD935, 2);        // alignment padding block
+    zip_write(local, pad, 2);
+    local.append(pad, '\0');
+
+    // Every offset and size is stored in 32 bits, so the whole member must end below 4 GiB
+    if (size >= 0xFFFFFFFFull || _pos + local.size() + size >= 0xFFFFFFFFull)
+      throw std::runtime_error("Archives larger than 4 GiB are not supported.");
+
+    _entries.push_back({file_name, crc, static_cast<std::uint32_t>(size), static_cast<std::uint32_t>(_pos)});
+    put(local);
+    put(header);
+    _os.write(reinterpret_cast<const char*>(m.data().data()), static_cast<std::streamsize>(payload));
+    _pos += payload;
+    if (!_os)
+      throw std::runtime_error("Failed to write .npz archive.");
+  }
+
+  /**
+   * @brief Writes the central directory and closes the file.
+   *
+   * @throws std::runtime_error If writing fails.
+   */
+  void close()
+  {
+    using lin_alg::detail::zip_write;
+    _closed = true;
+    const std::uint64_t dir = _pos;
+    if (dir >= 0xFFFFFFFFull || _entries.size() >= 0xFFFF)
+      throw std::runtime_error("Archives larger than 4 GiB or with 65535 members are not supported.");
+    std::string central;
+    for (const auto& e : _entries) {
+      zip_write(central, 0x02014b50, 4);
+      zip_write(central, 20, 2);        // version made by
+      zip_write(central, 20, 2);        // version needed
+      zip_write(central, 0, 2);         // flags
+      zip_write(central, 0, 2);         // method: stored
+      zip_write(central, 0, 4);         // time, date
+      zip_write(central, e.crc, 4);
+      zip_write(central, e.size, 4);
+      zip_write(central, e.size, 4);
+      zip_write(central, e.name.size(), 2);
+      zip_write(central, 0, 2);         // extra length
+      zip_write(central, 0, 2);         // comment length
+      zip_write(central, 0, 2);         // disk number
+      zip_write(central, 0, 2);         // internal attributes
+      zip_write(central, 0, 4);         // external attributes
+      zip_write(central, e.offset, 4);
+      central += e.name;
+    }
+    zip_write(central, 0x06054b50, 4);
+    zip_write(central, 0, 4);           // disk numbers
+    zip_write(central, _entries.size(), 2);
+    zip_write(central, _entries.size(), 2);
+    zip_write(central, central.size() - 4 - 4 - 4, 4);
+    zip_write(central, dir, 4);
+    zip_write(central, 0, 2);           // comment length
+    put(central);
+    _os.close();
+    if (!_os)
+      throw std::runtime_error("Failed to write .npz archive.");
+  }
+};
+
+#endif
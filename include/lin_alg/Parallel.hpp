@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef WOJI_PARALLEL_HPP
+#define WOJI_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace lin_alg::detail {
+
+/** Returns the number of worker threads used by parallel kernels (at least 1). */
+inline std::size_t hardware_threads()
+{
+  static const std::size_t n = std::max(1u, std::thread::hardware_concurrency());
+  return n;
+}
+
+/**
+ * @brief Splits [begin, end) into contiguous blocks and runs them concurrently.
+ *
+ * @param begin First index of the range.
+ * @param end One past the last index of the range.
+ * @param grain Minimum number of indices per block. Ranges smaller than two
+ * grains run inline on the calling thread.
+ * @param f Callable invoked as `f(lo, hi)` once per block.
+ *
+ * @note Blocks are disjoint and cover the range exactly once. If any block throws,
+ * the first exception (in block order) is rethrown after all blocks have finished.
+ */
+template <typename F>
+void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F&& f)
+{
+  if (end <= begin) return;
+  const std::size_t n = end - begin;
+  grain = std::max<std::size_t>(grain, 1);
+
+  const std::size_t blocks = std::min(hardware_threads(), n / grain);
+  if (blocks <= 1) {
+    f(begin, end);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(blocks);
+  std::vector<std::thread> workers;
+  workers.reserve(blocks - 1);
+
+  auto run = [&](std::size_t b) {
+    const std::size_t lo = begin + n * b / blocks;
+    const std::size_t hi = begin + n * (b + 1) / blocks;
+    try {
+      f(lo, hi);
+    } catch (...) {
+      errors[b] = std::current_exception();
+    }
+  };
+
+  for (std::size_t b = 1; b < blocks; ++b)
+    workers.emplace_back(run, b);
+  run(0);
+  for (auto& w : workers) w.join();
+
+  for (auto& e : errors)
+    if (e) std::rethrow_exception(e);
+}
+
+} // namespace lin_alg::detail
+
+#endif
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef WOJI_RANDOM_HPP
+#define WOJI_RANDOM_HPP
+
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+
+/**
+ * @file Random.hpp
+ * @brief The counter-based generator behind every random start vector and
+ * sketch in the library.
+ *
+ * Draw i of stream s is a pure function of (s, i), so threads can fill
+ * disjoint ranges without shared state and results do not depend on the
+ * thread count or on the order in which values are requested.
+ */
+
+namespace lin_alg::detail {
+
+/** The 64 random bits at position @p counter of stream @p seed (SplitMix64 applied to a counter). */
+constexpr std::uint64_t counter_random(std::uint64_t seed, std::uint64_t counter)
+{
+  std::uint64_t z = seed * 0xD1B54A32D192ED03ull + (counter + 1) * 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+/** A uniform value in (0, 1] from counter_random(). */
+template <std::floating_point T>
+T counter_uniform(std::uint64_t seed, std::uint64_t counter)
+{
+  return static_cast<T>(static_cast<double>((counter_random(seed, counter) >> 11) + 1) * 0x1.0p-53);
+}
+
+/** A standard normal value from two counter_uniform() draws (Box–Muller). */
+template <std::floating_point T>
+T counter_normal(std::uint64_t seed, std::uint64_t counter)
+{
+  const T u = counter_uniform<T>(seed, 2 * counter), v = counter_uniform<T>(seed, 2 * counter + 1);
+  return std::sqrt(-2 * std::log(u)) * std::cos(2 * std::numbers::pi_v<T> * v);
+}
+
+} // namespace lin_alg::detail
+
+#endif
@@ -3,8 +3,10 @@
 #ifndef WOJI_RATIONAL_HPP
 #define WOJI_RATIONAL_HPP
 
+#include <charconv>
 #include <iostream>
 #include <stdexcept>
+#include <system_error>
 
 class Rational{
 private:
@@ -12,12 +14,18 @@ private:
   int _denominator;
 
   /**
-   * @brief Reduces the Rational to its simplest form.
+   * @brief Reduces the Rational to its simplest form, with a positive denominator.
    */
-  void reduce()
+  constexpr void reduce()
   {
-    int a = (_numerator > _denominator) ? _numerator : _denominator;
-    int b = (_numerator > _denominator) ? _denominator : _numerator;
+    if (_denominator < 0)
+    {
+      _numerator = -_numerator;
+      _denominator = -_denominator;
+    }
+
+    int a = _numerator < 0 ? -_numerator : _numerator;
+    int b = _denominator;
 
     while (b != 0)
     {
@@ -42,7 +50,7 @@ public:
    * @throws std::invalid_argument If @p denominator is zero.
    *
    */
-  Rational(int numerator, int denominator) : _numerator(numerator), _denominator(denominator) 
+  constexpr Rational(int numerator, int denominator) : _numerator(numerator), _denominator(denominator) 
   {
     if (denominator == 0)
       throw std::invalid_argument("Denominator cannot be zero!");
@@ -56,18 +64,19 @@ public:
    *
    * @param value Numerator
    */
-  Rational(int value) : _numerator(value), _denominator(1) 
+  constexpr Rational(int value) : _numerator(value), _denominator(1) 
   {
     reduce();
   }
 
-  Rational() : _numerator(0), _denominator(1) { }
+  constexpr Rational() : _numerator(0), _denominator(1) { }
 
   // ==============================================================================
   // Arithmetic
   // ==============================================================================
-  Rational operator-() const {
-    return Rational(_numerator, _denominator);
+  /** Returns the additive inverse of this rational. */
+  constexpr Rational operator-() const {
+    return Rational(-_numerator, _denominator);
   }
 
   /**
@@ -76,7 +85,7 @@ public:
    * @param other The rational to multiply with this rational.
    * @returns A new Rational containing the product of the two rationals.
    */
-  Rational operator*(const Rational& other) const;
+  constexpr Rational operator*(const Rational& other) const;
 
   /**
    * @brief Multiplies this rational by an integer and returns the result.
@@ -84,7 +93,7 @@ public:
    * @param other The integer to multiply with this ratinoal.
    * @returns A new Rational containing the product of this rational and the integer.
    */
-  Rational operator*(const int other) const;
+  constexpr Rational operator*(const int other) const;
 
   /**
    * @brief Multiplies this rational by another rational in place.
@@ -92,7 +101,7 @@ public:
    * @param other The rational to multiply with this rational.
    * @returns Reference to this rational after multiplication.
    */
-  Rational& operator*=(const Rational& other);
+  constexpr Rational& operator*=(const Rational& other);
 
   /**
    * @brief Multiplies this rational by an integer in place.
@@ -100,7 +109,7 @@ public:
    * @param other The integer to multiply with this rational.
    * @returns Reference to this rational after multiplication.
    */
-  Rational& operator*=(const int other);
+  constexpr Rational& operator*=(const int other);
 
   /**
    * @brief Divides this rational by another rational and returns the result.
@@ -111,7 +120,7 @@ public:
    *
    * @throws std::invalid_argument If result would have a denominator of zero.
    */
-  Rational operator/(const Rational& other) const;
+  constexpr Rational operator/(const Rational& other) const;
 
   /**
    * @brief Divides this rational by an integer and returns the result.
@@ -122,7 +131,7 @@ public:
    *
    * @throws std::invalid_argument If @p other is zero.
    */
-  Rational operator/(const int other) const;
+  constexpr Rational operator/(const int other) const;
 
   /**
    * @brief Divides this rational by another rational in place.
@@ -130,7 +139,7 @@ public:
    * @param other The rational to divide this rational by.
    * @returns Reference to this rational after division.
    */
-  Rational& operator/=(const Rational& other);
+  constexpr Rational& operator/=(const Rational& other);
 
   /**
    * @brief Divides this rational by an integer in place.
@@ -140,7 +149,7 @@ public:
    *
    * @throws std::invalid_argument If @p other is zero.
    */
-  Rational& operator/=(const int other);
+  constexpr Rational& operator/=(const int other);
 
   /**
    * @brief Adds this rational to another rational and returns the result.
@@ -148,7 +157,7 @@ public:
    * @param other The rational to add to this rational.
    * @return A new Rational representing the sum of the two rationals.
    */ 
-  Rational operator+(const Rational& other) const;
+  constexpr Rational operator+(const Rational& other) const;
 
   /**
    * @brief Adds an integer value to this rational and returns the result.
@@ -156,7 +165,7 @@ public:
    * @param other The integer to add to this rational.
    * @return A new rational representing the sum of the two rationals.
    */
-  Rational operator+(const int other) const;
+  constexpr Rational operator+(const int other) const;
 
   /**
    * @brief Adds another rational to this rational in place.
@@ -164,7 +173,7 @@ public:
    * @param other The rational to add to this rational.
    * @return Reference to this rational after addition.
    */
-  Rational& operator+=(const Rational& other);
+  constexpr Rational& operator+=(const Rational& other);
 
   /**
    * @brief Adds an integer to this rational in place.
@@ -172,7 +181,39 @@ public:
    * @param other The integer value to add to this rational.
    * @return Reference to this rational after addition.
    */
-  Rational& operator+=(const int other);
+  constexpr Rational& operator+=(const int other);
+
+  /**
+   * @brief Subtracts another rational from this rational and returns the result.
+   *
+   * @param other The rational to subtract from this rational.
+   * @return A new Rational representing the difference of the two rationals.
+   */
+  constexpr Rational operator-(const Rational& other) const;
+
+  /**
+   * @brief Subtracts an integer value from this rational and returns the result.
+   *
+   * @param other The integer to subtract from this rational.
+   * @return A new Rational representing the difference.
+   */
+  constexpr Rational operator-(const int other) const;
+
+  /**
+   * @brief Subtracts another rational from this rational in place.
+   *
+   * @param other The rational to subtract from this rational.
+   * @return Reference to this rational after subtraction.
+   */
+  constexpr Rational& operator-=(const Rational& other);
+
+  /**
+   * @brief Subtracts an integer from this rational in place.
+   *
+   * @param other The integer value to subtract from this rational.
+   * @return Reference to this rational after subtraction.
+   */
+  constexpr Rational& operator-=(const int other);
 
   // ==============================================================================
   // Operator Overloads
@@ -184,7 +225,7 @@ public:
    * @param other The rational to compare with this rational.
    * @returns True if both rationals are equal. False otherwise.
    */
-  bool operator==(const Rational& other) const;
+  constexpr bool operator==(const Rational& other) const;
 
   /**
    * @brief Checks whether this rational is not equal to another rational.
@@ -192,15 +233,15 @@ public:
    * @param other The rational to compare with this rational.
    * @returns True if both rationals are not equal. False otherwise.
    */
-  bool operator!=(const Rational& other) const;
+  constexpr bool operator!=(const Rational& other) const;
 
   // ==============================================================================
   // Accessors
   // ==============================================================================
-  int& numerator();
-  const int numerator() const;
-  int& denominator();
-  const int denominator() const;
+  constexpr int& numerator();
+  constexpr const int numerator() const;
+  constexpr int& denominator();
+  constexpr const int denominator() const;
 
   // ==============================================================================
   // Printing Utility
@@ -214,17 +255,17 @@ public:
 // ==============================================================================
 // Arithmetic
 // ==============================================================================
-inline Rational Rational::operator*(const Rational& other) const
+constexpr Rational Rational::operator*(const Rational& other) const
 {
   return Rational(_numerator * other._numerator, _denominator * other._denominator);
 }
 
-inline Rational Rational::operator*(const int other) const
+constexpr Rational Rational::operator*(const int other) const
 {
   return Rational(_numerator * other, _denominator);
 }
 
-inline Rational& Rational::operator*=(const Rational& other)
+constexpr Rational& Rational::operator*=(const Rational& other)
 {
   _numerator *= other._numerator;
   _denominator *= other._denominator;
@@ -232,14 +273,14 @@ inline Rational& Rational::operator*=(const Rational& other)
   return *this;
 }
 
-inline Rational& Rational::operator*=(const int other)
+constexpr Rational& Rational::operator*=(const int other)
 {
   _numerator *= other;
   reduce();
   return *this;
 }
 
-inline Rational Rational::operator/(const Rational& other) const
+constexpr Rational Rational::operator/(const Rational& other) const
 {
   if (other._numerator == 0)
     throw std::invalid_argument("Resulting rational would have a denominator of zero!");
@@ -247,7 +288,7 @@ inline Rational Rational::operator/(const Rational& other) const
   return Rational(_numerator * other._denominator, _denominator * other._numerator);
 }
 
-inline Rational Rational::operator/(const int other) const
+constexpr Rational Rational::operator/(const int other) const
 {
   if (other == 0)
     throw std::invalid_argument("Cannot divide by zero!");
@@ -255,7 +296,7 @@ inline Rational Rational::operator/(const int other) const
   return Rational(_numerator, _denominator * other);
 }
 
-inline Rational& Rational::operator/=(const Rational& other)
+constexpr Rational& Rational::operator/=(const Rational& other)
 {
   if (other._numerator == 0)
     throw std::invalid_argument("Resulting rational would have a denominator of zero!");
@@ -267,7 +308,7 @@ inline Rational& Rational::operator/=(const Rational& other)
   return *this;
 }
 
-inline Rational& Rational::operator/=(const int other)
+constexpr Rational& Rational::operator/=(const int other)
 {
   if (other == 0)
     throw std::invalid_argument("Cannot divide by zero!");
@@ -277,17 +318,17 @@ inline Rational& Rational::operator/=(const int other)
   return *this;
 }
 
-inline Rational Rational::operator+(const Rational& other) const
+constexpr Rational Rational::operator+(const Rational& other) const
 {
   return Rational(_numerator * other._denominator + other._numerator * _denominator, _denominator * other._denominator);
 }
 
-inline Rational Rational::operator+(const int other) const
+constexpr Rational Rational::operator+(const int other) const
 {
   return Rational(_numerator + other * _denominator, _denominator);
 }
 
-inline Rational& Rational::operator+=(const Rational& other)
+constexpr Rational& Rational::operator+=(const Rational& other)
 {
   _numerator = _numerator * other._denominator + other._numerator * _denominator;
   _denominator = _denominator * other._denominator;
@@ -295,22 +336,47 @@ inline Rational& Rational::operator+=(const Rational& other)
   return *this;
 }
 
-inline Rational& Rational::operator+=(const int other)
+constexpr Rational& Rational::operator+=(const int other)
 {
   _numerator += other * _denominator;
   reduce();
   return *this;
 }
 
+constexpr Rational Rational::operator-(const Rational& other) const
+{
+  return Rational(_numerator * other._denominator - other._numerator * _denominator, _denominator * other._denominator);
+}
+
+constexpr Rational Rational::operator-(const int other) const
+{
+  return Rational(_numerator - other * _denominator, _denominator);
+}
+
+constexpr Rational& Rational::operator-=(const Rational& other)
+{
+  _numerator = _numerator * other._denominator - other._numerator * _denominator;
+  _denominator = _denominator * other._denominator;
+  reduce();
+  return *this;
+}
+
+constexpr Rational& Rational::operator-=(const int other)
+{
+  _numerator -= other * _denominator;
+  reduce();
+  return *this;
+}
+
 // ==============================================================================
 // Operator Overloads
 // ==============================================================================
-inline bool Rational::operator==(const Rational& other) const
+constexpr bool Rational::operator==(const Rational& other) const
 {
   return _numerator == other._numerator && _denominator == other._denominator;
 }
 
-inline bool Rational::operator!=(const Rational& other) const
+constexpr bool Rational::operator!=(const Rational& other) const
 {
   return !(*this == other);
 }
@@ -318,23 +384,23 @@ inline bool Rational::operator!=(const Rational& other) const
 // ==============================================================================
 // Accessors
 // ==============================================================================
-inline int& Rational::numerator()
+constexpr int& Rational::numerator()
 {
   return _numerator;
 }
 
-inline const int Rational::numerator() const
+constexpr const int Rational::numerator() const
 {
   return _numerator;
 }
 
 
-inline int& Rational::denominator()
+constexpr int& Rational::denominator()
 {
   return _denominator;
 }
 
-inline const int Rational::denominator() const
+constexpr const int Rational::denominator() const
 {
   return _denominator;
 }
@@ -347,6 +413,24 @@ inline void Rational::print() const
   std::cout << numerator() << " / " << denominator() << std::endl;
 }
 
+/**
+ * @brief Writes @p r as `numerator/denominator` (or just the numerator if the
+ * denominator is 1) into [first, last), in the manner of std::to_chars.
+ *
+ * @return The end of the written text, or `std::errc::value_too_large` if the
+ * range is too small.
+ */
+inline std::to_chars_result to_chars(char* first, char* last, const Rational& r)
+{
+  auto res = std::to_chars(first, last, r.numerator());
+  if (res.ec != std::errc{} || r.denominator() == 1)
+    return res;
+  if (res.ptr == last)
+    return {last, std::errc::value_too_large};
+  *res.ptr = '/';
+  return std::to_chars(res.ptr + 1, last, r.denominator());
+}
+
 inline std::ostream& operator<<(std::ostream& os, const Rational& r)
 {
   if (r.denominator() == 1)
@@ -0,0 +1,291 @@
+#pragma once
+
+#ifndef WOJI_SVD_HPP
+#define WOJI_SVD_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file SVD.hpp
+ * @brief Singular value decomposition by one-sided Jacobi rotations, and the
+ * pseudo-inverse and minimum-norm least-squares solutions built on it.
+ *
+ * One-sided Jacobi orthogonalizes the columns of A directly with plane
+ * rotations, never forming AᵀA, so small singular values are found to high
+ * relative accuracy. Pairs are visited in round-robin (tournament) order: each
+ * round is a set of disjoint column pairs whose rotations are independent and
+ * run in parallel, and each rotation is a contiguous, vectorizable loop.
+ */
+
+namespace lin_alg::detail {
+
+/** Minimum number of vector elements rotated by one thread in a Jacobi round. */
+inline constexpr std::size_t JACOBI_GRAIN = std::size_t{1} << 15;
+
+/** Maximum number of Jacobi sweeps before the iteration is declared divergent. */
+inline constexpr std::size_t JACOBI_MAX_SWEEPS = 60;
+
+/**
+ * @brief Orthogonalizes the @p p rows of @p B (each of length @p len) by
+ * one-sided Jacobi rotations, applying the same rotations to the rows of the
+ * p x p matrix @p J.
+ *
+ * Rows rather than columns are rotated so that every rotation touches two
+ * contiguous vectors. On exit the rows of B are mutually orthogonal.
+ *
+ * @throws std::runtime_error If the sweeps fail to converge.
+ */
+template <std::floating_point T>
+void jacobi_orthogonalize(std::size_t p, std::size_t len, T* B, T* J)
+{
+  const T tol = std::numeric_limits<T>::epsilon() * std::sqrt(static_cast<T>(len));
+  const std::size_t players = p + (p & 1);
+  const std::size_t pairs = players / 2;
+  const std::size_t grain = std::max<std::size_t>(1, JACOBI_GRAIN / (len + p));
+
+  // Circle method: slot 0 stays fixed while the others rotate one place per round
+  std::vector<std::size_t> slot(players);
+  std::iota(slot.begin(), slot.end(), std::size_t{0});
+  std::vector<unsigned char> rotated(pairs);
+
+  for (std::size_t sweep = 0; sweep < JACOBI_MAX_SWEEPS; ++sweep) {
+    bool any = false;
+    for (std::size_t round = 0; round + 1 < players; ++round) {
+      parallel_for(0, pairs, grain, [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t t = lo; t < hi; ++t) {
+          rotated[t] = 0;
+          std::size_t i = slot[t], j = slot[players - 1 - t];
+          if (i >= p || j >= p) continue;
+          if (i > j) std::swap(i, j);
+
+          T* x = B + i * len;
+          T* y = B + j * len;
+          T alpha{}, beta{}, gamma{};
+          for (std::size_t r = 0; r < len; ++r) {
+            alpha += x[r] * x[r];
+            beta += y[r] * y[r];
+            gamma += x[r] * y[r];
+          }
+          if (alpha == T{} || beta == T{} || std::abs(gamma) <= tol * std::sqrt(alpha) * std::sqrt(beta))
+            continue;
+
+          // The smaller root of t² + 2ζt - 1 = 0 zeroes the inner product
+          const T zeta = (beta - alpha) / (2 * gamma);
+          const T tan = std::copysign(T{1}, zeta) / (std::abs(zeta) + std::hypot(T{1}, zeta));
+          const T c = T{1} / std::hypot(T{1}, tan), s = c * tan;
+          rot(len, c, s, x, y);
+          rot(p, c, s, J + i * p, J + j * p);
+          rotated[t] = 1;
+        }
+      });
+      any = any || std::find(rotated.begin(), rotated.end(), 1) != rotated.end();
+      std::rotate(slot.begin() + 1, slot.end() - 1, slot.end());
+    }
+    if (!any) return;
+  }
+  throw std::runtime_error("Singular value decomposition did not converge.");
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Thin singular value decomposition `A = U Σ Vᵀ` of a real m x n matrix.
+ *
+ * @tparam T A floating-point element type.
+ *
+ * With p = min(m, n), U is m x p and V is n x p, and the singular values are
+ * returned in descending order. Columns of U and V belonging to nonzero
+ * singular values are orthonormal; the columns of U for exactly zero singular
+ * values are zero. Every sweep costs about 6 m n² flops (for m ≥ n, and the
+ * transpose otherwise); well-conditioned matrices need 5–10 sweeps.
+ */
+template <std::floating_point T>
+class SVD {
+private:
+  std::vector<T> _values;
+  Matrix<T> _u;
+  Matrix<T> _v;
+
+  /** Columns kept by the given tolerance: the singular values strictly above it. */
+  std::size_t kept(std::optional<T> tol) const;
+
+public:
+  /**
+   * @brief Computes the decomposition of @p A.
+   *
+   * @throws std::runtime_error If the Jacobi sweeps fail to converge.
+   */
+  explicit SVD(const Matrix<T>& A);
+
+  /** Returns the singular values in descending order. */
+  const std::vector<T>& singular_values() const noexcept { return _values; }
+
+  /** Returns U, the left singular vectors as the columns of an m x p matrix. */
+  const Matrix<T>& left_singular_vectors() const noexcept { return _u; }
+
+  /** Returns V, the right singular vectors as the columns of an n x p matrix. */
+  const Matrix<T>& right_singular_vectors() const noexcept { return _v; }
+
+  /**
+   * @brief Returns the default cutoff `max(m, n) ε σ₀` below which singular
+   * values are treated as zero.
+   */
+  T tolerance() const noexcept
+  {
+    return static_cast<T>(std::max(_u.rows(), _v.rows())) * std::numeric_limits<T>::epsilon() * _values.front();
+  }
+
+  /** Returns the numerical rank: the number of singular values above @p tol (default tolerance()). */
+  std::size_t rank(std::optional<T> tol = std::nullopt) const { return kept(tol); }
+
+  /**
+   * @brief Returns the Moore–Penrose pseudo-inverse `V Σ⁺ Uᵀ`, an n x m matrix.
+   *
+   * @param tol Singular values at or below this are treated as zero (default tolerance()).
+   */
+  Matrix<T> pinv(std::optional<T> tol = std::nullopt) const;
+
+  /**
+   * @brief Returns the minimum-norm least-squares solution of `A x = b`.
+   *
+   * Among all x minimizing `‖A x - b‖`, this is the one of smallest norm; for
+   * a consistent underdetermined system it is the minimum-norm exact solution.
+   *
+   * @param b A vector of size m.
+   * @param tol Singular values at or below this are treated as zero (default tolerance()).
+   *
+   * @throws std::invalid_argument If @p b does not have m entries.
+   */
+  std::vector<T> solve(std::span<const T> b, std::optional<T> tol = std::nullopt) const;
+};
+
+template <std::floating_point T>
+SVD<T>::SVD(const Matrix<T>& A)
+  : _u(A.rows(), std::min(A.rows(), A.cols())), _v(A.cols(), std::min(A.rows(), A.cols()))
+{
+  const std::size_t m = A.rows(), n = A.cols();
+  const bool tall = m >= n;
+  const std::size_t p = std::min(m, n), len = std::max(m, n);
+
+  // B holds the columns of A (or of Aᵀ when A is wide) as rows
+  std::vector<T> B(p * len), J(p * p);
+  const T* a = A.data().data();
+  if (tall) {
+    for (std::size_t i = 0; i < m; ++i)
+      for (std::size_t j = 0; j < n; ++j) B[j * len + i] = a[i * n + j];
+  } else {
+    std::copy(a, a + m * n, B.begin());
+  }
+  for (std::size_t i = 0; i < p; ++i) J[i * p + i] = T{1};
+
+  lin_alg::detail::jacobi_orthogonalize(p, len, B.data(), J.data());
+
+  std::vector<T> norms(p);
+  for (std::size_t j = 0; j < p; ++j) norms[j] = std::sqrt(lin_alg::detail::dot(len, B.data() + j * len, B.data() + j * len));
+  std::vector<std::size_t> order(p);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return norms[x] > norms[y]; });
+
+  // The normalized rows of B are singular vectors on the long side, the rows of J on the short side
+  Matrix<T>& longside = tall ? _u : _v;
+  Matrix<T>& shortside = tall ? _v : _u;
+  T* l = longside.data().data();
+  T* s = shortside.data().data();
+  _values.resize(p);
+  for (std::size_t k = 0; k < p; ++k) {
+    const std::size_t j = order[k];
+    const T sigma = norms[j];
+    _values[k] = sigma;
+    if (sigma != T{})
+      for (std::size_t i = 0; i < len; ++i) l[i * p + k] = B[j * len + i] / sigma;
+    for (std::size_t i = 0; i < p; ++i) s[i * p + k] = J[j * p + i];
+  }
+}
+
+template <std::floating_point T>
+std::size_t SVD<T>::kept(std::optional<T> tol) const
+{
+  const T cutoff = tol.value_or(tolerance());
+  return static_cast<std::size_t>(std::count_if(_values.begin(), _values.end(), [cutoff](const T& s) { return s > cutoff; }));
+}
+
+template <std::floating_point T>
+Matrix<T> SVD<T>::pinv(std::optional<T> tol) const
+{
+  const std::size_t m = _u.rows(), n = _v.rows(), p = _values.size(), r = kept(tol);
+  Matrix<T> result(n, m);
+  if (r == 0) return result;
+
+  // (V_r Σ_r⁻¹) (U_r)ᵀ as one n x r by r x m product
+  std::vector<T> vs(n * r), ut(r * m);
+  const T* u = _u.data().data();
+  const T* v = _v.data().data();
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t k = 0; k < r; ++k) vs[i * r + k] = v[i * p + k] / _values[k];
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t k = 0; k < r; ++k) ut[k * m + i] = u[i * p + k];
+  lin_alg::detail::gemm_blocked(n, m, r, vs.data(), ut.data(), result.data().data());
+  return result;
+}
+
+template <std::floating_point T>
+std::vector<T> SVD<T>::solve(std::span<const T> b, std::optional<T> tol) const
+{
+  const std::size_t m = _u.rows(), n = _v.rows(), p = _values.size(), r = kept(tol);
+  if (b.size() != m)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  // c = Σ_r⁻¹ U_rᵀ b, then x = V_r c
+  std::vector<T> c(r, T{}), x(n, T{});
+  const T* u = _u.data().data();
+  for (std::size_t i = 0; i < m; ++i)
+    lin_alg::detail::axpy(r, b[i], u + i * p, c.data());
+  for (std::size_t k = 0; k < r; ++k) c[k] /= _values[k];
+  const T* v = _v.data().data();
+  for (std::size_t i = 0; i < n; ++i) x[i] = lin_alg::detail::dot(r, v + i * p, c.data());
+  return x;
+}
+
+/**
+ * @brief Returns the Moore–Penrose pseudo-inverse of @p A, with singular values
+ * at or below `max(m, n) ε σ₀` treated as zero.
+ *
+ * @throws std::runtime_error If the SVD fails to converge.
+ */
+template <std::floating_point T>
+Matrix<T> pinv(const Matrix<T>& A)
+{
+  return SVD<T>(A).pinv();
+}
+
+/**
+ * @brief Returns the minimum-norm least-squares solution of `A x = b`.
+ *
+ * Unlike Matrix::solution(), which sets free variables to zero, this picks the
+ * solution of smallest norm when A is rank deficient, and the best fit when the
+ * system is inconsistent.
+ *
+ * @throws std::invalid_argument If @p b does not have A.rows() entries.
+ * @throws std::runtime_error If the SVD fails to converge.
+ */
+template <std::floating_point T>
+std::vector<T> least_squares(const Matrix<T>& A, std::span<const std::type_identity_t<T>> b)
+{
+  return SVD<T>(A).solve(b);
+}
+
+#endif
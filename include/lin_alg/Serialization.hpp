@@ -0,0 +1,504 @@
+#pragma once
+
+#ifndef WOJI_SERIALIZATION_HPP
+#define WOJI_SERIALIZATION_HPP
+
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file Serialization.hpp
+ * @brief Versioned binary serialization of Matrix<T> over arbitrary streams.
+ *
+ * A serialized matrix consists of a fixed 40 byte header, the element payload in
+ * row-major order and an 8 byte trailer:
+ *
+ * | Offset | Size | Field                                              |
+ * |--------|------|----------------------------------------------------|
+ * | 0      | 4    | Magic bytes `LAMX`                                 |
+ * | 4      | 2    | Format version                                     |
+ * | 6      | 1    | Element type tag (see ElementType)                 |
+ * | 7      | 1    | Payload byte order (0 = little, 1 = big endian)    |
+ * | 8      | 4    | Size of one encoded element in bytes               |
+ * | 12     | 4    | Reserved, always zero                              |
+ * | 16     | 8    | Number of rows                                     |
+ * | 24     | 8    | Number of columns                                  |
+ * | 32     | 8    | Checksum of header bytes [0, 32)                   |
+ * | 40     | ...  | Payload, `rows * cols * element size` bytes        |
+ * | end    | 8    | Checksum of the payload bytes                      |
+ *
+ * Header fields are always little-endian. The payload is written in the native
+ * byte order of the writer and byte-swapped on read when necessary, so the common
+ * case is a straight memory copy. The payload checksum lives in a trailer so that
+ * a matrix can be written in a single pass without seeking.
+ */
+
+// ==============================================================================
+// Format Description
+// ==============================================================================
+
+/** Tag identifying the element type stored in a serialized matrix. */
+enum class ElementType : std::uint8_t {
+  Int8 = 1,
+  UInt8 = 2,
+  Int16 = 3,
+  UInt16 = 4,
+  Int32 = 5,
+  UInt32 = 6,
+  Int64 = 7,
+  UInt64 = 8,
+  Float32 = 9,
+  Float64 = 10,
+  Rational = 32
+};
+
+/** Current version of the binary matrix format. */
+inline constexpr std::uint16_t SERIALIZATION_VERSION = 1;
+
+/** Default number of payload bytes moved per stream read/write. */
+inline constexpr std::size_t SERIALIZATION_CHUNK_BYTES = std::size_t{1} << 20;
+
+namespace lin_alg::detail {
+
+inline constexpr std::array<char, 4> SERIALIZATION_MAGIC = {'L', 'A', 'M', 'X'};
+inline constexpr std::size_t SERIALIZATION_HEADER_BYTES = 40;
+
+/**
+ * @brief Streaming 64-bit checksum over a byte sequence.
+ *
+ * Consumes input as little-endian 64-bit words, so the result is independent
+ * of both the host byte order and of how the input is split across calls.
+ */
+class Checksum64 {
+private:
+  std::uint64_t _hash = 0x9E3779B97F4A7C15ull;
+  std::uint64_t _length = 0;
+  std::array<unsigned char, 8> _tail{};
+  std::size_t _pending = 0;
+
+  static std::uint64_t load_le(const unsigned char* p)
+  {
+    std::uint64_t w = 0;
+    for (std::size_t i = 0; i < 8; ++i)
+      w |= std::uint64_t{p[i]} << (8 * i);
+    return w;
+  }
+
+  void mix(std::uint64_t w)
+  {
+    _hash ^= w * 0xC2B2AE3D27D4EB4Full;
+    _hash = std::rotl(_hash, 31) * 0x9E3779B185EBCA87ull;
+  }
+
+public:
+  /** Feeds @p n bytes starting at @p data into the checksum. */
+  void update(const void* data, std::size_t n)
+  {
+    auto p = static_cast<const unsigned char*>(data);
+    _length += n;
+
+    while (n > 0 && _pending > 0) {
+      _tail[_pending++] = *p++;
+      --n;
+      if (_pending == 8) {
+        mix(load_le(_tail.data()));
+        _pending = 0;
+      }
+    }
+    for (; n >= 8; p += 8, n -= 8)
+      mix(load_le(p));
+    for (; n > 0; --n)
+      _tail[_pending++] = *p++;
+  }
+
+  /** Returns the checksum of all bytes fed so far. */
+  std::uint64_t value() const
+  {
+    Checksum64 c = *this;
+    if (c._pending > 0) {
+      std::fill(c._tail.begin() + c._pending, c._tail.end(), 0);
+      c.mix(load_le(c._tail.data()));
+    }
+    std::uint64_t h = c._hash ^ _length;
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    return h;
+  }
+};
+
+inline void store_le(unsigned char* p, std::uint64_t v, std::size_t bytes)
+{
+  for (std::size_t i = 0; i < bytes; ++i)
+    p[i] = static_cast<unsigned char>(v >> (8 * i));
+}
+
+inline std::uint64_t load_le(const unsigned char* p, std::size_t bytes)
+{
+  std::uint64_t v = 0;
+  for (std::size_t i = 0; i < bytes; ++i)
+    v |= std::uint64_t{p[i]} << (8 * i);
+  return v;
+}
+
+/** Reverses the byte order of every @p width byte element in [p, p + n * width). */
+inline void byteswap_elements(unsigned char* p, std::size_t n, std::size_t width)
+{
+  if (width == 1) return;
+  for (std::size_t i = 0; i < n; ++i, p += width)
+    std::reverse(p, p + width);
+}
+
+template <typename T>
+inline constexpr bool is_raw_serializable_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/**
+ * @brief Describes how a C++ element type is encoded in the binary format.
+ *
+ * Arithmetic types are stored as their raw object representation. Rational is
+ * stored as a packed pair of 32-bit integers (numerator, denominator). bool is
+ * excluded, since reading a byte other than 0 or 1 into one is undefined.
+ */
+template <typename T>
+struct SerialTraits {
+  static_assert(is_raw_serializable_v<T> && !std::is_same_v<T, long double>,
+      "Matrix serialization supports arithmetic types other than bool, and Rational.");
+
+  static constexpr std::size_t size = sizeof(T);
+  static constexpr std::size_t word = sizeof(T);
+
+  static constexpr ElementType tag()
+  {
+    if constexpr (std::is_floating_point_v<T>)
+      return sizeof(T) == 4 ? ElementType::Float32 : ElementType::Float64;
+    else if constexpr (sizeof(T) == 1)
+      return std::is_signed_v<T> ? ElementType::Int8 : ElementType::UInt8;
+    else if constexpr (sizeof(T) == 2)
+      return std::is_signed_v<T> ? ElementType::Int16 : ElementType::UInt16;
+    else if constexpr (sizeof(T) == 4)
+      return std::is_signed_v<T> ? ElementType::Int32 : ElementType::UInt32;
+    else
+      return std::is_signed_v<T> ? ElementType::Int64 : ElementType::UInt64;
+  }
+};
+
+template <>
+struct SerialTraits<Rational> {
+  static constexpr std::size_t size = 2 * sizeof(std::int32_t);
+  static constexpr std::size_t word = sizeof(std::int32_t);
+  static constexpr ElementType tag() { return ElementType::Rational; }
+};
+
+inline constexpr std::uint8_t native_byte_order()
+{
+  return std::endian::native == std::endian::little ? 0 : 1;
+}
+
+} // namespace lin_alg::detail
+
+// ==============================================================================
+// Streaming Writer
+// ==============================================================================
+
+/**
+ * @brief Writes a matrix to a stream one block of rows at a time.
+ *
+ * The header is written on construction. Rows are then appended with
+ * `write_rows()` and the trailer is written by `finish()`. Only a single chunk
+ * buffer is ever allocated, so arbitrarily large matrices can be produced
+ * without holding them in memory.
+ *
+ * @tparam T Element type, either an arithmetic type or Rational.
+ */
+template <typename T>
+class MatrixWriter {
+private:
+  using Traits = lin_alg::detail::SerialTraits<T>;
+
+  std::ostream& _os;
+  std::size_t _cols;
+  std::size_t _rows_left;
+  std::size_t _chunk_elems;
+  lin_alg::detail::Checksum64 _checksum;
+  std::vector<std::int32_t> _pack;
+
+  void put(const void* bytes, std::size_t n)
+  {
+    _os.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(n));
+    if (!_os)
+      throw std::runtime_error("Failed to write matrix to stream.");
+  }
+
+public:
+  /**
+   * @brief Writes the header of a @p rows x @p cols matrix to @p os.
+   *
+   * @param os Destination stream, opened in binary mode.
+   * @param rows Number of rows that will be written.
+   * @param cols Number of columns that will be written.
+   * @param chunk_bytes Approximate number of bytes per stream write.
+   *
+   * @throws std::invalid_argument If either dimension is zero.
+   * @throws std::runtime_error If the stream fails.
+   */
+  MatrixWriter(std::ostream& os, std::size_t rows, std::size_t cols,
+      std::size_t chunk_bytes = SERIALIZATION_CHUNK_BYTES)
+    : _os(os), _cols(cols), _rows_left(rows),
+      _chunk_elems(std::max<std::size_t>(1, chunk_bytes / Traits::size))
+  {
+    using namespace lin_alg::detail;
+    if (rows == 0 || cols == 0)
+      throw std::invalid_argument("Matrix dimensions cannot be zero.");
+
+    std::array<unsigned char, SERIALIZATION_HEADER_BYTES> header{};
+    std::copy(SERIALIZATION_MAGIC.begin(), SERIALIZATION_MAGIC.end(), header.begin());
+    store_le(&header[4], SERIALIZATION_VERSION, 2);
+    header[6] = static_cast<unsigned char>(Traits::tag());
+    header[7] = native_byte_order();
+    store_le(&header[8], Traits::size, 4);
+    store_le(&header[16], rows, 8);
+    store_le(&header[24], cols, 8);
+
+    Checksum64 header_sum;
+    header_sum.update(header.data(), 32);
+    store_le(&header[32], header_sum.value(), 8);
+    put(header.data(), header.size());
+  }
+
+  /**
+   * @brief Appends whole rows to the payload.
+   *
+   * @param values Elements in row-major order; the size must be a multiple of the
+   * column count.
+   *
+   * @throws std::invalid_argument If @p values does not hold whole rows or holds
+   * more rows than remain to be written.
+   */
+  void write_rows(std::span<const T> values)
+  {
+    if (values.size() % _cols != 0 || values.size() / _cols > _rows_left)
+      throw std::invalid_argument("Rows written do not match matrix dimensions.");
+
+    for (std::size_t off = 0; off < values.size(); off += _chunk_elems) {
+      const std::size_t n = std::min(_chunk_elems, values.size() - off);
+      if constexpr (lin_alg::detail::is_raw_serializable_v<T>) {
+        _checksum.update(values.data() + off, n * sizeof(T));
+        put(values.data() + off, n * sizeof(T));
+      } else {
+        _pack.resize(2 * n);
+        for (std::size_t i = 0; i < n; ++i) {
+          _pack[2 * i] = static_cast<std::int32_t>(values[off + i].numerator());
+          _pack[2 * i + 1] = static_cast<std::int32_t>(values[off + i].denominator());
+        }
+        _checksum.update(_pack.data(), n * Traits::size);
+        put(_pack.data(), n * Traits::size);
+      }
+    }
+    _rows_left -= values.size() / _cols;
+  }
+
+  /**
+   * @brief Writes the payload checksum. Must be called once all rows are written.
+   *
+   * @throws std::logic_error If fewer rows than announced have been written.
+   */
+  void finish()
+  {
+    if (_rows_left != 0)
+      throw std::logic_error("Not all matrix rows have been written.");
+    std::array<unsigned char, 8> trailer{};
+    lin_alg::detail::store_le(trailer.data(), _checksum.value(), 8);
+    put(trailer.data(), trailer.size());
+    _os.flush();
+  }
+};
+
+// ==============================================================================
+// Streaming Reader
+// ==============================================================================
+
+/**
+ * @brief Reads a serialized matrix from a stream one block of rows at a time.
+ *
+ * The header is read and validated on construction. Rows are then pulled with
+ * `read_rows()` and the payload checksum is verified by `finish()`.
+ *
+ * @tparam T Element type, which must match the type recorded in the header.
+ */
+template <typename T>
+class MatrixReader {
+private:
+  using Traits = lin_alg::detail::SerialTraits<T>;
+
+  std::istream& _is;
+  std::size_t _rows;
+  std::size_t _cols;
+  std::size_t _rows_left;
+  std::size_t _chunk_elems;
+  bool _swap;
+  lin_alg::detail::Checksum64 _checksum;
+  std::vector<std::int32_t> _pack;
+
+  void get(void* bytes, std::size_t n)
+  {
+    _is.read(static_cast<char*>(bytes), static_cast<std::streamsize>(n));
+    if (static_cast<std::size_t>(_is.gcount()) != n)
+      throw std::runtime_error("Unexpected end of matrix stream.");
+  }
+
+public:
+  /**
+   * @brief Reads and validates the header of a serialized matrix.
+   *
+   * @param is Source stream, opened in binary mode.
+   * @param chunk_bytes Approximate number of bytes per stream read.
+   *
+   * @throws std::runtime_error If the header is truncated, corrupt, of an unknown
+   * version or describes a different element type than @p T.
+   */
+  explicit MatrixReader(std::istream& is, std::size_t chunk_bytes = SERIALIZATION_CHUNK_BYTES)
+    : _is(is), _chunk_elems(std::max<std::size_t>(1, chunk_bytes / Traits::size))
+  {
+    using namespace lin_alg::detail;
+    std::array<unsigned char, SERIALIZATION_HEADER_BYTES> header{};
+    get(header.data(), header.size());
+
+    if (!std::equal(SERIALIZATION_MAGIC.begin(), SERIALIZATION_MAGIC.end(), header.begin()))
+      throw std::runtime_error("Stream does not contain a serialized matrix.");
+
+    Checksum64 header_sum;
+    header_sum.update(header.data(), 32);
+    if (header_sum.value() != load_le(&header[32], 8))
+      throw std::runtime_error("Matrix header checksum mismatch.");
+
+    if (load_le(&header[4], 2) != SERIALIZATION_VERSION)
+      throw std::runtime_error("Unsupported matrix format version.");
+    if (header[6] != static_cast<unsigned char>(Traits::tag()) || load_le(&header[8], 4) != Traits::size)
+      throw std::runtime_error("Serialized element type does not match requested type.");
+    if (header[7] > 1)
+      throw std::runtime_error("Invalid byte order in matrix header.");
+
+    _swap = header[7] != native_byte_order();
+    _rows = load_le(&header[16], 8);
+    _cols = load_le(&header[24], 8);
+    if (_rows == 0 || _cols == 0 || _rows > SIZE_MAX / _cols)
+      throw std::runtime_error("Invalid matrix dimensions in header.");
+    _rows_left = _rows;
+  }
+
+  /** Returns the number of rows recorded in the header. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns recorded in the header. */
+  std::size_t cols() const noexcept { return _cols; }
+
+  /**
+   * @brief Reads the next `out.size() / cols()` rows into @p out.
+   *
+   * @throws std::invalid_argument If @p out does not hold whole rows or asks for
+   * more rows than remain.
+   * @throws std::runtime_error If the stream ends early.
+   */
+  void read_rows(std::span<T> out)
+  {
+    if (out.size() % _cols != 0 || out.size() / _cols > _rows_left)
+      throw std::invalid_argument("Rows read do not match matrix dimensions.");
+
+    for (std::size_t off = 0; off < out.size(); off += _chunk_elems) {
+      const std::size_t n = std::min(_chunk_elems, out.size() - off);
+      if constexpr (lin_alg::detail::is_raw_serializable_v<T>) {
+        auto bytes = reinterpret_cast<unsigned char*>(out.data() + off);
+        get(bytes, n * sizeof(T));
+        _checksum.update(bytes, n * sizeof(T));
+        if (_swap) lin_alg::detail::byteswap_elements(bytes, n, sizeof(T));
+      } else {
+        _pack.resize(2 * n);
+        auto bytes = reinterpret_cast<unsigned char*>(_pack.data());
+        get(bytes, n * Traits::size);
+        _checksum.update(bytes, n * Traits::size);
+        if (_swap) lin_alg::detail::byteswap_elements(bytes, 2 * n, Traits::word);
+        for (std::size_t i = 0; i < n; ++i)
+          out[off + i] = T(_pack[2 * i], _pack[2 * i + 1]);
+      }
+    }
+    _rows_left -= out.size() / _cols;
+  }
+
+  /**
+   * @brief Reads the trailer and verifies the payload checksum.
+   *
+   * @throws std::logic_error If not all rows have been read.
+   * @throws std::runtime_error If the checksum does not match.
+   */
+  void finish()
+  {
+    if (_rows_left != 0)
+      throw std::logic_error("Not all matrix rows have been read.");
+    std::array<unsigned char, 8> trailer{};
+    get(trailer.data(), trailer.size());
+    if (lin_alg::detail::load_le(trailer.data(), 8) != _checksum.value())
+      throw std::runtime_error("Matrix payload checksum mismatch.");
+  }
+};
+
+// ==============================================================================
+// Whole-Matrix Helpers
+// ==============================================================================
+
+/**
+ * @brief Serializes @p m to @p os in the versioned binary format.
+ *
+ * @param os Destination stream, opened in binary mode.
+ * @param m Matrix to write.
+ * @param chunk_bytes Approximate number of bytes per stream write.
+ *
+ * @throws std::runtime_error If the stream fails.
+ *
+ * @note Arithmetic element types are written straight from the matrix storage.
+ * Rational elements are packed through a single chunk-sized buffer.
+ */
+template <typename T>
+void serialize(std::ostream& os, const Matrix<T>& m,
+    std::size_t chunk_bytes = SERIALIZATION_CHUNK_BYTES)
+{
+  MatrixWriter<T> writer(os, m.rows(), m.cols(), chunk_bytes);
+  writer.write_rows(std::span<const T>(m.data()));
+  writer.finish();
+}
+
+/**
+ * @brief Deserializes a matrix previously written with `serialize()`.
+ *
+ * @tparam T Element type; must match the type recorded in the stream.
+ * @param is Source stream, opened in binary mode.
+ * @param chunk_bytes Approximate number of bytes per stream read.
+ * @return The deserialized matrix.
+ *
+ * @throws std::runtime_error If the stream is truncated, corrupt or holds a
+ * different element type.
+ *
+ * @note Arithmetic payloads are read directly into the storage of the returned
+ * matrix, so no second copy of the data is ever held in memory.
+ */
+template <typename T>
+Matrix<T> deserialize(std::istream& is, std::size_t chunk_bytes = SERIALIZATION_CHUNK_BYTES)
+{
+  MatrixReader<T> reader(is, chunk_bytes);
+  Matrix<T> m(reader.rows(), reader.cols());
+  reader.read_rows(std::span<T>(m.data()));
+  reader.finish();
+  return m;
+}
+
+#endif
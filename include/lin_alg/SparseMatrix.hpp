@@ -0,0 +1,271 @@
+#pragma once
+
+#ifndef WOJI_SPARSE_MATRIX_HPP
+#define WOJI_SPARSE_MATRIX_HPP
+
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief A single (row, column, value) entry of a sparse matrix.
+ *
+ * @tparam T Element type of the value.
+ */
+template <typename T>
+struct Triplet {
+  std::size_t row;
+  std::size_t col;
+  T value;
+};
+
+/**
+ * @brief A sparse matrix stored in Compressed Sparse Row (CSR) format.
+ *
+ * @tparam T Element type stored in the matrix.
+ *
+ * The non-zero entries of row `r` are stored contiguously in `values()` at the
+ * positions [row_ptr()[r], row_ptr()[r + 1]), with their column indices in the
+ * same positions of `col_idx()`. Within a row, column indices are sorted.
+ */
+template <typename T>
+class SparseMatrix {
+private:
+  /** Number of rows in the matrix. */
+  std::size_t _rows;
+
+  /** Number of columns in the matrix. */
+  std::size_t _cols;
+
+  /** Offsets of each row into `_col_idx` and `_values`, of size rows() + 1. */
+  std::vector<std::size_t> _row_ptr;
+
+  /** Column index of each stored entry. */
+  std::vector<std::size_t> _col_idx;
+
+  /** Value of each stored entry. */
+  std::vector<T> _values;
+
+public:
+  using value_type = T;
+
+  // ==============================================================================
+  // Constructors
+  // ==============================================================================
+
+  /**
+   * @brief Constructs an empty (all zero) sparse matrix.
+   *
+   * @param rows Number of rows.
+   * @param cols Number of columns.
+   *
+   * @throws std::invalid_argument If matrix dimensions are zero.
+   */
+  SparseMatrix(std::size_t rows, std::size_t cols);
+
+  /**
+   * @brief Constructs a sparse matrix from a list of entries.
+   *
+   * @param rows Number of rows.
+   * @param cols Number of columns.
+   * @param entries Entries in any order. Duplicate positions are summed.
+   *
+   * @throws std::invalid_argument If matrix dimensions are zero.
+   * @throws std::out_of_range If an entry lies outside the matrix dimensions.
+   */
+  static SparseMatrix<T> from_triplets(std::size_t rows, std::size_t cols,
+      std::span<const Triplet<T>> entries);
+
+  // ==============================================================================
+  // Accessors
+  // ==============================================================================
+
+  /** Returns the number of rows. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns the number of stored entries. */
+  std::size_t nnz() const noexcept { return _values.size(); }
+  /** Returns the row offsets, of size rows() + 1. */
+  const std::vector<std::size_t>& row_ptr() const noexcept { return _row_ptr; }
+  /** Returns the column index of each stored entry. */
+  const std::vector<std::size_t>& col_idx() const noexcept { return _col_idx; }
+  /** Returns the value of each stored entry. */
+  const std::vector<T>& values() const noexcept { return _values; }
+  /** Returns the mutable value of each stored entry. */
+  std::vector<T>& values() noexcept { return _values; }
+
+  /**
+   * @brief Returns the element at (r, c), or zero if it is not stored.
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  T at(std::size_t r, std::size_t c) const;
+
+  // ==============================================================================
+  // Arithmetic
+  // ==============================================================================
+
+  /**
+   * @brief Multiplies this matrix by a dense column vector.
+   *
+   * @param x A vector of size cols().
+   * @return The product vector, of size rows().
+   *
+   * @throws std::invalid_argument If x.size() != cols().
+   */
+  std::vector<T> operator*(std::span<const T> x) const;
+
+  /**
+   * @brief Computes `y = A x` into caller-provided storage.
+   *
+   * This is the LinearOperator interface used by matrix-free solvers; it does
+   * not allocate. Rows are spread across threads.
+   *
+   * @param x A vector of size cols().
+   * @param y A vector of size rows(); overwritten. Must not overlap @p x.
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const;
+
+  // ==============================================================================
+  // Conversion
+  // ==============================================================================
+
+  /** Returns a dense copy of this matrix. */
+  Matrix<T> to_dense() const;
+};
+
+// ==============================================================================
+// Constructor Definitions
+// ==============================================================================
+
+template <typename T>
+SparseMatrix<T>::SparseMatrix(std::size_t rows, std::size_t cols)
+  : _rows(rows), _cols(cols), _row_ptr(rows + 1, 0)
+{
+  if (rows == 0 || cols == 0)
+    throw std::invalid_argument("Matrix dimensions cannot be zero.");
+}
+
+template <typename T>
+SparseMatrix<T> SparseMatrix<T>::from_triplets(std::size_t rows, std::size_t cols,
+    std::span<const Triplet<T>> entries)
+{
+  SparseMatrix<T> m(rows, cols);
+
+  // Counting sort by row
+  for (const auto& e : entries) {
+    if (e.row >= rows || e.col >= cols)
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    ++m._row_ptr[e.row + 1];
+  }
+  for (std::size_t r = 0; r < rows; ++r)
+    m._row_ptr[r + 1] += m._row_ptr[r];
+
+  std::vector<std::size_t> next(m._row_ptr.begin(), m._row_ptr.end() - 1);
+  std::vector<std::size_t> col_idx(entries.size());
+  std::vector<T> values(entries.size());
+  for (const auto& e : entries) {
+    const std::size_t pos = next[e.row]++;
+    col_idx[pos] = e.col;
+    values[pos] = e.value;
+  }
+
+  // Sort each row by column and merge duplicates
+  std::vector<std::size_t> order;
+  std::size_t out = 0;
+  for (std::size_t r = 0; r < rows; ++r) {
+    const std::size_t lo = m._row_ptr[r], hi = m._row_ptr[r + 1];
+    order.resize(hi - lo);
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = lo + i;
+    std::sort(order.begin(), order.end(),
+        [&](std::size_t a, std::size_t b) { return col_idx[a] < col_idx[b]; });
+
+    m._row_ptr[r] = out;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      const std::size_t src = order[i];
+      if (i > 0 && col_idx[src] == m._col_idx.back()) {
+        m._values.back() += values[src];
+        continue;
+      }
+      m._col_idx.push_back(col_idx[src]);
+      m._values.push_back(values[src]);
+      ++out;
+    }
+  }
+  m._row_ptr[rows] = out;
+
+  return m;
+}
+
+// ==============================================================================
+// Accessor Definitions
+// ==============================================================================
+
+template <typename T>
+T SparseMatrix<T>::at(std::size_t r, std::size_t c) const
+{
+  if (r >= _rows || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+
+  auto first = _col_idx.begin() + _row_ptr[r];
+  auto last = _col_idx.begin() + _row_ptr[r + 1];
+  auto it = std::lower_bound(first, last, c);
+  if (it == last || *it != c) return T{};
+  return _values[it - _col_idx.begin()];
+}
+
+// ==============================================================================
+// Arithmetic Definitions
+// ==============================================================================
+
+template <typename T>
+std::vector<T> SparseMatrix<T>::operator*(std::span<const T> x) const
+{
+  if (x.size() != _cols)
+    throw std::invalid_argument("Vector must have the same number of rows as the matrix has columns!");
+
+  std::vector<T> y(_rows, T{});
+  apply(x, y);
+  return y;
+}
+
+template <typename T>
+void SparseMatrix<T>::apply(std::span<const T> x, std::span<T> y) const
+{
+  if (x.size() != _cols || y.size() != _rows)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  const std::size_t grain = std::max<std::size_t>(1, (std::size_t{1} << 15) * _rows / (nnz() + _rows));
+  lin_alg::detail::parallel_for(0, _rows, grain, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t r = lo; r < hi; ++r) {
+      T sum{};
+      for (std::size_t k = _row_ptr[r]; k < _row_ptr[r + 1]; ++k)
+        sum += _values[k] * x[_col_idx[k]];
+      y[r] = sum;
+    }
+  });
+}
+
+// ==============================================================================
+// Conversion Definitions
+// ==============================================================================
+
+template <typename T>
+Matrix<T> SparseMatrix<T>::to_dense() const
+{
+  Matrix<T> m(_rows, _cols);
+  for (std::size_t r = 0; r < _rows; ++r)
+    for (std::size_t k = _row_ptr[r]; k < _row_ptr[r + 1]; ++k)
+      m.data()[r * _cols + _col_idx[k]] = _values[k];
+  return m;
+}
+
+#endif
@@ -0,0 +1,589 @@
+#pragma once
+
+#ifndef WOJI_STRUCTURED_MATRIX_HPP
+#define WOJI_STRUCTURED_MATRIX_HPP
+
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @file StructuredMatrix.hpp
+ * @brief Toeplitz, Hankel and Vandermonde matrices stored by their generators.
+ *
+ * Each type keeps O(m + n) parameters instead of m n entries, computes `A x`
+ * without materializing A, and solves square systems in O(n²) time and O(n)
+ * extra memory: Levinson recursion for Toeplitz and Hankel, Björck–Pereyra for
+ * Vandermonde. All three model LinearOperator, so they plug into lanczos() and
+ * other matrix-free solvers, and convert to a dense Matrix with to_dense().
+ */
+
+namespace lin_alg::detail {
+
+/** Minimum number of entries a thread touches in a structured matrix-vector product. */
+inline constexpr std::size_t STRUCTURED_GRAIN = std::size_t{1} << 15;
+
+/**
+ * @brief Solves the n x n Toeplitz system `T x = b` by Levinson recursion.
+ *
+ * @param g The 2n - 1 diagonals of T: `T(i, j) = g[n - 1 + j - i]`.
+ *
+ * Forward and backward vectors f, b of the leading k x k block (`T_k f = e₁`,
+ * `T_k b = e_k`) are extended one order at a time, and the solution with them.
+ *
+ * @throws std::runtime_error If a leading principal submatrix is singular.
+ */
+template <typename T>
+std::vector<T> levinson(std::size_t n, const T* g, std::span<const T> rhs)
+{
+  // t(d) is the entry on diagonal i - j = d
+  auto t = [&](std::ptrdiff_t d) -> const T& { return g[static_cast<std::ptrdiff_t>(n) - 1 - d]; };
+  if (t(0) == T{})
+    throw std::runtime_error("Toeplitz matrix has a singular leading principal submatrix.");
+
+  std::vector<T> f(n), b(n), x(n), nf(n), nb(n);
+  f[0] = b[0] = T{1} / t(0);
+  x[0] = rhs[0] / t(0);
+
+  for (std::size_t k = 1; k < n; ++k) {
+    // Residuals of [f; 0] in row k and of [0; b] in row 0 of the (k + 1) block
+    T ef{}, eb{}, ex{};
+    for (std::size_t j = 0; j < k; ++j) {
+      const auto d = static_cast<std::ptrdiff_t>(k - j);
+      ef += t(d) * f[j];
+      ex += t(d) * x[j];
+      eb += t(-static_cast<std::ptrdiff_t>(j + 1)) * b[j];
+    }
+    const T denom = T{1} - ef * eb;
+    if (denom == T{})
+      throw std::runtime_error("Toeplitz matrix has a singular leading principal submatrix.");
+
+    // f' = ([f; 0] - ef [0; b]) / denom and b' = ([0; b] - eb [f; 0]) / denom
+    for (std::size_t j = 0; j <= k; ++j) {
+      const T fj = j < k ? f[j] : T{};
+      const T bj = j > 0 ? b[j - 1] : T{};
+      nf[j] = (fj - ef * bj) / denom;
+      nb[j] = (bj - eb * fj) / denom;
+    }
+    std::swap(f, nf);
+    std::swap(b, nb);
+
+    const T gap = rhs[k] - ex;
+    for (std::size_t j = 0; j <= k; ++j) x[j] += gap * b[j];
+  }
+  return x;
+}
+
+/** y[i] = dot(n, g + offset(i), x) for each row i, spread across threads. */
+template <typename T, typename Offset>
+void sliding_product(std::size_t m, std::size_t n, const T* g, Offset offset, const T* x, T* y)
+{
+  parallel_for(0, m, std::max<std::size_t>(1, STRUCTURED_GRAIN / (n + 1)), [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t i = lo; i < hi; ++i) y[i] = dot(n, g + offset(i), x);
+  });
+}
+
+/** Throws unless @p x and @p y match an @p m x @p n operator. */
+template <typename T>
+void check_apply(std::size_t m, std::size_t n, std::span<const T> x, std::span<T> y)
+{
+  if (x.size() != n || y.size() != m)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief An m x n Toeplitz matrix, constant along each diagonal:
+ * `A(i, j) = c[i - j]` below the diagonal and `r[j - i]` above it.
+ *
+ * @tparam T Element type stored in the matrix.
+ *
+ * The m + n - 1 diagonals are stored in one array ordered from the bottom-left
+ * corner to the top-right, so that every row of A is a contiguous window of it
+ * and the matrix-vector product is m vectorized dot products.
+ */
+template <typename T>
+class ToeplitzMatrix {
+private:
+  std::size_t _rows;
+  std::size_t _cols;
+
+  /** Diagonals: `A(i, j) = _diags[_rows - 1 + j - i]`. */
+  std::vector<T> _diags;
+
+public:
+  using value_type = T;
+
+  // ==============================================================================
+  // Constructors
+  // ==============================================================================
+
+  /**
+   * @brief Constructs the Toeplitz matrix with the given first column and first row.
+   *
+   * @param first_col The first column, of size rows().
+   * @param first_row The first row, of size cols().
+   *
+   * @throws std::invalid_argument If either generator is empty, or they
+   * disagree on the top-left entry.
+   */
+  ToeplitzMatrix(std::span<const T> first_col, std::span<const T> first_row);
+
+  // ==============================================================================
+  // Accessors
+  // ==============================================================================
+
+  /** Returns the number of rows. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns the m + n - 1 diagonals, from the bottom-left corner to the top-right. */
+  const std::vector<T>& diagonals() const noexcept { return _diags; }
+
+  /**
+   * @brief Returns the element at (r, c).
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  const T& at(std::size_t r, std::size_t c) const;
+
+  // ==============================================================================
+  // Arithmetic
+  // ==============================================================================
+
+  /**
+   * @brief Multiplies this matrix by a dense column vector.
+   *
+   * @throws std::invalid_argument If x.size() != cols().
+   */
+  std::vector<T> operator*(std::span<const T> x) const;
+
+  /**
+   * @brief Computes `y = A x` into caller-provided storage (LinearOperator).
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const;
+
+  /**
+   * @brief Solves `A x = b` by Levinson recursion in O(n²) time.
+   *
+   * @note Every leading principal submatrix must be nonsingular, as for LU
+   * without pivoting; symmetric positive definite and diagonally dominant
+   * Toeplitz matrices always qualify.
+   *
+   * @throws std::invalid_argument If the matrix is not square or @p b has the wrong size.
+   * @throws std::runtime_error If a leading principal submatrix is singular.
+   */
+  std::vector<T> solve(std::span<const T> b) const requires Field<T>;
+
+  // ==============================================================================
+  // Conversion
+  // ==============================================================================
+
+  /** Returns a dense copy of this matrix. */
+  Matrix<T> to_dense() const;
+};
+
+/**
+ * @brief An m x n Hankel matrix, constant along each anti-diagonal:
+ * `A(i, j) = h[i + j]`.
+ *
+ * @tparam T Element type stored in the matrix.
+ *
+ * Row i is the window `h[i, i + n)` of the m + n - 1 anti-diagonals. Reversing
+ * the rows of a square Hankel matrix gives a Toeplitz matrix with the same
+ * generator, which is how solve() reuses the Levinson recursion.
+ */
+template <typename T>
+class HankelMatrix {
+private:
+  std::size_t _rows;
+  std::size_t _cols;
+
+  /** Anti-diagonals: `A(i, j) = _antidiags[i + j]`. */
+  std::vector<T> _antidiags;
+
+public:
+  using value_type = T;
+
+  // ==============================================================================
+  // Constructors
+  // ==============================================================================
+
+  /**
+   * @brief Constructs the Hankel matrix with the given first column and last row.
+   *
+   * @param first_col The first column, of size rows().
+   * @param last_row The last row, of size cols().
+   *
+   * @throws std::invalid_argument If either generator is empty, or they
+   * disagree on the bottom-left entry.
+   */
+  HankelMatrix(std::span<const T> first_col, std::span<const T> last_row);
+
+  // ==============================================================================
+  // Accessors
+  // ==============================================================================
+
+  /** Returns the number of rows. */
+  std::size_t rows() const noexcept { return _rows; }
+  /** Returns the number of columns. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns the m + n - 1 anti-diagonals, from the top-left corner to the bottom-right. */
+  const std::vector<T>& antidiagonals() const noexcept { return _antidiags; }
+
+  /**
+   * @brief Returns the element at (r, c).
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  const T& at(std::size_t r, std::size_t c) const;
+
+  // ==============================================================================
+  // Arithmetic
+  // ==============================================================================
+
+  /**
+   * @brief Multiplies this matrix by a dense column vector.
+   *
+   * @throws std::invalid_argument If x.size() != cols().
+   */
+  std::vector<T> operator*(std::span<const T> x) const;
+
+  /**
+   * @brief Computes `y = A x` into caller-provided storage (LinearOperator).
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const;
+
+  /**
+   * @brief Solves `A x = b` in O(n²) time by Levinson recursion on the
+   * row-reversed (Toeplitz) matrix.
+   *
+   * @note The leading principal submatrices of the row-reversed matrix, i.e.
+   * the trailing-row, leading-column blocks of A, must be nonsingular.
+   *
+   * @throws std::invalid_argument If the matrix is not square or @p b has the wrong size.
+   * @throws std::runtime_error If one of those submatrices is singular.
+   */
+  std::vector<T> solve(std::span<const T> b) const requires Field<T>;
+
+  // ==============================================================================
+  // Conversion
+  // ==============================================================================
+
+  /** Returns a dense copy of this matrix. */
+  Matrix<T> to_dense() const;
+};
+
+/**
+ * @brief An m x n Vandermonde matrix of powers of m nodes: `A(i, j) = αᵢʲ`.
+ *
+ * @tparam T Element type stored in the matrix.
+ *
+ * `A c` evaluates the polynomial with coefficients c at every node, by
+ * Horner's rule; solving `A c = f` for square A interpolates the values f.
+ */
+template <typename T>
+class VandermondeMatrix {
+private:
+  std::size_t _cols;
+  std::vector<T> _nodes;
+
+public:
+  using value_type = T;
+
+  // ==============================================================================
+  // Constructors
+  // ==============================================================================
+
+  /**
+   * @brief Constructs the Vandermonde matrix of the given nodes.
+   *
+   * @param nodes The nodes α, one per row.
+   * @param cols Number of columns (powers α⁰ ... αⁿ⁻¹); zero means square.
+   *
+   * @throws std::invalid_argument If @p nodes is empty.
+   */
+  explicit VandermondeMatrix(std::span<const T> nodes, std::size_t cols = 0);
+
+  // ==============================================================================
+  // Accessors
+  // ==============================================================================
+
+  /** Returns the number of rows. */
+  std::size_t rows() const noexcept { return _nodes.size(); }
+  /** Returns the number of columns. */
+  std::size_t cols() const noexcept { return _cols; }
+  /** Returns the nodes, one per row. */
+  const std::vector<T>& nodes() const noexcept { return _nodes; }
+
+  /**
+   * @brief Returns the element at (r, c).
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  T at(std::size_t r, std::size_t c) const;
+
+  // ==============================================================================
+  // Arithmetic
+  // ==============================================================================
+
+  /**
+   * @brief Multiplies this matrix by a dense column vector.
+   *
+   * @throws std::invalid_argument If x.size() != cols().
+   */
+  std::vector<T> operator*(std::span<const T> x) const;
+
+  /**
+   * @brief Computes `y = A x` into caller-provided storage (LinearOperator).
+   *
+   * @throws std::invalid_argument If @p x or @p y has the wrong size.
+   */
+  void apply(std::span<const T> x, std::span<T> y) const;
+
+  /**
+   * @brief Solves `A c = f` in O(n²) time with the Björck–Pereyra algorithm:
+   * Newton divided differences, then conversion to the monomial basis.
+   *
+   * @note For real nodes in increasing order the result is often far more
+   * accurate than the condition number of A suggests.
+   *
+   * @throws std::invalid_argument If the matrix is not square or @p f has the wrong size.
+   * @throws std::runtime_error If two nodes coincide.
+   */
+  std::vector<T> solve(std::span<const T> f) const requires Field<T>;
+
+  // ==============================================================================
+  // Conversion
+  // ==============================================================================
+
+  /** Returns a dense copy of this matrix. */
+  Matrix<T> to_dense() const;
+};
+
+// ==============================================================================
+// Toeplitz Definitions
+// ==============================================================================
+
+template <typename T>
+ToeplitzMatrix<T>::ToeplitzMatrix(std::span<const T> first_col, std::span<const T> first_row)
+  : _rows(first_col.size()), _cols(first_row.size())
+{
+  if (_rows == 0)
+    throw std::invalid_argument("Matrix must have at least one row.");
+  if (_cols == 0)
+    throw std::invalid_argument("Matrix must have at least one column.");
+  if (!(first_col[0] == first_row[0]))
+    throw std::invalid_argument("Toeplitz generators must agree on the diagonal entry.");
+
+  _diags.reserve(_rows + _cols - 1);
+  _diags.insert(_diags.end(), first_col.rbegin(), first_col.rend());
+  _diags.insert(_diags.end(), first_row.begin() + 1, first_row.end());
+}
+
+template <typename T>
+const T& ToeplitzMatrix<T>::at(std::size_t r, std::size_t c) const
+{
+  if (r >= _rows || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  return _diags[_rows - 1 + c - r];
+}
+
+template <typename T>
+std::vector<T> ToeplitzMatrix<T>::operator*(std::span<const T> x) const
+{
+  std::vector<T> y(_rows);
+  apply(x, y);
+  return y;
+}
+
+template <typename T>
+void ToeplitzMatrix<T>::apply(std::span<const T> x, std::span<T> y) const
+{
+  lin_alg::detail::check_apply(_rows, _cols, x, y);
+  lin_alg::detail::sliding_product(_rows, _cols, _diags.data(), [this](std::size_t i) { return _rows - 1 - i; },
+      x.data(), y.data());
+}
+
+template <typename T>
+std::vector<T> ToeplitzMatrix<T>::solve(std::span<const T> b) const requires Field<T>
+{
+  if (_rows != _cols)
+    throw std::invalid_argument("Structured solve requires a square matrix.");
+  if (b.size() != _rows)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+  return lin_alg::detail::levinson(_rows, _diags.data(), b);
+}
+
+template <typename T>
+Matrix<T> ToeplitzMatrix<T>::to_dense() const
+{
+  Matrix<T> dense(_rows, _cols);
+  for (std::size_t i = 0; i < _rows; ++i)
+    std::copy_n(_diags.begin() + (_rows - 1 - i), _cols, dense.data().begin() + i * _cols);
+  return dense;
+}
+
+// ==============================================================================
+// Hankel Definitions
+// ==============================================================================
+
+template <typename T>
+HankelMatrix<T>::HankelMatrix(std::span<const T> first_col, std::span<const T> last_row)
+  : _rows(first_col.size()), _cols(last_row.size())
+{
+  if (_rows == 0)
+    throw std::invalid_argument("Matrix must have at least one row.");
+  if (_cols == 0)
+    throw std::invalid_argument("Matrix must have at least one column.");
+  if (!(first_col[_rows - 1] == last_row[0]))
+    throw std::invalid_argument("Hankel generators must agree on the bottom-left entry.");
+
+  _antidiags.reserve(_rows + _cols - 1);
+  _antidiags.insert(_antidiags.end(), first_col.begin(), first_col.end());
+  _antidiags.insert(_antidiags.end(), last_row.begin() + 1, last_row.end());
+}
+
+template <typename T>
+const T& HankelMatrix<T>::at(std::size_t r, std::size_t c) const
+{
+  if (r >= _rows || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  return _antidiags[r + c];
+}
+
+template <typename T>
+std::vector<T> HankelMatrix<T>::operator*(std::span<const T> x) const
+{
+  std::vector<T> y(_rows);
+  apply(x, y);
+  return y;
+}
+
+template <typename T>
+void HankelMatrix<T>::apply(std::span<const T> x, std::span<T> y) const
+{
+  lin_alg::detail::check_apply(_rows, _cols, x, y);
+  lin_alg::detail::sliding_product(_rows, _cols, _antidiags.data(), [](std::size_t i) { return i; }, x.data(),
+      y.data());
+}
+
+template <typename T>
+std::vector<T> HankelMatrix<T>::solve(std::span<const T> b) const requires Field<T>
+{
+  if (_rows != _cols)
+    throw std::invalid_argument("Structured solve requires a square matrix.");
+  if (b.size() != _rows)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  // Row i of A is row n - 1 - i of the Toeplitz matrix J A, whose diagonals are the anti-diagonals of A
+  const std::vector<T> reversed(b.rbegin(), b.rend());
+  return lin_alg::detail::levinson<T>(_rows, _antidiags.data(), reversed);
+}
+
+template <typename T>
+Matrix<T> HankelMatrix<T>::to_dense() const
+{
+  Matrix<T> dense(_rows, _cols);
+  for (std::size_t i = 0; i < _rows; ++i)
+    std::copy_n(_antidiags.begin() + i, _cols, dense.data().begin() + i * _cols);
+  return dense;
+}
+
+// ==============================================================================
+// Vandermonde Definitions
+// ==============================================================================
+
+template <typename T>
+VandermondeMatrix<T>::VandermondeMatrix(std::span<const T> nodes, std::size_t cols)
+  : _cols(cols == 0 ? nodes.size() : cols), _nodes(nodes.begin(), nodes.end())
+{
+  if (_nodes.empty())
+    throw std::invalid_argument("Matrix must have at least one row.");
+}
+
+template <typename T>
+T VandermondeMatrix<T>::at(std::size_t r, std::size_t c) const
+{
+  if (r >= rows() || c >= _cols)
+    throw std::out_of_range("Requested position outside of matrix dimensions.");
+  T power{1};
+  for (std::size_t k = 0; k < c; ++k) power *= _nodes[r];
+  return power;
+}
+
+template <typename T>
+std::vector<T> VandermondeMatrix<T>::operator*(std::span<const T> x) const
+{
+  std::vector<T> y(rows());
+  apply(x, y);
+  return y;
+}
+
+template <typename T>
+void VandermondeMatrix<T>::apply(std::span<const T> x, std::span<T> y) const
+{
+  lin_alg::detail::check_apply(rows(), _cols, x, y);
+  lin_alg::detail::parallel_for(0, rows(), std::max<std::size_t>(1, lin_alg::detail::STRUCTURED_GRAIN / (_cols + 1)),
+      [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t i = lo; i < hi; ++i) {
+          // Horner's rule for the polynomial with coefficients x at node i
+          T acc = x[_cols - 1];
+          for (std::size_t j = _cols - 1; j-- > 0;) acc = acc * _nodes[i] + x[j];
+          y[i] = acc;
+        }
+      });
+}
+
+template <typename T>
+std::vector<T> VandermondeMatrix<T>::solve(std::span<const T> f) const requires Field<T>
+{
+  const std::size_t n = rows();
+  if (n != _cols)
+    throw std::invalid_argument("Structured solve requires a square matrix.");
+  if (f.size() != n)
+    throw std::invalid_argument("Vector sizes must match the matrix dimensions!");
+
+  // Newton divided differences c[i] = f[α₀, ..., αᵢ]
+  std::vector<T> c(f.begin(), f.end());
+  for (std::size_t k = 0; k + 1 < n; ++k)
+    for (std::size_t i = n - 1; i > k; --i) {
+      const T gap = _nodes[i] - _nodes[i - k - 1];
+      if (gap == T{})
+        throw std::runtime_error("Cannot solve with a singular matrix.");
+      c[i] = (c[i] - c[i - 1]) / gap;
+    }
+
+  // Expand the Newton form into monomial coefficients
+  for (std::size_t k = n - 1; k-- > 0;)
+    for (std::size_t i = k; i + 1 < n; ++i) c[i] -= c[i + 1] * _nodes[k];
+  return c;
+}
+
+template <typename T>
+Matrix<T> VandermondeMatrix<T>::to_dense() const
+{
+  Matrix<T> dense(rows(), _cols);
+  for (std::size_t i = 0; i < rows(); ++i) {
+    T power{1};
+    for (std::size_t j = 0; j < _cols; ++j) {
+      dense.data()[i * _cols + j] = power;
+      power *= _nodes[i];
+    }
+  }
+  return dense;
+}
+
+#endif
@@ -0,0 +1,796 @@
+#pragma once
+
+#ifndef WOJI_SYMMETRIC_EIGEN_HPP
+#define WOJI_SYMMETRIC_EIGEN_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Parallel.hpp>
+#include <lin_alg/Random.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @file SymmetricEigen.hpp
+ * @brief Eigenvalues and eigenvectors of real symmetric matrices.
+ *
+ * The matrix is reduced to tridiagonal form `A = Q T Qᵀ` by blocked Householder
+ * reflections, the eigenproblem of T is solved, and its eigenvectors are mapped
+ * back through Q. The full spectrum of T is found by divide and conquer; a few
+ * eigenpairs are found by bisection and inverse iteration instead, so that only
+ * the wanted eigenvectors are ever formed and back-transformed.
+ */
+
+/** Which end of the spectrum a partial eigendecomposition computes. */
+enum class Spectrum { Smallest, Largest };
+
+namespace lin_alg::detail {
+
+/**
+ * @brief Returns a power of two within a factor of two of |@p x|, so that
+ * dividing by it is exact.
+ */
+template <std::floating_point T>
+T power_of_two_scale(T x)
+{
+  int exponent;
+  std::frexp(x, &exponent);
+  const T scale = std::ldexp(T{1}, exponent);
+  return std::isinf(scale) ? std::ldexp(T{1}, exponent - 1) : scale;
+}
+
+/** Reflectors per panel in the tridiagonal reduction and per block in the back-transformation. */
+inline constexpr std::size_t EIGEN_PANEL = 32;
+
+/** Tridiagonal blocks up to this order are solved directly by implicit QL rather than split. */
+inline constexpr std::size_t EIGEN_DC_BASE = 32;
+
+/** Tridiagonal blocks at least this large solve their two halves on separate threads. */
+inline constexpr std::size_t EIGEN_DC_PARALLEL = 256;
+
+/**
+ * @brief Builds the Householder reflector `H = I - tau v vᵀ` with `H x = beta e₁`.
+ *
+ * @param m Length of @p x.
+ * @param x On entry the vector to reduce; on exit v, with `v[0] = 1`.
+ * @return The pair (tau, beta); tau is zero when x is already a multiple of e₁.
+ */
+template <std::floating_point T>
+std::pair<T, T> householder(std::size_t m, T* x)
+{
+  const T alpha = x[0];
+  x[0] = T{1};
+
+  // ‖x[1:]‖ relative to its largest entry, so that tiny entries do not underflow when squared
+  T largest = 0;
+  for (std::size_t i = 1; i < m; ++i) largest = std::max(largest, std::abs(x[i]));
+  if (largest == T{}) return {T{}, alpha};
+  T sigma = 0;
+  for (std::size_t i = 1; i < m; ++i) sigma += (x[i] / largest) * (x[i] / largest);
+
+  const T beta = -std::copysign(std::hypot(alpha, largest * std::sqrt(sigma)), alpha);
+  const T inv = T{1} / (alpha - beta);
+  if (std::isfinite(inv))
+    scal(m - 1, inv, x + 1);
+  else
+    for (std::size_t i = 1; i < m; ++i) x[i] /= alpha - beta;
+  return {(beta - alpha) / beta, beta};
+}
+
+/**
+ * @brief Reduces the symmetric @p n x @p n matrix @p a to tridiagonal form.
+ *
+ * Reflectors are generated a panel of EIGEN_PANEL at a time. Within a panel,
+ * the trailing matrix is left untouched and its pending updates are carried in
+ * two n x nb factors V and W; at the end of the panel they are applied all at
+ * once as the rank-2nb update `A -= Vᵀ W + Wᵀ V`, which runs through the blocked,
+ * multithreaded GEMM kernel.
+ *
+ * @param a Row-major, fully stored symmetric matrix. On exit, row j holds the
+ * reflector `v_j` in columns j+1..n-1 (with `v_j[j+1] = 1`).
+ * @param d Receives the n diagonal elements of T.
+ * @param e Receives the n-1 off-diagonal elements of T.
+ * @param tau Receives the n-1 reflector scales.
+ */
+template <std::floating_point T>
+void tridiagonalize(std::size_t n, T* a, T* d, T* e, T* tau)
+{
+  std::vector<T> V(EIGEN_PANEL * n), W(EIGEN_PANEL * n), Vt, Wt;
+
+  for (std::size_t k = 0; k + 1 < n; k += EIGEN_PANEL) {
+    const std::size_t nb = std::min(EIGEN_PANEL, n - 1 - k);
+    std::fill(V.begin(), V.end(), T{});
+    std::fill(W.begin(), W.end(), T{});
+
+    for (std::size_t i = 0; i < nb; ++i) {
+      const std::size_t j = k + i, m = n - j - 1;
+      T* row = a + j * n;
+      T* v = V.data() + i * n;
+      T* w = W.data() + i * n;
+
+      // Bring row j up to date with the panel's earlier reflectors
+      for (std::size_t p = 0; p < i; ++p) {
+        axpy(n - j, -V[p * n + j], W.data() + p * n + j, row + j);
+        axpy(n - j, -W[p * n + j], V.data() + p * n + j, row + j);
+      }
+      d[j] = row[j];
+
+      const auto [t, beta] = householder(m, row + j + 1);
+      e[j] = beta;
+      tau[j] = t;
+      std::copy(row + j + 1, row + n, v + j + 1);
+      if (t == T{}) continue;
+
+      // w = tau (A v - Vᵀ (W v) - Wᵀ (V v)), with A the stale trailing matrix
+      parallel_for(j + 1, n, std::max<std::size_t>(1, (std::size_t{1} << 15) / m),
+          [&](std::size_t lo, std::size_t hi) {
+        for (std::size_t r = lo; r < hi; ++r)
+          w[r] = dot(m, a + r * n + j + 1, v + j + 1);
+      });
+      for (std::size_t p = 0; p < i; ++p) {
+        const T wv = dot(m, W.data() + p * n + j + 1, v + j + 1);
+        const T vv = dot(m, V.data() + p * n + j + 1, v + j + 1);
+        axpy(m, -wv, V.data() + p * n + j + 1, w + j + 1);
+        axpy(m, -vv, W.data() + p * n + j + 1, w + j + 1);
+      }
+      scal(m, t, w + j + 1);
+      axpy(m, -t / 2 * dot(m, w + j + 1, v + j + 1), v + j + 1, w + j + 1);
+    }
+
+    // A[s:, s:] -= Vᵀ W + Wᵀ V
+    const std::size_t s = k + nb, ts = n - s;
+    Vt.assign(ts * nb, T{});
+    Wt.assign(ts * nb, T{});
+    for (std::size_t p = 0; p < nb; ++p)
+      for (std::size_t r = 0; r < ts; ++r) {
+        Vt[r * nb + p] = V[p * n + s + r];
+        Wt[r * nb + p] = W[p * n + s + r];
+      }
+    gemm_update(ts, ts, nb, T{-1}, Vt.data(), nb, W.data() + s, n, a + s * n + s, n);
+    gemm_update(ts, ts, nb, T{-1}, Wt.data(), nb, V.data() + s, n, a + s * n + s, n);
+  }
+  d[n - 1] = a[(n - 1) * n + n - 1];
+}
+
+/**
+ * @brief Overwrites the n x k matrix Z with `Q Z`, where Q is the product of the
+ * reflectors left in @p a by tridiagonalize().
+ *
+ * Reflectors are applied EIGEN_PANEL at a time in compact WY form,
+ * `H_b ... H_{b+nb-1} = I - V S Vᵀ` with S upper triangular, so every block
+ * costs two GEMMs.
+ */
+template <std::floating_point T>
+void apply_reflectors(std::size_t n, const T* a, const T* tau, std::size_t k, T* Z)
+{
+  std::vector<T> V, Vt, S, Y, vv;
+
+  for (std::size_t b1 = n - 1; b1 > 0;) {
+    const std::size_t b0 = b1 - std::min(b1, EIGEN_PANEL), nb = b1 - b0;
+    const std::size_t s = b0 + 1, m = n - s;
+
+    // Row p of V is v_{b0+p} on indices s..n-1
+    V.assign(nb * m, T{});
+    Vt.assign(m * nb, T{});
+    for (std::size_t p = 0; p < nb; ++p)
+      for (std::size_t c = b0 + p + 1; c < n; ++c)
+        Vt[(c - s) * nb + p] = V[p * m + c - s] = a[(b0 + p) * n + c];
+
+    // S[0:p, p] = -tau_p S[0:p, 0:p] (V[0:p] v_p), S[p][p] = tau_p
+    S.assign(nb * nb, T{});
+    vv.resize(nb);
+    for (std::size_t p = 0; p < nb; ++p) {
+      for (std::size_t q = 0; q < p; ++q)
+        vv[q] = dot(m, V.data() + q * m, V.data() + p * m);
+      for (std::size_t q = 0; q < p; ++q) {
+        T sum{};
+        for (std::size_t r = q; r < p; ++r) sum += S[q * nb + r] * vv[r];
+        S[q * nb + p] = -tau[b0 + p] * sum;
+      }
+      S[p * nb + p] = tau[b0 + p];
+    }
+
+    // Z[s:] -= Vᵀ (S (V Z[s:]))
+    Y.resize(nb * k);
+    gemm_blocked(nb, k, m, V.data(), Z + s * k, Y.data());
+    for (std::size_t q = 0; q < nb; ++q) {
+      scal(k, S[q * nb + q], Y.data() + q * k);
+      for (std::size_t r = q + 1; r < nb; ++r)
+        axpy(k, S[q * nb + r], Y.data() + r * k, Y.data() + q * k);
+    }
+    gemm_update(m, k, nb, T{-1}, Vt.data(), nb, Y.data(), k, Z + s * k, k);
+    b1 = b0;
+  }
+}
+
+/**
+ * @brief Reorders eigenvalues into ascending order, moving the matching columns
+ * of the @p n x @p n block @p U (row stride @p ldu) with them.
+ */
+template <std::floating_point T>
+void sort_eigenpairs(std::size_t n, T* d, T* U, std::size_t ldu)
+{
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return d[x] < d[y]; });
+
+  std::vector<T> values(n), row(n);
+  for (std::size_t i = 0; i < n; ++i) values[i] = d[order[i]];
+  std::copy(values.begin(), values.end(), d);
+  for (std::size_t r = 0; r < n; ++r) {
+    T* u = U + r * ldu;
+    for (std::size_t i = 0; i < n; ++i) row[i] = u[order[i]];
+    std::copy(row.begin(), row.end(), u);
+  }
+}
+
+/**
+ * @brief Solves the symmetric tridiagonal eigenproblem by implicit QL with
+ * Wilkinson shifts.
+ *
+ * @param d The n diagonal elements; overwritten by the eigenvalues.
+ * @param e The n-1 off-diagonal elements, followed by one element of workspace.
+ * @param U An n x n block (row stride @p ldu) set to the identity on entry;
+ * receives the eigenvectors as columns.
+ *
+ * @throws std::runtime_error If an eigenvalue fails to converge.
+ */
+template <std::floating_point T>
+void tridiagonal_ql(std::size_t n, T* d, T* e, T* U, std::size_t ldu)
+{
+  const T eps = std::numeric_limits<T>::epsilon();
+  e[n - 1] = T{};
+
+  for (std::size_t l = 0; l < n; ++l) {
+    for (std::size_t iter = 0;; ++iter) {
+      std::size_t m = l;
+      while (m + 1 < n && std::abs(e[m]) > eps * (std::abs(d[m]) + std::abs(d[m + 1]))) ++m;
+      if (m == l) break;
+      if (iter == 60)
+        throw std::runtime_error("Tridiagonal eigenvalue iteration did not converge.");
+
+      T g = (d[l + 1] - d[l]) / (2 * e[l]);
+      T r = std::hypot(g, T{1});
+      g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+      T s = 1, c = 1, p = 0;
+      bool underflow = false;
+      for (std::size_t i = m; i-- > l;) {
+        const T f = s * e[i], b = c * e[i];
+        r = std::hypot(f, g);
+        e[i + 1] = r;
+        if (r == T{}) {
+          d[i + 1] -= p;
+          e[m] = T{};
+          underflow = true;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = d[i + 1] - p;
+        r = (d[i] - g) * s + 2 * c * b;
+        p = s * r;
+        d[i + 1] = g + p;
+        g = c * r - b;
+        for (std::size_t k = 0; k < n; ++k) {
+          T* u = U + k * ldu;
+          const T t = u[i + 1];
+          u[i + 1] = s * u[i] + c * t;
+          u[i] = c * u[i] - s * t;
+        }
+      }
+      if (underflow) continue;
+      d[l] -= p;
+      e[l] = g;
+      e[m] = T{};
+    }
+  }
+  sort_eigenpairs(n, d, U, ldu);
+}
+
+/**
+ * @brief Finds root @p j of the secular equation
+ * `1 + rho Σ z_i² / (d_i - λ) = 0` for ascending, distinct @p d.
+ *
+ * The root is returned as the pair (o, mu) with `λ = d[o] + mu`, measured from
+ * the nearer pole so that the differences `d_i - λ` keep full relative accuracy.
+ * Safeguarded Newton steps are used, falling back to bisection whenever the
+ * bracket fails to halve.
+ */
+template <std::floating_point T>
+std::pair<std::size_t, T> secular_root(std::size_t K, const T* d, const T* z, T rho, std::size_t j)
+{
+  const T eps = std::numeric_limits<T>::epsilon();
+  auto secular = [&](std::size_t o, T mu, T& slope) {
+    T f = 1;
+    slope = 0;
+    for (std::size_t i = 0; i < K; ++i) {
+      const T t = z[i] / ((d[i] - d[o]) - mu);
+      f += rho * z[i] * t;
+      slope += rho * t * t;
+    }
+    return f;
+  };
+
+  std::size_t o = j;
+  T lo = 0, hi = rho;
+  if (j + 1 < K) {
+    const T gap = d[j + 1] - d[j];
+    T slope;
+    if (secular(j, gap / 2, slope) >= 0) {
+      hi = gap / 2;
+    } else {
+      o = j + 1;
+      lo = -gap / 2;
+      hi = 0;
+    }
+  }
+
+  T mu = (lo + hi) / 2, width = hi - lo;
+  for (std::size_t iter = 0; iter < 1000; ++iter) {
+    T slope;
+    const T f = secular(o, mu, slope);
+    if (f == T{}) break;
+    (f < 0 ? lo : hi) = mu;
+    const T next_width = hi - lo;
+    if (next_width <= 2 * eps * std::max(std::abs(lo), std::abs(hi))) {
+      mu = (lo + hi) / 2;
+      break;
+    }
+    const T newton = mu - f / slope;
+    mu = (next_width <= width / 2 && newton > lo && newton < hi) ? newton : (lo + hi) / 2;
+    width = next_width;
+  }
+  return {o, mu};
+}
+
+/**
+ * @brief Eigenvalues and eigenvectors of `diag(D) + rho z zᵀ` from those of the
+ * two halves, the merge step of divide and conquer.
+ *
+ * On entry the top-left m x m and bottom-right (n-m) x (n-m) blocks of @p U
+ * hold the eigenvectors of the halves, with their eigenvalues in @p d. Entries
+ * of z that are negligible, and pairs of nearly equal eigenvalues, are deflated
+ * (the latter after a rotation that zeros one z entry). The remaining
+ * eigenvalues are roots of the secular equation; their eigenvectors are formed
+ * from a recomputed z (Gu–Eisenstat), which keeps them numerically orthogonal,
+ * and mapped back with one GEMM.
+ */
+template <std::floating_point T>
+void merge_eigenpairs(std::size_t n, std::size_t m, T* d, T rho, T sign, T* U, std::size_t ldu)
+{
+  const T eps = std::numeric_limits<T>::epsilon();
+
+  // z = [last row of Q1, sign * first row of Q2] / √2, so rho z zᵀ keeps its value with |z| = 1
+  std::vector<T> z(n);
+  const T inv_sqrt2 = T{1} / std::sqrt(T{2});
+  for (std::size_t i = 0; i < m; ++i) z[i] = U[(m - 1) * ldu + i] * inv_sqrt2;
+  for (std::size_t i = m; i < n; ++i) z[i] = sign * U[m * ldu + i] * inv_sqrt2;
+  rho *= 2;
+
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t x, std::size_t y) { return d[x] < d[y]; });
+
+  // Solve the merge at unit scale, so that neither the secular sums nor the deflation test depend on ‖T‖
+  T scale = rho;
+  for (std::size_t i = 0; i < n; ++i) scale = std::max(scale, std::abs(d[i]));
+  if (scale == T{}) return;
+  scale = power_of_two_scale(scale);
+  for (std::size_t i = 0; i < n; ++i) d[i] /= scale;
+  rho /= scale;
+  const T tol = 8 * eps * std::max(T{1}, rho);
+
+  // Deflation, in ascending order of d
+  std::vector<std::size_t> kept, deflated;
+  std::size_t prev = n;
+  for (std::size_t i : order) {
+    if (rho * std::abs(z[i]) <= tol) {
+      deflated.push_back(i);
+      continue;
+    }
+    if (prev != n) {
+      const T r = std::hypot(z[prev], z[i]);
+      const T c = z[i] / r, s = -z[prev] / r;
+      if (std::abs((d[i] - d[prev]) * c * s) <= tol) {
+        // Rotate columns prev and i so that z[prev] vanishes
+        z[i] = r;
+        z[prev] = 0;
+        for (std::size_t k = 0; k < n; ++k) {
+          T* u = U + k * ldu;
+          const T up = u[prev], ui = u[i];
+          u[prev] = c * up + s * ui;
+          u[i] = c * ui - s * up;
+        }
+        const T dp = d[prev] * c * c + d[i] * s * s;
+        d[i] = d[prev] * s * s + d[i] * c * c;
+        d[prev] = dp;
+        deflated.push_back(prev);
+        prev = i;
+        continue;
+      }
+      kept.push_back(prev);
+    }
+    prev = i;
+  }
+  if (prev != n) kept.push_back(prev);
+
+  const std::size_t K = kept.size();
+  std::vector<T> values(n);
+  std::vector<T> vectors(n * n);
+
+  if (K > 0) {
+    std::vector<T> D(K), Z(K);
+    for (std::size_t i = 0; i < K; ++i) {
+      D[i] = d[kept[i]];
+      Z[i] = z[kept[i]];
+    }
+
+    std::vector<std::size_t> origin(K);
+    std::vector<T> mu(K);
+    parallel_for(0, K, 16, [&](std::size_t lo, std::size_t hi) {
+      for (std::size_t j = lo; j < hi; ++j)
+        std::tie(origin[j], mu[j]) = secular_root(K, D.data(), Z.data(), rho, j);
+    });
+
+    // λ_j - D_i, accurate because each root is stored relative to its nearer pole
+    auto shifted = [&](std::size_t j, std::size_t i) { return (D[origin[j]] - D[i]) + mu[j]; };
+
+    // Recompute z so the computed roots are exact eigenvalues of a nearby problem
+    std::vector<T> zhat(K);
+    parallel_for(0, K, 16, [&](std::size_t lo, std::size_t hi) {
+      for (std::size_t i = lo; i < hi; ++i) {
+        T w = shifted(i, i) / rho;
+        for (std::size_t j = 0; j < K; ++j)
+          if (j != i) w *= shifted(j, i) / (D[j] - D[i]);
+        zhat[i] = std::copysign(std::sqrt(std::abs(w)), Z[i]);
+      }
+    });
+
+    // Eigenvectors of the rank-one modified diagonal, normalized by column
+    std::vector<T> S(K * K);
+    parallel_for(0, K, 16, [&](std::size_t lo, std::size_t hi) {
+      for (std::size_t j = lo; j < hi; ++j) {
+        // Normalize relative to the largest entry, since s² can overflow near a pole
+        T largest = 0;
+        for (std::size_t i = 0; i < K; ++i) {
+          const T s = zhat[i] / -shifted(j, i);
+          S[i * K + j] = s;
+          largest = std::max(largest, std::abs(s));
+        }
+        T norm = 0;
+        for (std::size_t i = 0; i < K; ++i) {
+          S[i * K + j] /= largest;
+          norm += S[i * K + j] * S[i * K + j];
+        }
+        norm = T{1} / std::sqrt(norm);
+        for (std::size_t i = 0; i < K; ++i) S[i * K + j] *= norm;
+      }
+    });
+
+    std::vector<T> Q(n * K), QS(n * K);
+    for (std::size_t r = 0; r < n; ++r)
+      for (std::size_t j = 0; j < K; ++j) Q[r * K + j] = U[r * ldu + kept[j]];
+    gemm_blocked(n, K, K, Q.data(), S.data(), QS.data());
+
+    for (std::size_t j = 0; j < K; ++j) values[j] = D[origin[j]] + mu[j];
+    for (std::size_t r = 0; r < n; ++r)
+      std::copy(QS.begin() + r * K, QS.begin() + (r + 1) * K, vectors.begin() + r * n);
+  }
+
+  for (std::size_t j = 0; j < deflated.size(); ++j) {
+    values[K + j] = d[deflated[j]];
+    for (std::size_t r = 0; r < n; ++r) vectors[r * n + K + j] = U[r * ldu + deflated[j]];
+  }
+
+  for (std::size_t i = 0; i < n; ++i) d[i] = values[i] * scale;
+  for (std::size_t r = 0; r < n; ++r)
+    std::copy(vectors.begin() + r * n, vectors.begin() + (r + 1) * n, U + r * ldu);
+  sort_eigenpairs(n, d, U, ldu);
+}
+
+/**
+ * @brief Solves the symmetric tridiagonal eigenproblem by divide and conquer.
+ *
+ * T is split as `diag(T₁, T₂) + rho u uᵀ` by removing the middle off-diagonal
+ * element; the halves are solved recursively (concurrently when large) and
+ * merged by merge_eigenpairs(). Blocks of order EIGEN_DC_BASE or less go to
+ * tridiagonal_ql().
+ *
+ * @param d The n diagonal elements; overwritten by the ascending eigenvalues.
+ * @param e The n-1 off-diagonal elements followed by one element of workspace;
+ * overwritten.
+ * @param U An n x n block with row stride @p ldu; receives the eigenvectors as
+ * columns.
+ */
+template <std::floating_point T>
+void tridiagonal_eigen(std::size_t n, T* d, T* e, T* U, std::size_t ldu)
+{
+  for (std::size_t r = 0; r < n; ++r) {
+    std::fill_n(U + r * ldu, n, T{});
+    U[r * ldu + r] = T{1};
+  }
+  if (n <= EIGEN_DC_BASE) {
+    tridiagonal_ql(n, d, e, U, ldu);
+    return;
+  }
+
+  const std::size_t m = n / 2;
+  const T beta = e[m - 1];
+  const T rho = std::abs(beta);
+  d[m - 1] -= rho;
+  d[m] -= rho;
+
+  parallel_for(0, 2, n >= EIGEN_DC_PARALLEL ? 1 : 2, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t half = lo; half < hi; ++half) {
+      if (half == 0)
+        tridiagonal_eigen(m, d, e, U, ldu);
+      else
+        tridiagonal_eigen(n - m, d + m, e + m, U + m * ldu + m, ldu);
+    }
+  });
+
+  merge_eigenpairs(n, m, d, rho, beta < 0 ? T{-1} : T{1}, U, ldu);
+}
+
+/** Returns the number of eigenvalues of the tridiagonal (d, e) that are less than @p x. */
+template <std::floating_point T>
+std::size_t sturm_count(std::size_t n, const T* d, const T* e, T x, T pivmin)
+{
+  std::size_t count = 0;
+  T q = d[0] - x;
+  for (std::size_t i = 0;;) {
+    if (std::abs(q) < pivmin) q = -pivmin;
+    if (q < 0) ++count;
+    if (++i == n) break;
+    q = d[i] - x - e[i - 1] * e[i - 1] / q;
+  }
+  return count;
+}
+
+/**
+ * @brief Computes the eigenpairs of the tridiagonal (d, e) with ascending
+ * indices first..first+k-1, by bisection and inverse iteration.
+ *
+ * Each eigenvalue is isolated independently from Sturm counts. Each
+ * eigenvector takes a few steps of inverse iteration with a pivoted tridiagonal
+ * factorization; eigenvectors of clustered eigenvalues are reorthogonalized
+ * against each other. Costs O(nk) plus O(n k_c²) for clusters of size k_c.
+ *
+ * @param values Receives the k eigenvalues in ascending order.
+ * @param Z An n x k row-major matrix; receives the eigenvectors as columns.
+ */
+template <std::floating_point T>
+void tridiagonal_select(std::size_t n, const T* d, const T* e, std::size_t first, std::size_t k,
+    T* values, T* Z)
+{
+  const T eps = std::numeric_limits<T>::epsilon();
+
+  // Gershgorin bounds and the norm of T
+  T lower = d[0], upper = d[0], norm = 0, emax = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    const T radius = (i > 0 ? std::abs(e[i - 1]) : T{}) + (i + 1 < n ? std::abs(e[i]) : T{});
+    lower = std::min(lower, d[i] - radius);
+    upper = std::max(upper, d[i] + radius);
+    norm = std::max(norm, std::abs(d[i]) + radius);
+    if (i + 1 < n) emax = std::max(emax, e[i] * e[i]);
+  }
+  const T pivmin = std::numeric_limits<T>::min() * std::max(T{1}, emax);
+  // Tolerances are relative to ‖T‖; a zero T has every vector as an eigenvector at any scale
+  if (norm == T{}) norm = T{1};
+  const T slack = 2 * eps * norm * static_cast<T>(n);
+  lower -= slack;
+  upper += slack;
+
+  parallel_for(0, k, std::max<std::size_t>(1, 4096 / n), [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t j = lo; j < hi; ++j) {
+      T a = lower, b = upper;
+      while (b - a > 2 * eps * std::max(std::abs(a), std::abs(b)) + pivmin) {
+        const T mid = a + (b - a) / 2;
+        if (mid <= a || mid >= b) break;
+        (sturm_count(n, d, e, mid, pivmin) > first + j ? b : a) = mid;
+      }
+      values[j] = a + (b - a) / 2;
+    }
+  });
+
+  // Clusters of close eigenvalues share a reorthogonalization sweep
+  const T cluster_gap = T(1e-3) * norm;
+  std::vector<std::size_t> starts{0};
+  for (std::size_t j = 1; j < k; ++j)
+    if (values[j] - values[j - 1] > cluster_gap) starts.push_back(j);
+  starts.push_back(k);
+
+  parallel_for(0, starts.size() - 1, 1, [&](std::size_t lo, std::size_t hi) {
+    std::vector<T> u0(n), u1(n), u2(n), l(n), x(n), y(n);
+    std::vector<char> swapped(n);
+    std::vector<std::vector<T>> cluster;
+
+    for (std::size_t c = lo; c < hi; ++c) {
+      cluster.clear();
+      T shift_prev = 0;
+      for (std::size_t j = starts[c]; j < starts[c + 1]; ++j) {
+        // Keep coincident eigenvalues apart so their iterations differ
+        T shift = values[j];
+        if (j > starts[c] && shift - shift_prev < 10 * eps * norm)
+          shift = shift_prev + 10 * eps * norm;
+        shift_prev = shift;
+
+        // Factor T - shift I with partial pivoting
+        T cur_a = d[0] - shift, cur_b = n > 1 ? e[0] : T{};
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+          const T sub = e[i], next_a = d[i + 1] - shift, next_b = i + 2 < n ? e[i + 1] : T{};
+          if (std::abs(cur_a) >= std::abs(sub)) {
+            u0[i] = cur_a;
+            u1[i] = cur_b;
+            u2[i] = 0;
+            swapped[i] = 0;
+            l[i] = cur_a != T{} ? sub / cur_a : T{};
+            cur_a = next_a - l[i] * cur_b;
+            cur_b = next_b;
+          } else {
+            u0[i] = sub;
+            u1[i] = next_a;
+            u2[i] = next_b;
+            swapped[i] = 1;
+            l[i] = cur_a / sub;
+            cur_a = cur_b - l[i] * next_a;
+            cur_b = -l[i] * next_b;
+          }
+        }
+        u0[n - 1] = cur_a;
+        for (std::size_t i = 0; i < n; ++i)
+          if (std::abs(u0[i]) < eps * norm) u0[i] = std::copysign(eps * norm, u0[i]);
+
+        // Deterministic, well-spread start vector
+        for (std::size_t i = 0; i < n; ++i) x[i] = counter_uniform<T>(first + j, i) - T(0.5);
+
+        for (int iter = 0; iter < 4; ++iter) {
+          y = x;
+          for (std::size_t i = 0; i + 1 < n; ++i) {
+            if (swapped[i]) std::swap(y[i], y[i + 1]);
+            y[i + 1] -= l[i] * y[i];
+          }
+          for (std::size_t i = n; i-- > 0;) {
+            T s = y[i];
+            if (i + 1 < n) s -= u1[i] * y[i + 1];
+            if (i + 2 < n) s -= u2[i] * y[i + 2];
+            y[i] = s / u0[i];
+          }
+          for (const std::vector<T>& q : cluster) axpy(n, -dot(n, q.data(), y.data()), q.data(), y.data());
+          scal(n, T{1} / std::sqrt(dot(n, y.data(), y.data())), y.data());
+          std::swap(x, y);
+        }
+
+        for (std::size_t i = 0; i < n; ++i) Z[i * k + j] = x[i];
+        if (starts[c + 1] - starts[c] > 1) cluster.push_back(x);
+      }
+    }
+  });
+}
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief Eigendecomposition `A = V Λ Vᵀ` of a real symmetric matrix.
+ *
+ * @tparam T A floating-point element type.
+ *
+ * Only the lower triangle of A is read. Eigenvalues are returned in ascending
+ * order, and column j of eigenvectors() is a unit eigenvector for
+ * `eigenvalues()[j]`; the eigenvectors are mutually orthogonal.
+ *
+ * The reduction to tridiagonal form costs about (4/3)n³ and is shared by both
+ * constructors. The full decomposition then uses divide and conquer and a
+ * blocked back-transformation (about 4n³ more, almost all of it GEMM); asking
+ * for only k eigenpairs replaces this with O(nk) bisection and inverse iteration
+ * plus a 2n²k back-transformation.
+ */
+template <std::floating_point T>
+class SymmetricEigen {
+private:
+  std::vector<T> _values;
+  Matrix<T> _vectors;
+
+  /**
+   * Reduces the lower triangle of A, divided by the power of two just above its
+   * largest magnitude (returned in @p scale), so the tridiagonal solvers always see a matrix of unit norm;
+   * returns the reflectors as left by tridiagonalize().
+   */
+  static std::vector<T> reduce(const Matrix<T>& A, std::vector<T>& d, std::vector<T>& e, std::vector<T>& tau,
+      T& scale);
+
+public:
+  /**
+   * @brief Computes every eigenpair of @p A.
+   *
+   * @throws std::invalid_argument If @p A is not square.
+   * @throws std::runtime_error If the iteration fails to converge.
+   */
+  explicit SymmetricEigen(const Matrix<T>& A);
+
+  /**
+   * @brief Computes the @p k smallest or largest eigenpairs of @p A.
+   *
+   * @throws std::invalid_argument If @p A is not square, or @p k is zero or
+   * larger than the order of @p A.
+   */
+  SymmetricEigen(const Matrix<T>& A, std::size_t k, Spectrum which = Spectrum::Smallest);
+
+  /** Returns the computed eigenvalues in ascending order. */
+  const std::vector<T>& eigenvalues() const noexcept { return _values; }
+
+  /** Returns the computed eigenvectors as the columns of an n x k matrix. */
+  const Matrix<T>& eigenvectors() const noexcept { return _vectors; }
+};
+
+template <std::floating_point T>
+std::vector<T> SymmetricEigen<T>::reduce(const Matrix<T>& A, std::vector<T>& d, std::vector<T>& e, std::vector<T>& tau,
+    T& scale)
+{
+  if (A.rows() != A.cols())
+    throw std::invalid_argument("Eigendecomposition requires a square matrix.");
+
+  const std::size_t n = A.rows();
+  std::vector<T> a(A.data());
+  scale = T{};
+  for (std::size_t r = 0; r < n; ++r)
+    for (std::size_t c = 0; c <= r; ++c) scale = std::max(scale, std::abs(a[r * n + c]));
+  scale = scale == T{} ? T{1} : lin_alg::detail::power_of_two_scale(scale);
+
+  for (std::size_t r = 0; r < n; ++r) {
+    for (std::size_t c = 0; c <= r; ++c) a[r * n + c] /= scale;
+    for (std::size_t c = r + 1; c < n; ++c) a[r * n + c] = a[c * n + r] / scale;
+  }
+
+  d.assign(n, T{});
+  e.assign(n, T{});
+  tau.assign(n, T{});
+  lin_alg::detail::tridiagonalize(n, a.data(), d.data(), e.data(), tau.data());
+  return a;
+}
+
+template <std::floating_point T>
+SymmetricEigen<T>::SymmetricEigen(const Matrix<T>& A)
+  : _vectors(A.rows(), A.rows())
+{
+  std::vector<T> e, tau;
+  T scale;
+  const std::vector<T> a = reduce(A, _values, e, tau, scale);
+  const std::size_t n = A.rows();
+
+  T* v = _vectors.data().data();
+  lin_alg::detail::tridiagonal_eigen(n, _values.data(), e.data(), v, n);
+  lin_alg::detail::apply_reflectors(n, a.data(), tau.data(), n, v);
+  for (T& value : _values) value *= scale;
+}
+
+template <std::floating_point T>
+SymmetricEigen<T>::SymmetricEigen(const Matrix<T>& A, std::size_t k, Spectrum which)
+  : _vectors(A.rows(), std::max<std::size_t>(k, 1))
+{
+  if (k == 0 || k > A.rows())
+    throw std::invalid_argument("Number of eigenpairs must be between 1 and the matrix order.");
+
+  std::vector<T> d, e, tau;
+  T scale;
+  const std::vector<T> a = reduce(A, d, e, tau, scale);
+  const std::size_t n = A.rows();
+
+  T* v = _vectors.data().data();
+  _values.resize(k);
+  lin_alg::detail::tridiagonal_select(n, d.data(), e.data(), which == Spectrum::Smallest ? 0 : n - k, k,
+      _values.data(), v);
+  lin_alg::detail::apply_reflectors(n, a.data(), tau.data(), k, v);
+  for (T& value : _values) value *= scale;
+}
+
+#endif
@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef WOJI_TEXT_PARSING_HPP
+#define WOJI_TEXT_PARSING_HPP
+
+#include <lin_alg/Rational.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace lin_alg::detail {
+
+/** Returns true for horizontal whitespace (space, tab, carriage return). */
+inline bool is_blank(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+/** Advances @p p past horizontal whitespace, never past a newline. */
+inline const char* skip_blanks(const char* p, const char* end)
+{
+  while (p != end && is_blank(*p)) ++p;
+  return p;
+}
+
+/** Returns a pointer to the first character of the line following @p p. */
+inline const char* next_line(const char* p, const char* end)
+{
+  while (p != end && *p != '\n') ++p;
+  return p == end ? end : p + 1;
+}
+
+/**
+ * @brief Parses one arithmetic value starting at @p p with std::from_chars.
+ *
+ * A leading '+' is accepted. No whitespace is skipped.
+ *
+ * @return Pointer to the first character after the value.
+ * @throws std::runtime_error If no value could be parsed or it is out of range.
+ */
+template <typename T>
+  requires std::is_arithmetic_v<T>
+const char* parse_number(const char* p, const char* end, T& out)
+{
+  if (p != end && *p == '+') ++p;
+  auto [ptr, ec] = std::from_chars(p, end, out);
+  if (ec == std::errc::invalid_argument)
+    throw std::runtime_error("Malformed number: '" + std::string(p, std::min<std::size_t>(end - p, 32)) + "'");
+  if (ec == std::errc::result_out_of_range)
+    throw std::runtime_error("Number out of range: '" + std::string(p, ptr) + "'");
+  return ptr;
+}
+
+/**
+ * @brief Parses one matrix element starting at @p p.
+ *
+ * Arithmetic types are parsed with `parse_number()`. Rational values are
+ * written as `a/b` or as a plain integer `a`.
+ *
+ * @return Pointer to the first character after the value.
+ * @throws std::runtime_error If no value could be parsed.
+ * @throws std::invalid_argument If a rational has a zero denominator.
+ */
+template <typename T>
+const char* parse_value(const char* p, const char* end, T& out)
+{
+  if constexpr (std::is_same_v<T, Rational>) {
+    int num = 0, den = 1;
+    p = parse_number(p, end, num);
+    if (p != end && *p == '/')
+      p = parse_number(p + 1, end, den);
+    out = Rational(num, den);
+    return p;
+  } else {
+    return parse_number(p, end, out);
+  }
+}
+
+/**
+ * @brief Splits [begin, end) into at most @p parts pieces at line boundaries.
+ *
+ * @return Boundaries b such that piece i is [b[i], b[i + 1]). Every interior
+ * boundary is the first character of a line; the first is @p begin and the last
+ * is @p end.
+ */
+inline std::vector<const char*> split_lines(const char* begin, const char* end, std::size_t parts)
+{
+  std::vector<const char*> bounds{begin};
+  const std::size_t n = static_cast<std::size_t>(end - begin);
+  parts = std::max<std::size_t>(parts, 1);
+  for (std::size_t i = 1; i < parts; ++i) {
+    const char* p = std::max(begin + n * i / parts, bounds.back());
+    if (p != begin && p[-1] != '\n') p = next_line(p, end);
+    if (p != bounds.back() && p != end) bounds.push_back(p);
+  }
+  bounds.push_back(end);
+  return bounds;
+}
+
+} // namespace lin_alg::detail
+
+#endif
@@ -0,0 +1,300 @@
+#pragma once
+
+#ifndef WOJI_TRIANGULAR_HPP
+#define WOJI_TRIANGULAR_HPP
+
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixView.hpp>
+#include <lin_alg/Parallel.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @file Triangular.hpp
+ * @brief Triangular views with blocked triangular solve (TRSM) and multiply (TRMM).
+ */
+
+/** Which triangle of a square matrix holds the data. */
+enum class Uplo { Upper, Lower };
+
+/** Whether the diagonal is stored, or implied to be all ones. */
+enum class Diag { NonUnit, Unit };
+
+namespace lin_alg::detail {
+
+/** Order of the diagonal blocks used by the triangular kernels. */
+inline constexpr std::size_t TRIANGULAR_BLOCK = 64;
+
+/** Minimum number of right-hand-side columns handed to one thread in a diagonal-block solve. */
+inline constexpr std::size_t TRIANGULAR_COLUMN_GRAIN = 256;
+
+} // namespace lin_alg::detail
+
+/**
+ * @brief A read-only view of the upper or lower triangle of a square matrix.
+ *
+ * @tparam T Element type.
+ *
+ * Elements outside the triangle are never read, so they may hold anything (for
+ * example, the other factor of a packed LU). With Diag::Unit the diagonal is
+ * not read either and is taken to be all ones.
+ *
+ * Solves and products work on blocks of TRIANGULAR_BLOCK rows: diagonal blocks
+ * are handled by substitution sweeps over whole rows, and every off-diagonal
+ * block goes through the blocked, multithreaded GEMM kernel.
+ */
+template <typename T>
+class TriangularView {
+private:
+  MatrixView<const T> _a;
+  Uplo _uplo;
+  Diag _diag;
+
+  /** Coefficient (i, p) of the triangle, honoring an implied unit diagonal. */
+  T coefficient(std::size_t i, std::size_t p) const
+  {
+    return (i == p && _diag == Diag::Unit) ? T{1} : _a.data()[i * _a.stride() + p];
+  }
+
+public:
+  /**
+   * @brief Views the @p uplo triangle of @p a.
+   *
+   * @throws std::invalid_argument If @p a is not square.
+   */
+  constexpr TriangularView(MatrixView<const T> a, Uplo uplo, Diag diag = Diag::NonUnit)
+    : _a(a), _uplo(uplo), _diag(diag)
+  {
+    if (a.rows() != a.cols())
+      throw std::invalid_argument("A triangular matrix must be square.");
+  }
+
+  /** Returns the order of the matrix. */
+  constexpr std::size_t size() const noexcept { return _a.rows(); }
+  /** Returns which triangle is viewed. */
+  constexpr Uplo uplo() const noexcept { return _uplo; }
+  /** Returns whether the diagonal is implied to be all ones. */
+  constexpr Diag diag() const noexcept { return _diag; }
+
+  /**
+   * @brief Returns the element at (r, c): zero outside the triangle, one on an
+   * implied unit diagonal.
+   *
+   * @throws std::out_of_range If @p r or @p c is outside the valid range.
+   */
+  constexpr T at(std::size_t r, std::size_t c) const
+  {
+    if (r >= size() || c >= size())
+      throw std::out_of_range("Requested position outside of matrix dimensions.");
+    if (_uplo == Uplo::Upper ? r > c : r < c) return T{};
+    if (r == c && _diag == Diag::Unit) return T{1};
+    return _a.at(r, c);
+  }
+
+  /** Copies the triangle into a dense matrix with explicit zeros (and ones). */
+  Matrix<T> to_matrix() const;
+
+  /**
+   * @brief Solves A X = B in place, overwriting @p B with X (TRSM).
+   *
+   * @throws std::invalid_argument If B.rows() differs from size().
+   * @throws std::runtime_error If a stored diagonal element is zero.
+   */
+  void solve_in_place(MatrixView<T> B) const;
+
+  /**
+   * @brief Solves A X = B for every column of B at once (TRSM).
+   *
+   * @throws std::invalid_argument If B.rows() differs from size().
+   * @throws std::runtime_error If a stored diagonal element is zero.
+   */
+  Matrix<T> solve(const Matrix<T>& B) const;
+
+  /**
+   * @brief Solves A x = b by substitution.
+   *
+   * @throws std::invalid_argument If @p b has the wrong size.
+   * @throws std::runtime_error If a stored diagonal element is zero.
+   */
+  std::vector<T> solve(std::span<const T> b) const;
+
+  /**
+   * @brief Computes A B (TRMM), touching only the stored triangle of A.
+   *
+   * @throws std::invalid_argument If B.rows() differs from size().
+   */
+  Matrix<T> multiply(const Matrix<T>& B) const;
+
+  /**
+   * @brief Computes A x.
+   *
+   * @throws std::invalid_argument If @p x has the wrong size.
+   */
+  std::vector<T> multiply(std::span<const T> x) const;
+};
+
+/** Views the upper triangle of @p a. */
+template <typename T>
+constexpr TriangularView<T> upper_triangular(const Matrix<T>& a, Diag diag = Diag::NonUnit)
+{
+  return TriangularView<T>(a.view(), Uplo::Upper, diag);
+}
+
+/** Views the lower triangle of @p a. */
+template <typename T>
+constexpr TriangularView<T> lower_triangular(const Matrix<T>& a, Diag diag = Diag::NonUnit)
+{
+  return TriangularView<T>(a.view(), Uplo::Lower, diag);
+}
+
+// ==============================================================================
+// Conversion Definitions
+// ==============================================================================
+
+template <typename T>
+Matrix<T> TriangularView<T>::to_matrix() const
+{
+  Matrix<T> m(size(), size());
+  for (std::size_t r = 0; r < size(); ++r)
+    for (std::size_t c = 0; c < size(); ++c)
+      m.at(r, c) = at(r, c);
+  return m;
+}
+
+// ==============================================================================
+// Solve Definitions
+// ==============================================================================
+
+template <typename T>
+void TriangularView<T>::solve_in_place(MatrixView<T> B) const
+{
+  using namespace lin_alg::detail;
+  const std::size_t n = size();
+  if (B.rows() != n)
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+  if (_diag == Diag::NonUnit)
+    for (std::size_t i = 0; i < n; ++i)
+      if (_a.data()[i * _a.stride() + i] == T{})
+        throw std::runtime_error("Cannot solve with a singular matrix.");
+
+  const std::size_t m = B.cols();
+  const std::size_t lda = _a.stride(), ldb = B.stride();
+  const T* a = _a.data();
+  T* b = B.data();
+
+  // Substitution within diagonal block [k0, k1); columns are independent
+  auto diagonal_block = [&](std::size_t k0, std::size_t k1) {
+    parallel_for(0, m, TRIANGULAR_COLUMN_GRAIN, [&](std::size_t lo, std::size_t hi) {
+      const std::size_t w = hi - lo;
+      if (_uplo == Uplo::Lower) {
+        for (std::size_t i = k0; i < k1; ++i) {
+          for (std::size_t p = k0; p < i; ++p)
+            axpy(w, -a[i * lda + p], b + p * ldb + lo, b + i * ldb + lo);
+          if (_diag == Diag::NonUnit) scal(w, T{1} / a[i * lda + i], b + i * ldb + lo);
+        }
+      } else {
+        for (std::size_t i = k1; i-- > k0;) {
+          for (std::size_t p = i + 1; p < k1; ++p)
+            axpy(w, -a[i * lda + p], b + p * ldb + lo, b + i * ldb + lo);
+          if (_diag == Diag::NonUnit) scal(w, T{1} / a[i * lda + i], b + i * ldb + lo);
+        }
+      }
+    });
+  };
+
+  if (_uplo == Uplo::Lower) {
+    for (std::size_t k0 = 0; k0 < n; k0 += TRIANGULAR_BLOCK) {
+      const std::size_t k1 = std::min(n, k0 + TRIANGULAR_BLOCK);
+      diagonal_block(k0, k1);
+      // B[k1:n] -= A[k1:n, k0:k1] X[k0:k1]
+      gemm_update(n - k1, m, k1 - k0, -T{1}, a + k1 * lda + k0, lda, b + k0 * ldb, ldb, b + k1 * ldb, ldb);
+    }
+  } else {
+    for (std::size_t k1 = n; k1 > 0;) {
+      const std::size_t k0 = k1 - std::min(k1, TRIANGULAR_BLOCK);
+      diagonal_block(k0, k1);
+      // B[0:k0] -= A[0:k0, k0:k1] X[k0:k1]
+      gemm_update(k0, m, k1 - k0, -T{1}, a + k0, lda, b + k0 * ldb, ldb, b, ldb);
+      k1 = k0;
+    }
+  }
+}
+
+template <typename T>
+Matrix<T> TriangularView<T>::solve(const Matrix<T>& B) const
+{
+  Matrix<T> X(B);
+  solve_in_place(X.view());
+  return X;
+}
+
+template <typename T>
+std::vector<T> TriangularView<T>::solve(std::span<const T> b) const
+{
+  if (b.size() != size())
+    throw std::invalid_argument("Vector must have the same number of rows as the matrix!");
+
+  Matrix<T> x(size(), 1, std::vector<T>(b.begin(), b.end()));
+  solve_in_place(x.view());
+  return std::move(x.data());
+}
+
+// ==============================================================================
+// Multiply Definitions
+// ==============================================================================
+
+template <typename T>
+Matrix<T> TriangularView<T>::multiply(const Matrix<T>& B) const
+{
+  using namespace lin_alg::detail;
+  const std::size_t n = size();
+  if (B.rows() != n)
+    throw std::invalid_argument("Matrix sizes are mismatched!");
+
+  const std::size_t m = B.cols();
+  const std::size_t lda = _a.stride();
+  const T* a = _a.data();
+  const T* b = B.data().data();
+  Matrix<T> C(n, m);
+  T* c = C.data().data();
+
+  // Every block row of C is independent
+  const std::size_t blocks = (n + TRIANGULAR_BLOCK - 1) / TRIANGULAR_BLOCK;
+  parallel_for(0, blocks, 1, [&](std::size_t lo, std::size_t hi) {
+    for (std::size_t blk = lo; blk < hi; ++blk) {
+      const std::size_t k0 = blk * TRIANGULAR_BLOCK;
+      const std::size_t k1 = std::min(n, k0 + TRIANGULAR_BLOCK);
+
+      // Off-diagonal part of the block row
+      if (_uplo == Uplo::Lower)
+        gemm_acc(k1 - k0, m, k0, T{1}, a + k0 * lda, lda, b, m, c + k0 * m, m);
+      else
+        gemm_acc(k1 - k0, m, n - k1, T{1}, a + k0 * lda + k1, lda, b + k1 * m, m, c + k0 * m, m);
+
+      // Triangular diagonal block
+      for (std::size_t i = k0; i < k1; ++i) {
+        const std::size_t p0 = _uplo == Uplo::Lower ? k0 : i;
+        const std::size_t p1 = _uplo == Uplo::Lower ? i + 1 : k1;
+        for (std::size_t p = p0; p < p1; ++p)
+          axpy(m, coefficient(i, p), b + p * m, c + i * m);
+      }
+    }
+  });
+  return C;
+}
+
+template <typename T>
+std::vector<T> TriangularView<T>::multiply(std::span<const T> x) const
+{
+  if (x.size() != size())
+    throw std::invalid_argument("Vector must have the same number of columns as the matrix!");
+  return std::move(multiply(Matrix<T>(size(), 1, std::vector<T>(x.begin(), x.end()))).data());
+}
+
+#endif
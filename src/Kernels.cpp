@@ -0,0 +1,8 @@
+#include <lin_alg/Kernels.hpp>
+#include <lin_alg/Rational.hpp>
+
+// Explicit instantiations for the run-time kernels declared `extern template` in
+// Kernels.hpp when LIN_ALG_KERNELS is defined.
+LIN_ALG_KERNEL_INSTANTIATIONS(, double)
+LIN_ALG_KERNEL_INSTANTIATIONS(, float)
+LIN_ALG_KERNEL_INSTANTIATIONS(, Rational)
@@ -0,0 +1,69 @@
+#pragma once
+
+#ifndef WOJI_TEST_UTILS_HPP
+#define WOJI_TEST_UTILS_HPP
+
+#include <lin_alg/Matrix.hpp>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file TestUtils.hpp
+ * @brief Reproducible random fixtures shared by the tests.
+ *
+ * Every value is the next draw of a 64-bit LCG, uniform in [-0.5, 0.5), so a
+ * fixture is fully determined by its shape and seed.
+ */
+
+namespace test_utils {
+
+/** Advances @p seed and returns a uniform value in [-0.5, 0.5). */
+inline double next_uniform(std::uint64_t& seed)
+{
+  seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+  return static_cast<double>(seed >> 11) * 0x1.0p-53 - 0.5;
+}
+
+/** An m x n matrix of uniform entries, filled in row-major order. */
+template <typename T = double>
+Matrix<T> random_matrix(std::size_t m, std::size_t n, std::uint64_t seed)
+{
+  Matrix<T> A(m, n);
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t j = 0; j < n; ++j) A.at(i, j) = static_cast<T>(next_uniform(seed));
+  return A;
+}
+
+/** An n x n symmetric matrix of uniform entries, filled from the lower triangle. */
+inline Matrix<double> random_symmetric(std::size_t n, std::uint64_t seed)
+{
+  Matrix<double> A(n, n);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j <= i; ++j) A.at(i, j) = A.at(j, i) = next_uniform(seed);
+  return A;
+}
+
+/** A vector of @p n uniform entries. */
+inline std::vector<double> random_vector(std::size_t n, std::uint64_t seed)
+{
+  std::vector<double> v(n);
+  for (double& x : v) x = next_uniform(seed);
+  return v;
+}
+
+/** A vector of @p n complex entries with uniform real and imaginary parts. */
+inline std::vector<std::complex<double>> random_signal(std::size_t n, std::uint64_t seed)
+{
+  std::vector<std::complex<double>> v(n);
+  for (auto& z : v) {
+    const double re = next_uniform(seed);
+    z = {re, next_uniform(seed)};
+  }
+  return v;
+}
+
+} // namespace test_utils
+
+#endif
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <lin_alg/CirculantMatrix.hpp>
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/StructuredMatrix.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+static_assert(LinearOperator<CirculantMatrix<double>>);
+
+namespace {
+
+using test_utils::random_vector;
+
+/** Largest entry of |A x - b| for a dense A. */
+double residual(const Matrix<double>& A, const std::vector<double>& x, const std::vector<double>& b)
+{
+  double worst = 0;
+  for (size_t i = 0; i < A.rows(); ++i) {
+    double sum = -b[i];
+    for (size_t j = 0; j < A.cols(); ++j) sum += A.at(i, j) * x[j];
+    worst = std::max(worst, std::abs(sum));
+  }
+  return worst;
+}
+
+} // namespace
+
+TEST(CirculantMatrixTest, Layout_AndDense)
+{
+  std::vector<double> col = {1, 2, 3, 4};
+  CirculantMatrix<double> c(col);
+
+  EXPECT_EQ(c.rows(), 4u);
+  EXPECT_EQ(c.cols(), 4u);
+  EXPECT_EQ(c.to_dense(), Matrix<double>({
+    {1, 4, 3, 2},
+    {2, 1, 4, 3},
+    {3, 2, 1, 4},
+    {4, 3, 2, 1}
+  }));
+  EXPECT_EQ(c.at(0, 1), 4);
+  EXPECT_THROW(c.at(4, 0), std::out_of_range);
+  EXPECT_THROW(CirculantMatrix<double>(std::vector<double>{}), std::invalid_argument);
+
+  // λ₀ is the column sum
+  EXPECT_NEAR(c.eigenvalues()[0].real(), 10.0, 1e-14);
+}
+
+TEST(CirculantMatrixTest, Product_MatchesDense)
+{
+  for (size_t n : {1, 7, 64, 300}) {
+    const CirculantMatrix<double> c(random_vector(n, n));
+    const std::vector<double> x = random_vector(n, 2 * n);
+    const std::vector<double> y = c * std::span<const double>(x);
+    std::vector<double> expected(n);
+    c.to_dense().apply(x, expected);
+    for (size_t i = 0; i < n; ++i) EXPECT_NEAR(y[i], expected[i], 1e-12) << "n = " << n;
+  }
+
+  const CirculantMatrix<double> c(random_vector(5, 1));
+  std::vector<double> wrong(4);
+  EXPECT_THROW(c * std::span<const double>(wrong), std::invalid_argument);
+}
+
+TEST(CirculantMatrixTest, CirculantProduct_MatchesDense)
+{
+  const CirculantMatrix<double> a(random_vector(30, 3)), b(random_vector(30, 4));
+  const Matrix<double> product = (a * b).to_dense();
+  const Matrix<double> expected = a.to_dense() * b.to_dense();
+  for (size_t i = 0; i < 30; ++i)
+    for (size_t j = 0; j < 30; ++j) EXPECT_NEAR(product.at(i, j), expected.at(i, j), 1e-13);
+
+  EXPECT_THROW(a * CirculantMatrix<double>(random_vector(31, 5)), std::invalid_argument);
+}
+
+TEST(CirculantMatrixTest, Solve)
+{
+  const size_t n = 250;
+  std::vector<double> col = random_vector(n, 6);
+  col[0] = 4.0;
+  const CirculantMatrix<double> c(col);
+  const std::vector<double> b = random_vector(n, 7);
+  EXPECT_LT(residual(c.to_dense(), c.solve(b), b), 1e-12);
+
+  // (1, -1, 0, 0) annihilates the constant vector
+  std::vector<double> singular = {1, -1, 0, 0};
+  std::vector<double> rhs = {1, 0, 0, 0};
+  EXPECT_THROW(CirculantMatrix<double>(singular).solve(rhs), std::runtime_error);
+}
+
+TEST(CirculantMatrixTest, Preconditioner_IsTChanOptimal)
+{
+  std::vector<double> col = {4, 1, 2};
+  std::vector<double> row = {4, 3, 5};
+  const CirculantMatrix<double> m = CirculantMatrix<double>::preconditioner(ToeplitzMatrix<double>(col, row));
+
+  // c₁ = (2 t₁ + t₋₂) / 3, c₂ = (t₂ + 2 t₋₁) / 3
+  EXPECT_NEAR(m.column()[0], 4.0, 1e-15);
+  EXPECT_NEAR(m.column()[1], 7.0 / 3.0, 1e-15);
+  EXPECT_NEAR(m.column()[2], 8.0 / 3.0, 1e-15);
+
+  std::vector<double> wide = {4, 3, 5, 6};
+  EXPECT_THROW(CirculantMatrix<double>::preconditioner(ToeplitzMatrix<double>(col, wide)), std::invalid_argument);
+}
+
+TEST(CirculantMatrixTest, PreconditionedSolve_SymmetricPositiveDefiniteToeplitz)
+{
+  // t_k = 1 / (1 + k²) plus a small shift: symmetric positive definite, smooth symbol
+  const size_t n = 1000;
+  std::vector<double> t(n);
+  for (size_t k = 0; k < n; ++k) t[k] = 1.0 / (1.0 + static_cast<double>(k * k));
+  t[0] += 0.1;
+  const ToeplitzMatrix<double> A(t, t);
+
+  const std::vector<double> b = random_vector(n, 8);
+  const std::vector<double> x = preconditioned_solve(A, std::span<const double>(b));
+  const std::vector<double> back = A * std::span<const double>(x);
+  for (size_t i = 0; i < n; ++i) EXPECT_NEAR(back[i], b[i], 1e-10);
+
+  const std::vector<double> zero(n);
+  for (double v : preconditioned_solve(A, std::span<const double>(zero))) EXPECT_EQ(v, 0.0);
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Csv.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+TEST(CsvTest, ParsesCommaSeparated)
+{
+  auto m = parse_csv<double>("1, 2.5, -3\n4,5e2,+6\n");
+
+  Matrix<double> expected({
+    {1, 2.5, -3},
+    {4, 500, 6}
+  });
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(CsvTest, SkipsHeaderAndBlankLines_HandlesCrlf)
+{
+  auto m = parse_csv<int>("a,b\r\n\r\n1,2\r\n\n3,4", {',', 1});
+
+  Matrix<int> expected({
+    {1, 2},
+    {3, 4}
+  });
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(CsvTest, WhitespaceDelimiter_CollapsesRuns)
+{
+  auto m = parse_csv<int>("  1   2\t3\n4 5 6  \n", {' '});
+
+  Matrix<int> expected({
+    {1, 2, 3},
+    {4, 5, 6}
+  });
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(CsvTest, ParsesRationals)
+{
+  auto m = parse_csv<Rational>("1/2,3\n-4/6,0\n");
+
+  Matrix<Rational> expected({
+    {Rational(1, 2), Rational(3)},
+    {Rational(-2, 3), Rational(0)}
+  });
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(CsvTest, RaggedRows_Throws)
+{
+  EXPECT_THROW(parse_csv<int>("1,2\n3\n"), std::runtime_error);
+  EXPECT_THROW(parse_csv<int>("1,2\n3,4,5\n"), std::runtime_error);
+}
+
+TEST(CsvTest, MalformedValue_Throws)
+{
+  EXPECT_THROW(parse_csv<double>("1,x\n"), std::runtime_error);
+  EXPECT_THROW(parse_csv<int>("1;2\n"), std::runtime_error);
+}
+
+TEST(CsvTest, TrailingDelimiter_Throws)
+{
+  EXPECT_THROW(parse_csv<int>("1,2,\n3,4,\n"), std::runtime_error);
+  EXPECT_THROW(parse_csv<int>("1,2\n3, \n"), std::runtime_error);
+}
+
+TEST(CsvTest, Errors_ReportOneBasedLineNumbers)
+{
+  auto message = [](std::string_view text, const CsvOptions& opts = {}) {
+    try {
+      parse_csv<int>(text, opts);
+    } catch (const std::runtime_error& e) {
+      return std::string(e.what());
+    }
+    return std::string();
+  };
+
+  EXPECT_EQ(message("1,x\n").rfind("Line 1: ", 0), 0u);
+  EXPECT_EQ(message("a,b\n\n1,2\n3,4\n\n5\n", {',', 1}).rfind("Line 6: ", 0), 0u);
+  EXPECT_EQ(message("1,2\n3,4,\n").rfind("Line 2: ", 0), 0u);
+}
+
+TEST(CsvTest, ZeroDenominator_ReportsLineNumber)
+{
+  try {
+    parse_csv<Rational>("1/2,3\n4,5/0\n");
+    FAIL() << "Expected a zero denominator to be rejected.";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()).rfind("Line 2: ", 0), 0u);
+  }
+  EXPECT_THROW(parse_csv<Rational>("1/0\n"), std::runtime_error);
+}
+
+TEST(CsvTest, Empty_Throws)
+{
+  EXPECT_THROW(parse_csv<int>("\n\n"), std::invalid_argument);
+}
+
+TEST(CsvTest, ReadFile_LargeInput_ParsedInChunks)
+{
+  const std::size_t rows = 200000;
+  const auto path = std::filesystem::temp_directory_path() / "lin_alg_csv_test.csv";
+  {
+    std::ofstream os(path);
+    for (std::size_t r = 0; r < rows; ++r)
+      os << r << ',' << r * 2 << ',' << r % 7 << '\n';
+  }
+
+  auto m = read_csv<long>(path);
+  std::filesystem::remove(path);
+
+  ASSERT_EQ(m.rows(), rows);
+  ASSERT_EQ(m.cols(), 3u);
+  for (std::size_t r = 0; r < rows; r += 7919) {
+    EXPECT_EQ(m.at(r, 0), static_cast<long>(r));
+    EXPECT_EQ(m.at(r, 1), static_cast<long>(2 * r));
+    EXPECT_EQ(m.at(r, 2), static_cast<long>(r % 7));
+  }
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <lin_alg/FFT.hpp>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_signal;
+
+/** The O(n²) definition, accumulated in long double. */
+std::vector<std::complex<double>> naive_dft(const std::vector<std::complex<double>>& x)
+{
+  const size_t n = x.size();
+  std::vector<std::complex<double>> X(n);
+  for (size_t k = 0; k < n; ++k) {
+    std::complex<long double> sum = 0;
+    for (size_t j = 0; j < n; ++j) {
+      const long double angle = -2.0L * std::numbers::pi_v<long double> * static_cast<long double>((j * k) % n) / n;
+      sum += std::complex<long double>(x[j]) * std::complex<long double>(std::cos(angle), std::sin(angle));
+    }
+    X[k] = std::complex<double>(sum);
+  }
+  return X;
+}
+
+double max_difference(const std::vector<std::complex<double>>& a, const std::vector<std::complex<double>>& b)
+{
+  double worst = 0;
+  for (size_t i = 0; i < a.size(); ++i) worst = std::max(worst, std::abs(a[i] - b[i]));
+  return worst;
+}
+
+} // namespace
+
+TEST(FFTTest, MatchesNaiveDFT_AcrossFactorizations)
+{
+  // Powers of two and four, radix 3, generic primes, Bluestein (97, 2 * 127) and mixed lengths
+  for (size_t n : {1, 2, 3, 4, 5, 7, 8, 12, 16, 60, 64, 97, 210, 254, 343, 1000, 1024}) {
+    const auto x = random_signal(n, n);
+    const double scale = std::sqrt(static_cast<double>(n));
+    EXPECT_LT(max_difference(fft(x), naive_dft(x)), 1e-13 * scale * std::log2(2.0 * n)) << "n = " << n;
+  }
+}
+
+TEST(FFTTest, InverseRoundTrips)
+{
+  for (size_t n : {1, 6, 61, 67, 128, 1536, 4099}) {
+    const auto x = random_signal(n, 100 + n);
+    EXPECT_LT(max_difference(ifft(fft(x)), x), 1e-13) << "n = " << n;
+  }
+}
+
+TEST(FFTTest, KnownTransforms)
+{
+  // An impulse transforms to a constant, a constant to a scaled impulse
+  std::vector<std::complex<double>> impulse(8);
+  impulse[0] = 1;
+  for (const auto& z : fft(impulse)) EXPECT_NEAR(std::abs(z - 1.0), 0.0, 1e-15);
+
+  std::vector<std::complex<float>> ones(6, 1.0f);
+  const auto spike = fft(ones);
+  EXPECT_NEAR(spike[0].real(), 6.0f, 1e-5f);
+  for (size_t k = 1; k < 6; ++k) EXPECT_NEAR(std::abs(spike[k]), 0.0f, 1e-5f);
+}
+
+TEST(FFTTest, PlansAreCached)
+{
+  const auto a = lin_alg::detail::fft_plan<double>(360);
+  const auto b = lin_alg::detail::fft_plan<double>(360);
+  EXPECT_EQ(a.get(), b.get());
+  EXPECT_EQ(a->size(), 360u);
+  EXPECT_NE(a.get(), lin_alg::detail::fft_plan<double>(361).get());
+
+  EXPECT_THROW(fft(std::vector<std::complex<double>>{}), std::invalid_argument);
+}
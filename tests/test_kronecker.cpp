@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Kronecker.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+static_assert(LinearOperator<KroneckerMatrix<double>>);
+
+namespace {
+
+Matrix<double> filled(size_t rows, size_t cols, double seed)
+{
+  Matrix<double> m(rows, cols);
+  for (size_t i = 0; i < rows; ++i)
+    for (size_t j = 0; j < cols; ++j)
+      m.at(i, j) = static_cast<double>((i * 7 + j * 3 + static_cast<size_t>(seed)) % 11) - 5 + (i == j ? 12 : 0);
+  return m;
+}
+
+std::vector<double> dense_apply(const Matrix<double>& K, const std::vector<double>& x)
+{
+  std::vector<double> y(K.rows(), 0);
+  for (size_t i = 0; i < K.rows(); ++i)
+    for (size_t j = 0; j < K.cols(); ++j)
+      y[i] += K.at(i, j) * x[j];
+  return y;
+}
+
+} // namespace
+
+TEST(KroneckerTest, Kron_SmallExample)
+{
+  Matrix<int> A({{1, 2}, {3, 4}});
+  Matrix<int> B({{0, 5}, {6, 7}});
+
+  Matrix<int> expected({
+    { 0,  5,  0, 10},
+    { 6,  7, 12, 14},
+    { 0, 15,  0, 20},
+    {18, 21, 24, 28}
+  });
+  EXPECT_EQ(kron(A, B), expected);
+}
+
+TEST(KroneckerTest, Apply_MatchesDense)
+{
+  KroneckerMatrix<double> K(filled(3, 4, 1), filled(5, 2, 2));
+  ASSERT_EQ(K.rows(), 15u);
+  ASSERT_EQ(K.cols(), 8u);
+
+  std::vector<double> x(8);
+  for (size_t i = 0; i < x.size(); ++i) x[i] = static_cast<double>(i) - 3.5;
+
+  const auto expected = dense_apply(K.to_dense(), x);
+  const auto actual = K.apply(x);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 1e-10);
+
+  // Into caller storage, reused across calls
+  std::vector<double> y(15, 99.0);
+  K.apply(x, y);
+  EXPECT_EQ(y, actual);
+  K.apply(x, y);
+  EXPECT_EQ(y, actual);
+}
+
+TEST(KroneckerTest, Apply_WideFactor_MatchesDense)
+{
+  // B wider than one apply tile, with enough work to run threaded
+  KroneckerMatrix<double> K(filled(12, 9, 4), filled(7, 150, 6));
+
+  std::vector<double> x(K.cols());
+  for (size_t i = 0; i < x.size(); ++i) x[i] = std::sin(static_cast<double>(i));
+
+  const auto expected = dense_apply(K.to_dense(), x);
+  const auto actual = K.apply(x);
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], 1e-9);
+}
+
+TEST(KroneckerTest, Solve_InvertsApply)
+{
+  KroneckerMatrix<double> K(filled(6, 6, 3), filled(4, 4, 5));
+
+  std::vector<double> x(24);
+  for (size_t i = 0; i < x.size(); ++i) x[i] = 1.0 / static_cast<double>(i + 1);
+
+  const auto b = K.apply(x);
+  const auto solved = K.solve(b);
+  for (size_t i = 0; i < x.size(); ++i)
+    EXPECT_NEAR(solved[i], x[i], 1e-10);
+
+  // Agrees with the dense solver
+  const auto dense = *K.to_dense().solution(b);
+  for (size_t i = 0; i < x.size(); ++i)
+    EXPECT_NEAR(solved[i], dense[i], 1e-10);
+}
+
+TEST(KroneckerTest, Solve_ConcurrentFirstCalls)
+{
+  const KroneckerMatrix<double> K(filled(5, 5, 2), filled(3, 3, 7));
+  std::vector<double> b(15);
+  for (size_t i = 0; i < b.size(); ++i) b[i] = static_cast<double>(i) - 7;
+
+  std::vector<double> first, second;
+  std::thread t([&] { first = K.solve(b); });
+  second = K.solve(b);
+  t.join();
+  EXPECT_EQ(first, second);
+
+  // Copies share the factorization
+  const KroneckerMatrix<double> copy = K;
+  EXPECT_EQ(copy.solve(b), first);
+}
+
+TEST(KroneckerTest, Invalid_Throws)
+{
+  KroneckerMatrix<double> rect(filled(2, 3, 0), filled(2, 2, 0));
+  EXPECT_THROW(rect.apply(std::vector<double>(5)), std::invalid_argument);
+  std::vector<double> x(6), short_y(3);
+  EXPECT_THROW(rect.apply(x, short_y), std::invalid_argument);
+  EXPECT_THROW(rect.solve(std::vector<double>(4)), std::invalid_argument);
+
+  KroneckerMatrix<double> singular(Matrix<double>({{1, 2}, {2, 4}}), filled(2, 2, 0));
+  EXPECT_THROW(singular.solve(std::vector<double>(4)), std::runtime_error);
+}
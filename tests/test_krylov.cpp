@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Krylov.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/SparseMatrix.hpp>
+#include <lin_alg/SymmetricEigen.hpp>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_matrix;
+
+/** Tridiagonal matrix with diagonal i + 1 and off-diagonals 0.5. */
+SparseMatrix<double> tridiagonal(size_t n)
+{
+  std::vector<Triplet<double>> entries;
+  for (size_t i = 0; i < n; ++i) {
+    entries.push_back({i, i, static_cast<double>(i + 1)});
+    if (i + 1 < n) {
+      entries.push_back({i, i + 1, 0.5});
+      entries.push_back({i + 1, i, 0.5});
+    }
+  }
+  return SparseMatrix<double>::from_triplets(n, n, entries);
+}
+
+/** Path-graph Laplacian, with eigenvalues 2 - 2 cos(π j / n). */
+Matrix<double> path_laplacian(size_t n)
+{
+  Matrix<double> L(n, n);
+  for (size_t i = 0; i < n; ++i) {
+    L.at(i, i) = (i == 0 || i + 1 == n) ? 1.0 : 2.0;
+    if (i + 1 < n) L.at(i, i + 1) = L.at(i + 1, i) = -1.0;
+  }
+  return L;
+}
+
+/** Largest entry of |A X - X Λ| for real eigenpairs, plus unit-norm checks. */
+template <LinearOperator Op>
+void expect_eigenpairs(const Op& A, const LanczosResult<double>& r, double tol)
+{
+  const size_t n = A.rows(), k = r.eigenvalues.size();
+  ASSERT_EQ(r.eigenvectors.rows(), n);
+  ASSERT_EQ(r.eigenvectors.cols(), k);
+  std::vector<double> x(n), y(n);
+  for (size_t j = 0; j < k; ++j) {
+    double norm = 0;
+    for (size_t i = 0; i < n; ++i) norm += (x[i] = r.eigenvectors.at(i, j)) * x[i];
+    EXPECT_NEAR(norm, 1.0, 1e-10);
+    A.apply(x, y);
+    for (size_t i = 0; i < n; ++i) ASSERT_NEAR(y[i], r.eigenvalues[j] * x[i], tol) << "pair " << j;
+  }
+}
+
+void expect_eigenpairs(const Matrix<double>& A, const ArnoldiResult<double>& r, double tol)
+{
+  const size_t n = A.rows(), k = r.eigenvalues.size();
+  ASSERT_EQ(r.eigenvectors.rows(), n);
+  ASSERT_EQ(r.eigenvectors.cols(), k);
+  for (size_t j = 0; j < k; ++j) {
+    for (size_t i = 0; i < n; ++i) {
+      std::complex<double> ax = 0;
+      for (size_t l = 0; l < n; ++l) ax += A.at(i, l) * r.eigenvectors.at(l, j);
+      ASSERT_LT(std::abs(ax - r.eigenvalues[j] * r.eigenvectors.at(i, j)), tol) << "pair " << j;
+    }
+  }
+}
+
+} // namespace
+
+TEST(KrylovTest, Lanczos_SparseTridiagonalBothEnds)
+{
+  const size_t n = 400, k = 4;
+  const SparseMatrix<double> A = tridiagonal(n);
+  const SymmetricEigen<double> reference(A.to_dense());
+  const auto& all = reference.eigenvalues();
+
+  const LanczosResult<double> largest = lanczos(A, k, Spectrum::Largest);
+  ASSERT_EQ(largest.eigenvalues.size(), k);
+  for (size_t j = 0; j < k; ++j) EXPECT_NEAR(largest.eigenvalues[j], all[n - k + j], 1e-8);
+  expect_eigenpairs(A, largest, 1e-7);
+
+  const LanczosResult<double> smallest = lanczos(A, k);
+  for (size_t j = 0; j < k; ++j) EXPECT_NEAR(smallest.eigenvalues[j], all[j], 1e-8);
+  expect_eigenpairs(A, smallest, 1e-7);
+}
+
+TEST(KrylovTest, Lanczos_DenseSymmetric)
+{
+  const size_t n = 150, k = 6;
+  const Matrix<double> B = random_matrix(n, n, 7);
+  Matrix<double> A(n, n);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j) A.at(i, j) = B.at(i, j) + B.at(j, i);
+
+  const SymmetricEigen<double> reference(A);
+  const LanczosResult<double> r = lanczos(A, k, Spectrum::Largest);
+  for (size_t j = 0; j < k; ++j) EXPECT_NEAR(r.eigenvalues[j], reference.eigenvalues()[n - k + j], 1e-8);
+  expect_eigenpairs(A, r, 1e-7);
+}
+
+TEST(KrylovTest, Lanczos_ShiftInvertFindsClusteredSmallest)
+{
+  // The smallest Laplacian eigenvalues are O(1/n²) apart: hopeless for plain
+  // Lanczos, but well separated after shift-invert
+  const size_t n = 200, k = 5;
+  const Matrix<double> L = path_laplacian(n);
+  const ShiftInvert<double> op(L, -1e-3);
+
+  const LanczosResult<double> r = lanczos(op, k);
+  for (size_t j = 0; j < k; ++j)
+    EXPECT_NEAR(r.eigenvalues[j], 2 - 2 * std::cos(std::numbers::pi * static_cast<double>(j) / n), 1e-10);
+  expect_eigenpairs(L, r, 1e-8);
+}
+
+TEST(KrylovTest, Arnoldi_NonsymmetricWithComplexPairs)
+{
+  // Block upper triangular: odd diagonal blocks [b 1; -1 b] contribute b ± i,
+  // even blocks diag(b, b - 0.5) two real eigenvalues
+  const size_t blocks = 40, n = 2 * blocks;
+  Matrix<double> A = random_matrix(n, n, 3);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j)
+      if (i / 2 > j / 2) A.at(i, j) = 0;
+  for (size_t b = 0; b < blocks; ++b) {
+    const double re = static_cast<double>(b);
+    A.at(2 * b, 2 * b) = re;
+    if (b % 2) {
+      A.at(2 * b + 1, 2 * b + 1) = re;
+      A.at(2 * b, 2 * b + 1) = 1;
+      A.at(2 * b + 1, 2 * b) = -1;
+    } else {
+      A.at(2 * b + 1, 2 * b + 1) = re - 0.5;
+      A.at(2 * b + 1, 2 * b) = 0;
+    }
+  }
+
+  const ArnoldiResult<double> r = arnoldi(A, 4);
+  ASSERT_EQ(r.eigenvalues.size(), 4u);
+  const std::vector<std::complex<double>> expected = {{37.5, 0}, {38, 0}, {39, -1}, {39, 1}};
+  for (size_t j = 0; j < 4; ++j) {
+    EXPECT_NEAR(r.eigenvalues[j].real(), expected[j].real(), 1e-8);
+    EXPECT_NEAR(r.eigenvalues[j].imag(), expected[j].imag(), 1e-8);
+    double norm = 0;
+    for (size_t i = 0; i < n; ++i) norm += std::norm(r.eigenvectors.at(i, j));
+    EXPECT_NEAR(norm, 1.0, 1e-10);
+  }
+  expect_eigenpairs(A, r, 1e-7);
+}
+
+TEST(KrylovTest, Arnoldi_ShiftInvertNearInteriorPoint)
+{
+  const size_t n = 120;
+  Matrix<double> A = random_matrix(n, n, 11);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < i; ++j) A.at(i, j) = 0;
+    A.at(i, i) = static_cast<double>(i) + 0.5;
+  }
+
+  const ShiftInvert<double> op(A, 60.1);
+  const ArnoldiResult<double> r = arnoldi(op, 3);
+  ASSERT_EQ(r.eigenvalues.size(), 3u);
+  EXPECT_NEAR(r.eigenvalues[0].real(), 59.5, 1e-8);
+  EXPECT_NEAR(r.eigenvalues[1].real(), 60.5, 1e-8);
+  EXPECT_NEAR(r.eigenvalues[2].real(), 61.5, 1e-8);
+  for (const auto& v : r.eigenvalues) EXPECT_NEAR(v.imag(), 0.0, 1e-8);
+  expect_eigenpairs(A, r, 1e-7);
+}
+
+TEST(KrylovTest, TinyScale_BreakdownTestIsRelative)
+{
+  // At 1e-20 every residual is below an absolute threshold, which used to look like breakdown
+  const size_t n = 300, k = 4;
+  const Matrix<double> B = random_matrix(n, n, 5);
+  Matrix<double> A(n, n);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j) A.at(i, j) = (B.at(i, j) + B.at(j, i)) * 1e-20;
+
+  const SymmetricEigen<double> reference(A);
+  const LanczosResult<double> r = lanczos(A, k, Spectrum::Largest);
+  for (size_t j = 0; j < k; ++j)
+    EXPECT_NEAR(r.eigenvalues[j] / reference.eigenvalues()[n - k + j], 1.0, 1e-8);
+  expect_eigenpairs(A, r, 1e-27);
+
+  const ArnoldiResult<double> a = arnoldi(A, k, Spectrum::Largest);
+  for (size_t j = 0; j < k; ++j)
+    EXPECT_NEAR(a.eigenvalues[j].real() / reference.eigenvalues()[n - k + j], 1.0, 1e-8);
+}
+
+TEST(KrylovTest, InvalidArguments_Throw)
+{
+  const SparseMatrix<double> A = tridiagonal(10);
+  EXPECT_THROW(lanczos(A, 0), std::invalid_argument);
+  EXPECT_THROW(lanczos(A, 10), std::invalid_argument);
+  EXPECT_THROW(arnoldi(Matrix<double>(3, 4), 1), std::invalid_argument);
+  EXPECT_THROW(ShiftInvert<double>(Matrix<double>(3, 4), 0.0), std::invalid_argument);
+  EXPECT_THROW(ShiftInvert<double>(path_laplacian(5), 0.0), std::runtime_error);
+
+  const ShiftInvert<double> op(path_laplacian(5), 0.5);
+  std::vector<double> x(4), y(5);
+  EXPECT_THROW(op.apply(x, y), std::invalid_argument);
+
+  KrylovOptions opts;
+  opts.max_restarts = 0;
+  opts.subspace = 3;
+  EXPECT_THROW(lanczos(A, 2, Spectrum::Smallest, opts), std::runtime_error);
+}
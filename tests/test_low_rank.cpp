@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <lin_alg/LowRank.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/SVD.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_matrix;
+
+/** Returns U diag(sigma) Vᵀ for random orthonormal U (m x r) and V (n x r). */
+Matrix<double> with_spectrum(size_t m, size_t n, const std::vector<double>& sigma)
+{
+  const size_t r = sigma.size();
+  const Matrix<double> U = SVD<double>(random_matrix(m, r, 11)).left_singular_vectors();
+  const Matrix<double> V = SVD<double>(random_matrix(n, r, 12)).left_singular_vectors();
+  Matrix<double> A(m, n);
+  for (size_t i = 0; i < m; ++i)
+    for (size_t j = 0; j < n; ++j)
+      for (size_t k = 0; k < r; ++k) A.at(i, j) += U.at(i, k) * sigma[k] * V.at(j, k);
+  return A;
+}
+
+/** Largest entry of |A - U Σ Vᵀ|. */
+double reconstruction_error(const Matrix<double>& A, const LowRankSVD<double>& r)
+{
+  double worst = 0;
+  for (size_t i = 0; i < A.rows(); ++i)
+    for (size_t j = 0; j < A.cols(); ++j) {
+      double sum = 0;
+      for (size_t k = 0; k < r.singular_values.size(); ++k)
+        sum += r.left_singular_vectors.at(i, k) * r.singular_values[k] * r.right_singular_vectors.at(j, k);
+      worst = std::max(worst, std::abs(sum - A.at(i, j)));
+    }
+  return worst;
+}
+
+} // namespace
+
+TEST(LowRankTest, CounterRandom_IsAPureFunctionOfSeedAndCounter)
+{
+  using lin_alg::detail::counter_random;
+  EXPECT_EQ(counter_random(1, 5), counter_random(1, 5));
+  EXPECT_NE(counter_random(1, 5), counter_random(1, 6));
+  EXPECT_NE(counter_random(1, 5), counter_random(2, 5));
+
+  double mean = 0, square = 0;
+  const size_t samples = 20000;
+  for (size_t i = 0; i < samples; ++i) {
+    const double z = lin_alg::detail::counter_normal<double>(7, i);
+    mean += z;
+    square += z * z;
+  }
+  EXPECT_NEAR(mean / samples, 0.0, 0.03);
+  EXPECT_NEAR(square / samples, 1.0, 0.03);
+}
+
+TEST(LowRankTest, ExactlyLowRank_RecoveredByBothSketches)
+{
+  std::vector<double> sigma(15);
+  for (size_t k = 0; k < sigma.size(); ++k) sigma[k] = 10.0 / static_cast<double>(k + 1);
+  const Matrix<double> A = with_spectrum(300, 200, sigma);
+
+  for (Sketch sketch : {Sketch::Gaussian, Sketch::SparseSign}) {
+    LowRankOptions opts;
+    opts.sketch = sketch;
+    const LowRankSVD<double> r = low_rank(A, 15, opts);
+    ASSERT_EQ(r.singular_values.size(), 15u);
+    ASSERT_EQ(r.left_singular_vectors.rows(), 300u);
+    ASSERT_EQ(r.right_singular_vectors.rows(), 200u);
+    for (size_t k = 0; k < sigma.size(); ++k) EXPECT_NEAR(r.singular_values[k], sigma[k], 1e-12);
+    EXPECT_LT(reconstruction_error(A, r), 1e-12);
+  }
+}
+
+TEST(LowRankTest, DecayingSpectrum_MatchesTruncatedSVD)
+{
+  // Geometric decay: the power iterations make the top singular values accurate
+  std::vector<double> sigma(60);
+  for (size_t k = 0; k < sigma.size(); ++k) sigma[k] = std::pow(0.7, static_cast<double>(k));
+  const Matrix<double> A = with_spectrum(250, 180, sigma);
+
+  const LowRankSVD<double> r = low_rank(A, 10);
+  for (size_t k = 0; k < 10; ++k) EXPECT_NEAR(r.singular_values[k] / sigma[k], 1.0, 1e-6);
+  EXPECT_LT(reconstruction_error(A, r), 2 * sigma[10]);
+}
+
+TEST(LowRankTest, SameSeed_SameResult)
+{
+  const Matrix<double> A = random_matrix(120, 90, 3);
+  LowRankOptions opts;
+  opts.seed = 42;
+  const LowRankSVD<double> a = low_rank(A, 5, opts), b = low_rank(A, 5, opts);
+  EXPECT_EQ(a.singular_values, b.singular_values);
+  EXPECT_EQ(a.left_singular_vectors, b.left_singular_vectors);
+}
+
+TEST(LowRankTest, ApproxRank)
+{
+  std::vector<double> sigma(37);
+  for (size_t k = 0; k < sigma.size(); ++k) sigma[k] = 1.0 + static_cast<double>(k);
+  EXPECT_EQ(approx_rank(with_spectrum(200, 150, sigma), 1e-10), 37u);
+
+  // Every singular value above the threshold: the sketch grows to full size
+  EXPECT_EQ(approx_rank(random_matrix(40, 20, 4), 1e-10), 20u);
+  EXPECT_EQ(approx_rank(Matrix<double>(30, 30), 1e-10), 0u);
+}
+
+TEST(LowRankTest, InvalidRank_Throws)
+{
+  const Matrix<double> A = random_matrix(10, 6, 5);
+  EXPECT_THROW(low_rank(A, 0), std::invalid_argument);
+  EXPECT_THROW(low_rank(A, 7), std::invalid_argument);
+}
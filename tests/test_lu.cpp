@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <lin_alg/LU.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+#include <stdexcept>
+#include <vector>
+
+TEST(LUTest, ReconstructsPermutedMatrix)
+{
+  Matrix<double> A({
+    {1, 2, 3},
+    {4, 5, 6},
+    {7, 8, 10}
+  });
+  LU<double> lu(A);
+  ASSERT_FALSE(lu.singular());
+
+  Matrix<double> L(3, 3), U(3, 3);
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 3; ++j) {
+      const double v = lu.packed().at(i, j);
+      if (i > j) L.at(i, j) = v; else U.at(i, j) = v;
+      if (i == j) L.at(i, j) = 1;
+    }
+
+  Matrix<double> LU_product = L * U;
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 3; ++j)
+      EXPECT_NEAR(LU_product.at(i, j), A.at(lu.permutation()[i], j), 1e-12);
+}
+
+TEST(LUTest, SolveAndDeterminant)
+{
+  Matrix<double> A({
+    {1,-2, 1},
+    {0, 2,-8},
+    {5, 0,-5}
+  });
+  LU<double> lu(A);
+
+  std::vector<double> b = {0, 8, 10};
+  auto x = lu.solve(std::span<const double>(b));
+  EXPECT_NEAR(x[0], 1, 1e-12);
+  EXPECT_NEAR(x[1], 0, 1e-12);
+  EXPECT_NEAR(x[2], -1, 1e-12);
+  EXPECT_NEAR(lu.det(), A.det(), 1e-9);
+}
+
+TEST(LUTest, SolveMultipleRightHandSides_Rational)
+{
+  Matrix<Rational> A({
+    {Rational(2), Rational(1)},
+    {Rational(4), Rational(3)}
+  });
+  Matrix<Rational> I({
+    {Rational(1), Rational(0)},
+    {Rational(0), Rational(1)}
+  });
+
+  LU<Rational> lu(A);
+  EXPECT_EQ(lu.solve(I), Matrix<Rational>({{Rational(3, 2), Rational(-1, 2)}, {Rational(-2), Rational(1)}}));
+  EXPECT_EQ(lu.det(), Rational(2));
+}
+
+TEST(LUTest, Singular)
+{
+  LU<double> lu(Matrix<double>({{1, 2}, {2, 4}}));
+  EXPECT_TRUE(lu.singular());
+  EXPECT_EQ(lu.det(), 0);
+  EXPECT_THROW(lu.solve(std::vector<double>{1, 2}), std::runtime_error);
+}
+
+TEST(LUTest, Invalid_Throws)
+{
+  EXPECT_THROW(LU<double>(Matrix<double>(2, 3)), std::invalid_argument);
+  LU<double> lu(Matrix<double>({{1, 0}, {0, 1}}));
+  EXPECT_THROW(lu.solve(std::vector<double>{1}), std::invalid_argument);
+  EXPECT_THROW(lu.solve(Matrix<double>(3, 1)), std::invalid_argument);
+}
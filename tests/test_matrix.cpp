@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <lin_alg/Matrix.hpp>
 #include <lin_alg/Rational.hpp>
+#include <cmath>
+#include <cstdio>
+#include <sstream>
 #include <stdexcept>
 
 // ==============================================================================
@@ -54,6 +57,17 @@ TEST(MatrixTest, ConstructsFromFlatInitializer_WithZeroDimension_Throws)
   EXPECT_THROW(Matrix<std::string> m(2, 0, {}), std::invalid_argument);
 }
 
+TEST(MatrixTest, ConstructsFromMovedVector_TakesOwnership)
+{
+  std::vector<int> data = {0, 1, 2, 3, 4, 5};
+  const int* storage = data.data();
+  Matrix<int> m(2, 3, std::move(data));
+
+  EXPECT_EQ(m.data().data(), storage);
+  EXPECT_EQ(m.at(1, 0), 3);
+  EXPECT_THROW(Matrix<int>(2, 2, std::vector<int>(3)), std::invalid_argument);
+}
+
 TEST(MatrixTest, ConstructsFromColumnsInitializer_InnerAsRows)
 {
   Matrix<std::string> m({ {"0", "1", "2"}, {"3", "4", "5"} });
@@ -195,6 +209,25 @@ TEST(MatrixTest, ScalarMultiplication_ByZero)
   ASSERT_TRUE((A*0) == expected);
 }
 
+TEST(MatrixTest, MultiplicationOverload_LargeBlockedMatchesNaive)
+{
+  // Large enough to be tiled and split across threads
+  const size_t m = 150, k = 300, n = 1100;
+  Matrix<double> A(m, k), B(k, n);
+  for (size_t i = 0; i < m; ++i)
+    for (size_t p = 0; p < k; ++p) A.at(i, p) = static_cast<double>((i * 7 + p * 3) % 11) - 5;
+  for (size_t p = 0; p < k; ++p)
+    for (size_t j = 0; j < n; ++j) B.at(p, j) = static_cast<double>((p * 5 + j) % 13) - 6;
+
+  Matrix<double> C = A * B;
+  for (size_t i = 0; i < m; i += 37)
+    for (size_t j = 0; j < n; j += 101) {
+      double expected = 0;
+      for (size_t p = 0; p < k; ++p) expected += A.at(i, p) * B.at(p, j);
+      ASSERT_EQ(C.at(i, j), expected);
+    }
+}
+
 TEST(MatrixTest, MultiplicationOverload_Scalar)
 {
   Matrix<int> A = { {0,1}, {2,3}, {4,5} };
@@ -206,6 +239,153 @@ TEST(MatrixTest, MultiplicationOverload_Scalar)
   ASSERT_TRUE(actual == expected);
 }
 
+TEST(MatrixTest, SubtractionAndNegation)
+{
+  Matrix<double> a({{5, 7}, {1, 2}});
+  Matrix<double> b({{1, 2}, {3, 4}});
+
+  EXPECT_EQ(a - b, Matrix<double>({{4, 5}, {-2, -2}}));
+  EXPECT_EQ(-b, Matrix<double>({{-1, -2}, {-3, -4}}));
+
+  a -= b;
+  EXPECT_EQ(a, Matrix<double>({{4, 5}, {-2, -2}}));
+  EXPECT_THROW(a - Matrix<double>(2, 3), std::invalid_argument);
+}
+
+TEST(MatrixTest, ScalarDivision)
+{
+  Matrix<double> m({{2, 4}, {6, 8}});
+  EXPECT_EQ(m / 2.0, Matrix<double>({{1, 2}, {3, 4}}));
+  m /= 4.0;
+  EXPECT_EQ(m, Matrix<double>({{0.5, 1}, {1.5, 2}}));
+}
+
+TEST(MatrixTest, HadamardProductAndDivision)
+{
+  Matrix<Rational> a({{Rational(1, 2), Rational(3)}, {Rational(2), Rational(-1, 3)}});
+  Matrix<Rational> b({{Rational(4), Rational(1, 3)}, {Rational(1, 2), Rational(3)}});
+
+  Matrix<Rational> expected({{Rational(2), Rational(1)}, {Rational(1), Rational(-1)}});
+  EXPECT_EQ(a.hadamard(b), expected);
+  EXPECT_EQ(a.hadamard(b).element_divide(b), a);
+
+  a.hadamard_in_place(b);
+  EXPECT_EQ(a, expected);
+  a.element_divide_in_place(b);
+  EXPECT_EQ(a.at(0, 0), Rational(1, 2));
+  EXPECT_THROW(a.hadamard(Matrix<Rational>(1, 4)), std::invalid_argument);
+}
+
+TEST(MatrixTest, Transform_ChangesElementType)
+{
+  Matrix<int> m({{1, -2}, {3, -4}});
+
+  Matrix<double> halves = m.transform([](int x) { return x / 2.0; });
+  EXPECT_EQ(halves, Matrix<double>({{0.5, -1}, {1.5, -2}}));
+
+  Matrix<long> scaled = m.zip_transform([](int x, double h) { return static_cast<long>(x * h); }, halves);
+  EXPECT_EQ(scaled, Matrix<long>({{0, 2}, {4, 8}}));
+
+  // Predicates build masks as unsigned char; Matrix<bool> is rejected at compile time
+  Matrix<unsigned char> mask = m.transform([](int x) -> unsigned char { return x > 0; });
+  EXPECT_EQ(mask, Matrix<unsigned char>({{1, 0}, {1, 0}}));
+}
+
+TEST(MatrixTest, TransformInPlace_LargeMatrix)
+{
+  Matrix<double> a(600, 400), b(600, 400);
+  for (size_t i = 0; i < a.data().size(); ++i) {
+    a.data()[i] = static_cast<double>(i);
+    b.data()[i] = 2.0;
+  }
+
+  a.zip_transform_in_place([](double x, double y) { return x * y + 1; }, b)
+   .transform_in_place([](double x) { return x - 1; });
+  for (size_t i = 0; i < a.data().size(); i += 997)
+    ASSERT_EQ(a.data()[i], 2.0 * static_cast<double>(i));
+}
+
+TEST(MatrixTest, Rank1Update)
+{
+  Matrix<double> m({{1, 1, 1}, {2, 2, 2}});
+  std::vector<double> x = {1, -1};
+  std::vector<double> y = {1, 2, 3};
+
+  m.rank1_update(2.0, x, y);
+  EXPECT_EQ(m, Matrix<double>({{3, 5, 7}, {0, -2, -4}}));
+  EXPECT_THROW(m.rank1_update(1.0, y, y), std::invalid_argument);
+}
+
+TEST(MatrixTest, Apply_MatchesVectorProduct)
+{
+  Matrix<double> m({{1, 2, 3}, {4, 5, 6}});
+  std::vector<double> x = {1, 0, -1};
+  std::vector<double> y(2);
+
+  m.apply(x, y);
+  EXPECT_EQ(y, std::vector<double>({-2, -2}));
+  EXPECT_THROW(m.apply(y, y), std::invalid_argument);
+}
+
+TEST(MatrixTest, Gram_MatchesExplicitProduct)
+{
+  const size_t rows = 300, cols = 65;
+  Matrix<double> A(rows, cols), At(cols, rows);
+  for (size_t i = 0; i < rows; ++i)
+    for (size_t j = 0; j < cols; ++j)
+      At.at(j, i) = A.at(i, j) = static_cast<double>((i * 5 + j * 11) % 9) - 4;
+
+  Matrix<double> G = A.gram();
+  EXPECT_EQ(G, At * A);
+  for (size_t i = 0; i < cols; ++i)
+    for (size_t j = 0; j < i; ++j)
+      ASSERT_EQ(G.at(i, j), G.at(j, i));
+}
+
+TEST(MatrixTest, Gram_Rational)
+{
+  Matrix<Rational> A({{Rational(1, 2), Rational(1)}, {Rational(2), Rational(-1, 3)}});
+  EXPECT_EQ(A.gram(), Matrix<Rational>({
+    {Rational(17, 4), Rational(-1, 6)},
+    {Rational(-1, 6), Rational(10, 9)}
+  }));
+}
+
+TEST(MatrixTest, ChainOrder_PrefersCheapParenthesization)
+{
+  // (1000x10)(10x1000)(1000x10): A (B C) beats (A B) C by a factor of 100
+  std::vector<size_t> dims = {1000, 10, 1000, 10};
+  auto order = lin_alg::detail::chain_order(dims);
+  EXPECT_EQ(order.cost, 200000u);
+  EXPECT_EQ(order.split[0 * 3 + 2], 0u);
+}
+
+TEST(MatrixTest, MultiMultiply_MatchesLeftToRight)
+{
+  auto make = [](size_t r, size_t c, long seed) {
+    Matrix<double> m(r, c);
+    for (size_t i = 0; i < r; ++i)
+      for (size_t j = 0; j < c; ++j)
+        m.at(i, j) = static_cast<double>((i * 7 + j * 3 + seed) % 5) - 2;
+    return m;
+  };
+  Matrix<double> A = make(40, 3, 1), B = make(3, 50, 2), C = make(50, 2, 3), D = make(2, 60, 4);
+
+  EXPECT_EQ(multi_multiply(A, B, C, D), A * B * C * D);
+  EXPECT_EQ(multi_multiply(std::vector<Matrix<double>>{A, B, C, D}), A * B * C * D);
+  EXPECT_EQ(multi_multiply(A), A);
+  EXPECT_THROW(multi_multiply(A, C), std::invalid_argument);
+  EXPECT_THROW(multi_multiply(std::vector<Matrix<double>>{}), std::invalid_argument);
+}
+
+TEST(MatrixTest, MultiMultiply_Rational)
+{
+  Matrix<Rational> A({{Rational(1, 2)}, {Rational(3)}});
+  Matrix<Rational> B({{Rational(2), Rational(-1, 3)}});
+  Matrix<Rational> C({{Rational(1)}, {Rational(6)}});
+  EXPECT_EQ(multi_multiply(A, B, C), A * B * C);
+}
+
 // ============================================================================
 //  Row Operations
 // ============================================================================
@@ -404,7 +584,7 @@ TEST(MatrixTest, Solution)
     {5, 0,-5},
   });
 
-  std::vector<const double> b({0,8,10});
+  std::vector<double> b({0,8,10});
 
   std::vector<double> actual = *m.solution(b);
   std::vector<double> expected({1, 0, -1});
@@ -420,7 +600,7 @@ TEST(MatrixTest, Solution_MismatchedSizes_Throws)
     {5, 0,-5},
   });
 
-  std::vector<const double> b({0,8});
+  std::vector<double> b({0,8});
 
   EXPECT_THROW(*m.solution(b), std::invalid_argument);
 }
@@ -450,6 +630,172 @@ TEST(MatrixTest, Solution_BIG)
     ASSERT_NEAR(actual[idx], expected[idx], 1e-12);
 }
 
+TEST(MatrixTest, Determinant_IntegralIsExact)
+{
+  Matrix<int> m({
+    {2, 3, 1},
+    {4, 1, 5},
+    {7, 2, 3}
+  });
+
+  EXPECT_EQ(m.det(), 56);
+  EXPECT_EQ(Matrix<int>({{0, 1}, {1, 0}}).det(), -1);
+  EXPECT_EQ(Matrix<int>({{2, 4}, {1, 2}}).det(), 0);
+}
+
+TEST(MatrixTest, LinearlyIndependent_Integral)
+{
+  Matrix<int> independent({
+    {2, 4},
+    {1, 3}
+  });
+  Matrix<int> dependent({
+    {2, 3},
+    {4, 6},
+    {6, 9}
+  });
+
+  EXPECT_TRUE(independent.linearly_independent());
+  EXPECT_FALSE(dependent.linearly_independent());
+}
+
+TEST(MatrixTest, Solution_TinyPivot_UsesPartialPivoting)
+{
+  Matrix<double> m({
+    {1e-20, 1},
+    {1,     1}
+  });
+  std::vector<double> b({1, 2});
+
+  auto x = *m.solution(b);
+  EXPECT_NEAR(x[0], 1, 1e-12);
+  EXPECT_NEAR(x[1], 1, 1e-12);
+}
+
+TEST(MatrixTest, LinearlyDependent_RoundingResidueTreatedAsZero)
+{
+  Matrix<double> m({
+    {0.1, 0.2, 0.3},
+    {0.3, 0.6, 0.9}
+  });
+
+  EXPECT_EQ(m.rref_stats().rank, 1u);
+  EXPECT_TRUE(m.solution(std::vector<double>{0.1, 0.3}).has_value());
+}
+
+// ============================================================================
+// Reductions
+// ============================================================================
+TEST(MatrixTest, SumRowSumsColSums)
+{
+  Matrix<int> m({
+    {1, 2, 3},
+    {4, 5, 6}
+  });
+
+  EXPECT_EQ(m.sum(), 21);
+  EXPECT_EQ(m.row_sums(), (std::vector<int>{6, 15}));
+  EXPECT_EQ(m.col_sums(), (std::vector<int>{5, 7, 9}));
+}
+
+TEST(MatrixTest, Trace)
+{
+  Matrix<double> m({
+    {1, 2},
+    {3, 4}
+  });
+  EXPECT_EQ(m.trace(), 5);
+  EXPECT_THROW(Matrix<double>(2, 3).trace(), std::invalid_argument);
+}
+
+TEST(MatrixTest, Dot)
+{
+  Matrix<double> a({{1, 2}, {3, 4}});
+  Matrix<double> b({{5, 6}, {7, 8}});
+  EXPECT_EQ(a.dot(b), 70);
+  EXPECT_THROW(a.dot(Matrix<double>(1, 4)), std::invalid_argument);
+}
+
+TEST(MatrixTest, Norms)
+{
+  Matrix<double> m({
+    { 1, -7},
+    {-2,  3}
+  });
+
+  EXPECT_EQ(m.max_abs(), 7);
+  EXPECT_EQ(m.norm_1(), 10);
+  EXPECT_EQ(m.norm_inf(), 8);
+  EXPECT_DOUBLE_EQ(m.norm_fro(), std::sqrt(63.0));
+}
+
+TEST(MatrixTest, NormFro_NoOverflowOrUnderflow)
+{
+  // 3-4-5 triangles whose squares are outside the double range
+  for (double scale : {1e-200, 1e200, 1e300}) {
+    Matrix<double> m({{3 * scale, 0}, {0, 4 * scale}});
+    EXPECT_NEAR(m.norm_fro() / scale, 5.0, 1e-15);
+  }
+  EXPECT_EQ(Matrix<double>(2, 2).norm_fro(), 0.0);
+}
+
+TEST(MatrixTest, Reductions_LargeMatrixAccurateAndConsistent)
+{
+  const size_t rows = 700, cols = 1500;
+  Matrix<double> m(rows, cols);
+  for (auto& x : m.data()) x = 0.1;
+
+  // Pairwise summation keeps the error far below naive accumulation's
+  EXPECT_NEAR(m.sum(), 0.1 * rows * cols, 1e-7);
+
+  const auto rs = m.row_sums();
+  const auto cs = m.col_sums();
+  ASSERT_EQ(rs.size(), rows);
+  ASSERT_EQ(cs.size(), cols);
+  for (double r : rs) ASSERT_NEAR(r, 0.1 * cols, 1e-10);
+  for (double c : cs) ASSERT_NEAR(c, 0.1 * rows, 1e-10);
+  EXPECT_NEAR(m.norm_fro(), std::sqrt(0.01 * rows * cols), 1e-9);
+}
+
+TEST(MatrixTest, Reduce_FusesSeveralReductionsInOnePass)
+{
+  //! [fused_reduce_example]
+  Matrix<double> m({
+    {3, -4},
+    {0, 12}
+  });
+
+  struct Stats { double sum = 0, sum_sq = 0, max_abs = 0; };
+  Stats s = m.reduce(Stats{},
+      [](Stats acc, double x) {
+        acc.sum += x;
+        acc.sum_sq += x * x;
+        acc.max_abs = std::max(acc.max_abs, std::abs(x));
+        return acc;
+      },
+      [](Stats a, const Stats& b) {
+        a.sum += b.sum;
+        a.sum_sq += b.sum_sq;
+        a.max_abs = std::max(a.max_abs, b.max_abs);
+        return a;
+      });
+  //! [fused_reduce_example]
+
+  EXPECT_EQ(s.sum, 11);
+  EXPECT_EQ(s.sum_sq, 169);
+  EXPECT_EQ(s.max_abs, 12);
+}
+
+TEST(MatrixTest, Constexpr_Reductions)
+{
+  constexpr int trace_plus_sum = [] {
+    Matrix<int> m = {{1, -2}, {3, 4}};
+    return m.trace() + m.sum() + m.norm_inf();
+  }();
+  static_assert(trace_plus_sum == 5 + 6 + 7);
+  EXPECT_EQ(trace_plus_sum, 18);
+}
+
 // ============================================================================
 // Utility
 // ============================================================================
@@ -461,6 +807,127 @@ TEST(MatrixTest, EqualityOperator_FalseForDifferentSizes)
   EXPECT_FALSE(A == B);
 }
 
+// ============================================================================
+// Printing
+// ============================================================================
+TEST(MatrixTest, StreamOperator_DefaultFormat)
+{
+  Matrix<double> A = {{1, 2.5}, {-3, 1.0 / 3}};
+  std::ostringstream os;
+  os << A;
+
+  EXPECT_EQ(os.str(), "1, 2.5\n-3, 0.333333\n");
+}
+
+TEST(MatrixTest, Format_CustomOptions)
+{
+  Matrix<double> A = {{1.0 / 3, 2}, {3, 4}};
+  std::ostringstream os;
+  A.format(os, {-1, "\t", ";\n"});
+
+  EXPECT_EQ(os.str(), "0.3333333333333333\t2;\n3\t4;\n");
+}
+
+TEST(MatrixTest, Format_Rational)
+{
+  Matrix<Rational> A = {{Rational(1, 2), Rational(3)}};
+  std::ostringstream os;
+  os << A;
+
+  EXPECT_EQ(os.str(), "1/2, 3\n");
+}
+
+TEST(MatrixTest, Format_NonArithmetic)
+{
+  Matrix<std::string> A(1, 2, {"a", "b"});
+  std::ostringstream os;
+  os << A;
+
+  EXPECT_EQ(os.str(), "a, b\n");
+}
+
+TEST(MatrixTest, Format_LargeMatrix_MatchesElementwise)
+{
+  Matrix<int> A(500, 300);
+  for (std::size_t i = 0; i < A.data().size(); ++i)
+    A.data()[i] = static_cast<int>(i);
+
+  std::ostringstream expected;
+  for (std::size_t r = 0; r < A.rows(); ++r)
+    for (std::size_t c = 0; c < A.cols(); ++c)
+      expected << A.at(r, c) << (c + 1 < A.cols() ? " " : "\n");
+
+  std::ostringstream os;
+  A.format(os, {6, " ", "\n"});
+  EXPECT_EQ(os.str(), expected.str());
+}
+
+TEST(MatrixTest, Format_FileDescriptor)
+{
+  Matrix<int> A = {{1, 2}, {3, 4}};
+  std::FILE* f = std::tmpfile();
+  ASSERT_NE(f, nullptr);
+
+  A.format(fileno(f));
+  std::rewind(f);
+  char buf[64] = {};
+  const std::size_t n = std::fread(buf, 1, sizeof(buf) - 1, f);
+  std::fclose(f);
+
+  EXPECT_EQ(std::string(buf, n), "1, 2\n3, 4\n");
+}
+
+// ============================================================================
+// Constant Evaluation
+// ============================================================================
+TEST(MatrixTest, Constexpr_ArithmeticFoldsAtCompileTime)
+{
+  constexpr int corner = [] {
+    Matrix<int> A = {{1, 2}, {3, 4}};
+    Matrix<int> B = {{0, 1}, {1, 0}};
+    return (A * B + A).at(1, 0);
+  }();
+  static_assert(corner == 7);
+  EXPECT_EQ(corner, 7);
+}
+
+TEST(MatrixTest, Constexpr_DeterminantAndSolution)
+{
+  constexpr double det = [] {
+    Matrix<double> m({
+      {1, 2},
+      {3, 4}
+    });
+    return m.det();
+  }();
+  static_assert(det == -2);
+
+  constexpr double x2 = [] {
+    Matrix<double> m({
+      {1,-2, 1},
+      {0, 2,-8},
+      {5, 0,-5},
+    });
+    std::vector<double> b = {0, 8, 10};
+    return (*m.solution(b))[2];
+  }();
+  static_assert(x2 == -1);
+  EXPECT_EQ(det, -2);
+}
+
+TEST(MatrixTest, Constexpr_RationalRank)
+{
+  constexpr std::size_t rank = [] {
+    Matrix<Rational> m({
+      {Rational(1, 2), Rational(1)},
+      {Rational(1), Rational(2)}
+    });
+    return m.rref_stats().rank;
+  }();
+  static_assert(rank == 1);
+  EXPECT_EQ(rank, 1u);
+}
+
 // ============================================================================
 // Rational Testing
 // ============================================================================
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixBatch.hpp>
+#include <lin_alg/Rational.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_matrix;
+
+} // namespace
+
+TEST(MatrixBatchTest, Layout_IsInterleaved)
+{
+  MatrixBatch<double> batch(11, 2, 3);
+  EXPECT_EQ(batch.size(), 11u);
+  EXPECT_EQ(batch.rows(), 2u);
+  EXPECT_EQ(batch.cols(), 3u);
+  EXPECT_EQ(MatrixBatch<double>::lanes(), 8u);
+  EXPECT_EQ(MatrixBatch<float>::lanes(), 16u);
+
+  // Two packs of eight, padded
+  EXPECT_EQ(batch.data().size(), 2u * 8u * 6u);
+
+  batch.at(9, 1, 2) = 5.0;
+  EXPECT_EQ(batch.data()[(6 + 1 * 3 + 2) * 8 + 1], 5.0);
+  batch.at(2, 0, 1) = 7.0;
+  EXPECT_EQ(batch.data()[(0 + 1) * 8 + 2], 7.0);
+
+  EXPECT_THROW(batch.at(11, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch.at(0, 2, 0), std::out_of_range);
+  EXPECT_THROW(MatrixBatch<double>(4, 0, 3), std::invalid_argument);
+}
+
+TEST(MatrixBatchTest, SetAndMatrix_RoundTrip)
+{
+  std::vector<Matrix<double>> matrices;
+  for (size_t b = 0; b < 5; ++b) matrices.push_back(random_matrix(3, 4, b));
+  const MatrixBatch<double> batch(matrices);
+
+  for (size_t b = 0; b < 5; ++b) EXPECT_EQ(batch.matrix(b), matrices[b]);
+  EXPECT_THROW(batch.matrix(5), std::out_of_range);
+
+  MatrixBatch<double> copy(5, 3, 4);
+  EXPECT_THROW(copy.set(0, random_matrix(4, 3, 9)), std::invalid_argument);
+  copy.set(3, matrices[3]);
+  EXPECT_EQ(copy.matrix(3), matrices[3]);
+  EXPECT_EQ(copy.matrix(2), Matrix<double>(3, 4));
+
+  matrices.push_back(random_matrix(3, 3, 7));
+  EXPECT_THROW(MatrixBatch<double>(std::span<const Matrix<double>>(matrices)), std::invalid_argument);
+}
+
+TEST(MatrixBatchTest, Multiply_MatchesPerMatrixProduct)
+{
+  // Square and rectangular shapes, batch sizes that do and do not fill the last pack
+  const size_t shapes[][3] = {{3, 3, 3}, {4, 2, 5}, {16, 16, 16}, {1, 7, 1}};
+  for (const auto& s : shapes) {
+    for (size_t count : {1, 8, 13, 1000}) {
+      MatrixBatch<double> A(count, s[0], s[1]), B(count, s[1], s[2]);
+      for (size_t b = 0; b < count; ++b) {
+        A.set(b, random_matrix(s[0], s[1], 2 * b));
+        B.set(b, random_matrix(s[1], s[2], 2 * b + 1));
+      }
+      const MatrixBatch<double> C = A * B;
+      ASSERT_EQ(C.rows(), s[0]);
+      ASSERT_EQ(C.cols(), s[2]);
+      for (size_t b = 0; b < count; b += 7) {
+        const Matrix<double> expected = A.matrix(b) * B.matrix(b);
+        for (size_t i = 0; i < s[0]; ++i)
+          for (size_t j = 0; j < s[2]; ++j) EXPECT_NEAR(C.at(b, i, j), expected.at(i, j), 1e-14);
+      }
+    }
+  }
+}
+
+TEST(MatrixBatchTest, Multiply_IntoExistingStorageAndExactTypes)
+{
+  std::vector<Matrix<Rational>> left = {
+    Matrix<Rational>({{Rational(1, 2), Rational(1)}, {Rational(0), Rational(3)}}),
+    Matrix<Rational>({{Rational(2), Rational(-1)}, {Rational(1, 3), Rational(1)}})
+  };
+  std::vector<Matrix<Rational>> right = {
+    Matrix<Rational>({{Rational(4), Rational(0)}, {Rational(1), Rational(1, 5)}}),
+    Matrix<Rational>({{Rational(1), Rational(1)}, {Rational(1), Rational(-1)}})
+  };
+  const MatrixBatch<Rational> A(left), B(right);
+  MatrixBatch<Rational> C(2, 2, 2);
+  batch_multiply(A, B, C);
+  for (size_t b = 0; b < 2; ++b) EXPECT_EQ(C.matrix(b), left[b] * right[b]);
+
+  MatrixBatch<Rational> wrong(2, 2, 3);
+  EXPECT_THROW(batch_multiply(A, B, wrong), std::invalid_argument);
+  EXPECT_THROW(A * MatrixBatch<Rational>(3, 2, 2), std::invalid_argument);
+  EXPECT_THROW(A * MatrixBatch<Rational>(2, 3, 2), std::invalid_argument);
+}
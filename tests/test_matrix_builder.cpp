@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixBuilder.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(MatrixBuilderTest, AppendRows)
+{
+  MatrixBuilder<int> b;
+  for (int r = 0; r < 10; ++r) {
+    std::vector<int> row = {r, r * 10, r * 100};
+    b.append_row(row);
+  }
+  auto m = b.build();
+
+  ASSERT_EQ(m.rows(), 10u);
+  ASSERT_EQ(m.cols(), 3u);
+  EXPECT_EQ(m.at(7, 0), 7);
+  EXPECT_EQ(m.at(7, 1), 70);
+  EXPECT_EQ(m.at(9, 2), 900);
+}
+
+TEST(MatrixBuilderTest, AppendColumns_MatchesFromColumns)
+{
+  std::vector<std::vector<int>> cols = {{0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}};
+
+  MatrixBuilder<int> b;
+  for (const auto& c : cols) b.append_column(c);
+
+  ASSERT_TRUE(b.build() == Matrix<int>::from_columns(cols));
+}
+
+TEST(MatrixBuilderTest, MixedRowsAndColumns)
+{
+  MatrixBuilder<std::string> b;
+  b.append_row(std::vector<std::string>{"a", "b"});
+  b.append_column(std::vector<std::string>{"c"});
+  b.append_row(std::vector<std::string>{"d", "e", "f"});
+  b.append_column(std::vector<std::string>{"g", "h"});
+
+  Matrix<std::string> expected({
+    {"a", "b", "c", "g"},
+    {"d", "e", "f", "h"}
+  });
+  ASSERT_TRUE(b.build() == expected);
+}
+
+TEST(MatrixBuilderTest, Build_ResetsBuilder)
+{
+  MatrixBuilder<int> b;
+  b.reserve(2, 2);
+  b.append_row(std::vector<int>{1, 2});
+  auto first = b.build();
+
+  EXPECT_EQ(b.rows(), 0u);
+  EXPECT_EQ(b.cols(), 0u);
+  b.append_row(std::vector<int>{3, 4, 5});
+  auto second = b.build();
+
+  EXPECT_TRUE(first == Matrix<int>({{1, 2}}));
+  EXPECT_TRUE(second == Matrix<int>({{3, 4, 5}}));
+}
+
+TEST(MatrixBuilderTest, ReserveRowsOnly_ThenAppendColumns)
+{
+  // Reserving rows with no columns leaves a zero stride and no storage
+  MatrixBuilder<int> b;
+  b.reserve(5, 0);
+  b.append_column(std::vector<int>{1, 2, 3, 4, 5});
+  b.append_column(std::vector<int>{6, 7, 8, 9, 10});
+
+  EXPECT_TRUE(b.build() == Matrix<int>({{1, 6}, {2, 7}, {3, 8}, {4, 9}, {5, 10}}));
+}
+
+TEST(MatrixBuilderTest, MismatchedSizes_Throws)
+{
+  MatrixBuilder<int> b;
+  b.append_row(std::vector<int>{1, 2});
+  EXPECT_THROW(b.append_row(std::vector<int>{1}), std::invalid_argument);
+  EXPECT_THROW(b.append_column(std::vector<int>{1, 2}), std::invalid_argument);
+  EXPECT_THROW(b.append_row(std::vector<int>{}), std::invalid_argument);
+}
+
+TEST(MatrixBuilderTest, BuildEmpty_Throws)
+{
+  MatrixBuilder<int> b;
+  EXPECT_THROW(b.build(), std::invalid_argument);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixFunctions.hpp>
+#include <lin_alg/Rational.hpp>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_matrix;
+
+/** Minimal integers modulo 1e9+7, enough to act as a Ring element type. */
+struct ModInt {
+  static constexpr std::uint64_t MOD = 1'000'000'007;
+  std::uint64_t v = 0;
+
+  constexpr ModInt() = default;
+  constexpr ModInt(std::uint64_t x) : v(x % MOD) { }
+
+  constexpr ModInt& operator+=(const ModInt& o) { v = (v + o.v) % MOD; return *this; }
+  constexpr ModInt operator+(const ModInt& o) const { return ModInt(*this) += o; }
+  constexpr ModInt operator*(const ModInt& o) const { return ModInt(v * o.v); }
+  constexpr ModInt operator-() const { return ModInt(MOD - v); }
+  constexpr bool operator==(const ModInt& o) const = default;
+};
+
+} // namespace
+
+TEST(MatrixFunctionsTest, Pow_SmallExponents)
+{
+  Matrix<long> A({{1, 1}, {1, 0}});
+  EXPECT_EQ(pow(A, 0), Matrix<long>({{1, 0}, {0, 1}}));
+  EXPECT_EQ(pow(A, 1), A);
+  EXPECT_EQ(pow(A, 10), Matrix<long>({{89, 55}, {55, 34}}));
+  EXPECT_THROW(pow(Matrix<long>(2, 3), 2), std::invalid_argument);
+}
+
+TEST(MatrixFunctionsTest, Pow_MatchesRepeatedMultiplication)
+{
+  Matrix<double> A({
+    {0.5, 0.25, 0.25},
+    {0.125, 0.75, 0.125},
+    {0, 0.5, 0.5}
+  });
+  Matrix<double> expected = A;
+  for (int i = 1; i < 13; ++i) expected = expected * A;
+
+  const Matrix<double> P = pow(A, 13);
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 3; ++j)
+      EXPECT_NEAR(P.at(i, j), expected.at(i, j), 1e-14);
+}
+
+TEST(MatrixFunctionsTest, Pow_ModularFibonacciWithHugeExponent)
+{
+  Matrix<ModInt> F({{ModInt(1), ModInt(1)}, {ModInt(1), ModInt(0)}});
+  const Matrix<ModInt> P = pow(F, 1'000'000'000'000'000'000ULL);
+  EXPECT_EQ(P.at(0, 1).v, 209783453u);
+}
+
+TEST(MatrixFunctionsTest, Pow_Rational)
+{
+  Matrix<Rational> A({{Rational(1, 2), Rational(1)}, {Rational(0), Rational(1, 3)}});
+  Matrix<Rational> expected = A * A * A * A * A;
+  EXPECT_EQ(pow(A, 5), expected);
+}
+
+TEST(MatrixFunctionsTest, Polyval_CayleyHamilton)
+{
+  // The characteristic polynomial of A is x^2 - 5x - 2
+  Matrix<long> A({{1, 2}, {3, 4}});
+  std::vector<long> coeffs = {-2, -5, 1};
+  EXPECT_EQ(polyval(coeffs, A), Matrix<long>(2, 2));
+}
+
+TEST(MatrixFunctionsTest, Polyval_MatchesTermByTermSum)
+{
+  Matrix<long> A({
+    {1, 0, 1},
+    {0, 1, 1},
+    {1, 1, 0}
+  });
+
+  for (size_t degree = 0; degree <= 17; ++degree) {
+    std::vector<long> coeffs(degree + 1);
+    Matrix<long> expected(3, 3);
+    for (size_t i = 0; i <= degree; ++i) {
+      coeffs[i] = static_cast<long>(i % 5) - 2;
+      expected += pow(A, i) * coeffs[i];
+    }
+    EXPECT_EQ(polyval(coeffs, A), expected) << "degree " << degree;
+  }
+
+  EXPECT_EQ(polyval(std::vector<long>{}, A), Matrix<long>(3, 3));
+  EXPECT_THROW(polyval(std::vector<long>{1}, Matrix<long>(3, 2)), std::invalid_argument);
+}
+
+TEST(MatrixFunctionsTest, Expm_ClosedForms)
+{
+  EXPECT_EQ(expm(Matrix<double>(3, 3)), Matrix<double>({{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+
+  const Matrix<double> N = expm(Matrix<double>({{0, 1}, {0, 0}}));
+  EXPECT_NEAR(N.at(0, 0), 1, 1e-15);
+  EXPECT_NEAR(N.at(0, 1), 1, 1e-15);
+  EXPECT_NEAR(N.at(1, 0), 0, 1e-15);
+
+  // Rotation generators: small angles need no scaling, large ones several squarings
+  for (double t : {0.01, 0.5, 2.0, 40.0}) {
+    const Matrix<double> R = expm(Matrix<double>({{0, -t}, {t, 0}}));
+    EXPECT_NEAR(R.at(0, 0), std::cos(t), 1e-13 * std::max(1.0, t)) << "t = " << t;
+    EXPECT_NEAR(R.at(1, 0), std::sin(t), 1e-13 * std::max(1.0, t)) << "t = " << t;
+  }
+
+  EXPECT_THROW(expm(Matrix<double>(2, 3)), std::invalid_argument);
+}
+
+TEST(MatrixFunctionsTest, Expm_InverseOfNegation)
+{
+  const size_t n = 150;
+  const Matrix<double> A = random_matrix(n, n, 1) * 0.4;
+  const Matrix<double> P = expm(A) * expm(-A);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j) ASSERT_NEAR(P.at(i, j), i == j ? 1.0 : 0.0, 1e-10);
+}
+
+TEST(MatrixFunctionsTest, Expm_MarkovGeneratorGivesStochasticMatrix)
+{
+  // Birth-death chain: off-diagonal rates, rows summing to zero
+  const size_t n = 40;
+  Matrix<double> Q(n, n);
+  for (size_t i = 0; i < n; ++i) {
+    if (i + 1 < n) Q.at(i, i + 1) = 3.0;
+    if (i > 0) Q.at(i, i - 1) = 2.0;
+    Q.at(i, i) = -((i + 1 < n ? 3.0 : 0.0) + (i > 0 ? 2.0 : 0.0));
+  }
+  const Matrix<double> P = expm(Q * 1.5);
+  for (size_t i = 0; i < n; ++i) {
+    double sum = 0;
+    for (size_t j = 0; j < n; ++j) {
+      EXPECT_GE(P.at(i, j), -1e-14);
+      sum += P.at(i, j);
+    }
+    EXPECT_NEAR(sum, 1.0, 1e-12);
+  }
+}
+
+TEST(MatrixFunctionsTest, ExpmMultiply_MatchesExpm)
+{
+  const size_t n = 120;
+  std::vector<double> v(n);
+  for (size_t i = 0; i < n; ++i) v[i] = std::cos(static_cast<double>(i));
+
+  for (double scale : {0.01, 1.0, 6.0}) {
+    const Matrix<double> A = random_matrix(n, n, 2) * scale;
+    const Matrix<double> E = expm(A);
+    const std::vector<double> x = expm_multiply(A, v);
+    ASSERT_EQ(x.size(), n);
+    double largest = 0;
+    for (size_t i = 0; i < n; ++i) largest = std::max(largest, std::abs(x[i]));
+    for (size_t i = 0; i < n; ++i) {
+      double expected = 0;
+      for (size_t j = 0; j < n; ++j) expected += E.at(i, j) * v[j];
+      ASSERT_NEAR(x[i], expected, 1e-11 * largest) << "scale " << scale;
+    }
+  }
+
+  EXPECT_EQ(expm_multiply(Matrix<double>(2, 2), std::vector<double>{3, 4}), std::vector<double>({3, 4}));
+  EXPECT_THROW(expm_multiply(Matrix<double>(2, 2), std::vector<double>{1}), std::invalid_argument);
+  EXPECT_THROW(expm_multiply(Matrix<double>(2, 3), std::vector<double>{1, 2}), std::invalid_argument);
+}
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixMarket.hpp>
+#include <lin_alg/SparseMatrix.hpp>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// ==============================================================================
+// Coordinate Format
+// ==============================================================================
+
+TEST(MatrixMarketTest, Coordinate_RealGeneral)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate real general\n"
+    "% a comment\n"
+    "3 2 3\n"
+    "1 1 1.5\n"
+    "3 2 -2e1\n"
+    "2 1 +4\n";
+
+  auto m = parse_matrix_market<double>(text);
+  Matrix<double> expected({
+    {1.5, 0},
+    {4, 0},
+    {0, -20}
+  });
+
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(MatrixMarketTest, Coordinate_SymmetricPattern_Sparse)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate pattern symmetric\n"
+    "3 3 3\n"
+    "1 1\n"
+    "3 1\n"
+    "3 2\n";
+
+  auto s = parse_matrix_market_sparse<int>(text);
+  EXPECT_EQ(s.nnz(), 5u);
+
+  Matrix<int> expected({
+    {1, 0, 1},
+    {0, 0, 1},
+    {1, 1, 0}
+  });
+  ASSERT_TRUE(s.to_dense() == expected);
+}
+
+TEST(MatrixMarketTest, Coordinate_SkewSymmetric)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate integer skew-symmetric\n"
+    "2 2 1\n"
+    "2 1 7\n";
+
+  Matrix<int> expected({
+    {0, -7},
+    {7, 0}
+  });
+  ASSERT_TRUE(parse_matrix_market<int>(text) == expected);
+}
+
+TEST(MatrixMarketTest, Coordinate_Duplicates_SummedInBothForms)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate integer symmetric\n"
+    "2 2 3\n"
+    "2 1 4\n"
+    "1 1 2\n"
+    "2 1 5\n";
+
+  Matrix<int> expected({
+    {2, 9},
+    {9, 0}
+  });
+  ASSERT_TRUE(parse_matrix_market<int>(text) == expected);
+  ASSERT_TRUE(parse_matrix_market_sparse<int>(text).to_dense() == expected);
+}
+
+TEST(MatrixMarketTest, Coordinate_WrongEntryCount_Throws)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate real general\n"
+    "2 2 2\n"
+    "1 1 1\n";
+
+  EXPECT_THROW(parse_matrix_market<double>(text), std::runtime_error);
+}
+
+TEST(MatrixMarketTest, Coordinate_OutOfBounds_Throws)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate real general\n"
+    "2 2 1\n"
+    "3 1 1\n";
+
+  EXPECT_THROW(parse_matrix_market<double>(text), std::out_of_range);
+}
+
+TEST(MatrixMarketTest, Coordinate_TrailingTokens_Throws)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate real general\n"
+    "2 2 1\n"
+    "1 2 3 4\n";
+
+  EXPECT_THROW(parse_matrix_market<double>(text), std::runtime_error);
+  EXPECT_THROW(parse_matrix_market<double>(
+    "%%MatrixMarket matrix array real general\n1 1\n1 2\n"), std::runtime_error);
+}
+
+TEST(MatrixMarketTest, SizeLine_TrailingTokens_Throws)
+{
+  EXPECT_THROW(parse_matrix_market<double>(
+    "%%MatrixMarket matrix array real general\n1 1 1\n2\n"), std::runtime_error);
+  EXPECT_THROW(parse_matrix_market<double>(
+    "%%MatrixMarket matrix coordinate real general\n2 2 1 7\n1 1 2\n"), std::runtime_error);
+}
+
+TEST(MatrixMarketTest, Array_OverflowingSize_Throws)
+{
+  EXPECT_THROW(parse_matrix_market<double>(
+    "%%MatrixMarket matrix array real general\n4294967296 4294967297\n1\n"), std::runtime_error);
+}
+
+TEST(MatrixMarketTest, RealFieldIntoIntegerMatrix_Throws)
+{
+  const std::string text =
+    "%%MatrixMarket matrix coordinate real general\n"
+    "2 2 1\n"
+    "1 2 3\n";
+
+  EXPECT_THROW(parse_matrix_market<int>(text), std::runtime_error);
+  EXPECT_THROW(parse_matrix_market_sparse<long>(text), std::runtime_error);
+  EXPECT_THROW(parse_matrix_market<int>(
+    "%%MatrixMarket matrix array real general\n1 1\n1.5\n"), std::runtime_error);
+}
+
+TEST(MatrixMarketTest, Coordinate_LargeInput_ParsedInChunks)
+{
+  const std::size_t n = 300000;
+  std::string text = "%%MatrixMarket matrix coordinate integer general\n";
+  text += std::to_string(n) + " 3 " + std::to_string(n) + "\n";
+  for (std::size_t i = 0; i < n; ++i)
+    text += std::to_string(i + 1) + " " + std::to_string(i % 3 + 1) + " " + std::to_string(i) + "\n";
+
+  auto s = parse_matrix_market_sparse<long>(text);
+  ASSERT_EQ(s.nnz(), n);
+  for (std::size_t i = 0; i < n; i += 9973)
+    EXPECT_EQ(s.at(i, i % 3), static_cast<long>(i));
+}
+
+// ==============================================================================
+// Array Format
+// ==============================================================================
+
+TEST(MatrixMarketTest, Array_ColumnMajorOrder)
+{
+  const std::string text =
+    "%%MatrixMarket matrix array real general\n"
+    "2 3\n"
+    "1\n4\n2\n5\n3\n6\n";
+
+  Matrix<double> expected({
+    {1, 2, 3},
+    {4, 5, 6}
+  });
+  ASSERT_TRUE(parse_matrix_market<double>(text) == expected);
+}
+
+TEST(MatrixMarketTest, Array_Symmetric_LowerTriangle)
+{
+  const std::string text =
+    "%%MatrixMarket matrix array integer symmetric\n"
+    "3 3\n"
+    "1\n2\n3\n4\n5\n6\n";
+
+  Matrix<int> expected({
+    {1, 2, 3},
+    {2, 4, 5},
+    {3, 5, 6}
+  });
+  ASSERT_TRUE(parse_matrix_market<int>(text) == expected);
+}
+
+TEST(MatrixMarketTest, MissingBanner_Throws)
+{
+  EXPECT_THROW(parse_matrix_market<double>("2 2 0\n"), std::runtime_error);
+}
+
+// ==============================================================================
+// Writing
+// ==============================================================================
+
+TEST(MatrixMarketTest, WriteDense_RoundTrip)
+{
+  Matrix<double> m({
+    {0.1, -2},
+    {3e-300, 4.25}
+  });
+
+  std::stringstream ss;
+  write_matrix_market(ss, m);
+
+  ASSERT_TRUE(parse_matrix_market<double>(ss.str()) == m);
+}
+
+TEST(MatrixMarketTest, WriteSparse_FileRoundTrip)
+{
+  std::vector<Triplet<int>> entries = {{0, 1, 5}, {2, 0, -3}};
+  auto s = SparseMatrix<int>::from_triplets(3, 2, entries);
+
+  const auto path = std::filesystem::temp_directory_path() / "lin_alg_mm_test.mtx";
+  write_matrix_market(path, s);
+  auto loaded = read_matrix_market_sparse<int>(path);
+  std::filesystem::remove(path);
+
+  ASSERT_TRUE(loaded.to_dense() == s.to_dense());
+  EXPECT_EQ(loaded.nnz(), 2u);
+}
+
+// ==============================================================================
+// Sparse Matrix
+// ==============================================================================
+
+TEST(SparseMatrixTest, FromTriplets_SumsDuplicates)
+{
+  std::vector<Triplet<int>> entries = {{1, 1, 2}, {0, 0, 1}, {1, 1, 3}};
+  auto s = SparseMatrix<int>::from_triplets(2, 2, entries);
+
+  EXPECT_EQ(s.nnz(), 2u);
+  EXPECT_EQ(s.at(1, 1), 5);
+  EXPECT_EQ(s.at(0, 1), 0);
+}
+
+TEST(SparseMatrixTest, VectorProduct)
+{
+  std::vector<Triplet<int>> entries = {{0, 0, 1}, {0, 2, 2}, {1, 1, 3}};
+  auto s = SparseMatrix<int>::from_triplets(2, 3, entries);
+  std::vector<int> x = {1, 2, 3};
+
+  EXPECT_EQ(s * std::span<const int>(x), std::vector<int>({7, 6}));
+}
+
+TEST(SparseMatrixTest, Apply_WritesIntoOutput)
+{
+  std::vector<Triplet<int>> entries = {{0, 0, 1}, {0, 2, 2}, {1, 1, 3}};
+  auto s = SparseMatrix<int>::from_triplets(2, 3, entries);
+  std::vector<int> x = {1, 2, 3};
+  std::vector<int> y = {9, 9};
+
+  s.apply(x, y);
+  EXPECT_EQ(y, std::vector<int>({7, 6}));
+  EXPECT_THROW(s.apply(y, y), std::invalid_argument);
+}
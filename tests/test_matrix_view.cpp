@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/MatrixView.hpp>
+#include <lin_alg/Rational.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ==============================================================================
+// Blocks
+// ==============================================================================
+
+TEST(MatrixViewTest, Block_ReadsAndWritesThroughView)
+{
+  Matrix<int> m({
+    {1, 2, 3, 4},
+    {5, 6, 7, 8},
+    {9,10,11,12}
+  });
+
+  MatrixView<int> b = m.block(1, 1, 2, 2);
+  ASSERT_EQ(b.rows(), 2u);
+  ASSERT_EQ(b.cols(), 2u);
+  ASSERT_EQ(b.stride(), 4u);
+  EXPECT_EQ(b.at(0, 0), 6);
+  EXPECT_EQ(b[1][1], 11);
+
+  b.at(1, 0) = -10;
+  EXPECT_EQ(m.at(2, 1), -10);
+  EXPECT_EQ(b.to_matrix(), Matrix<int>({{6, 7}, {-10, 11}}));
+}
+
+TEST(MatrixViewTest, Block_OutOfRange_Throws)
+{
+  Matrix<int> m(3, 3);
+  EXPECT_THROW(m.block(2, 0, 2, 1), std::out_of_range);
+  EXPECT_THROW(m.block(0, 1, 1, 3), std::out_of_range);
+  EXPECT_THROW(m.block(0, 0, 2, 2).at(2, 0), std::out_of_range);
+}
+
+TEST(MatrixViewTest, SetBlock_AssignsAndFills)
+{
+  Matrix<std::string> m(2, 3);
+  m.set_block(0, 1, Matrix<std::string>({{"a", "b"}, {"c", "d"}}).view());
+  m.block(0, 0, 2, 1).fill("x");
+
+  EXPECT_EQ(m, Matrix<std::string>({{"x", "a", "b"}, {"x", "c", "d"}}));
+  EXPECT_THROW(m.set_block(1, 1, Matrix<std::string>(2, 2).view()), std::out_of_range);
+  EXPECT_THROW(m.block(0, 0, 1, 1).assign(Matrix<std::string>(1, 2).view()), std::invalid_argument);
+}
+
+// ==============================================================================
+// Concatenation
+// ==============================================================================
+
+TEST(MatrixViewTest, HStackAndVStack)
+{
+  Matrix<double> a({{1, 2}, {3, 4}});
+  Matrix<double> b({{5}, {6}});
+  Matrix<double> c({{7, 8}});
+
+  EXPECT_EQ(hstack(a, b, a), Matrix<double>({{1, 2, 5, 1, 2}, {3, 4, 6, 3, 4}}));
+  EXPECT_EQ(vstack(a, c), Matrix<double>({{1, 2}, {3, 4}, {7, 8}}));
+
+  EXPECT_THROW(hstack(a, c), std::invalid_argument);
+  EXPECT_THROW(vstack(a, b), std::invalid_argument);
+}
+
+TEST(MatrixViewTest, Augment)
+{
+  Matrix<double> A({{1, 2}, {3, 4}});
+  std::vector<double> b = {5, 6};
+
+  EXPECT_EQ(augment(A, std::span<const double>(b)), Matrix<double>({{1, 2, 5}, {3, 4, 6}}));
+  EXPECT_EQ(augment(A, A), hstack(A, A));
+  EXPECT_THROW(augment(A, std::span<const double>(b).first(1)), std::invalid_argument);
+}
+
+// ==============================================================================
+// Augmented Views
+// ==============================================================================
+
+TEST(MatrixViewTest, AugmentedView_RrefInPlaceInverts)
+{
+  Matrix<Rational> A({
+    {Rational(2), Rational(1)},
+    {Rational(4), Rational(3)}
+  });
+  Matrix<Rational> I({
+    {Rational(1), Rational(0)},
+    {Rational(0), Rational(1)}
+  });
+
+  auto res = rref_in_place(AugmentedView<Rational>(A.view(), I.view()));
+
+  EXPECT_EQ(res.rank, 2u);
+  EXPECT_EQ(A, Matrix<Rational>({{Rational(1), Rational(0)}, {Rational(0), Rational(1)}}));
+  EXPECT_EQ(I, Matrix<Rational>({{Rational(3, 2), Rational(-1, 2)}, {Rational(-2), Rational(1)}}));
+}
+
+TEST(MatrixViewTest, AugmentedView_SolvesAgainstBlockOfLargerMatrix)
+{
+  // The system and its right-hand side live in different places of one buffer
+  Matrix<double> storage({
+    {1,-2, 1, 0, 0},
+    {0, 2,-8, 0, 8},
+    {5, 0,-5, 0,10}
+  });
+
+  AugmentedView<double> aug(storage.block(0, 0, 3, 3), storage.block(0, 4, 3, 1));
+  EXPECT_EQ(aug.cols(), 4u);
+  EXPECT_EQ(aug.at(2, 3), 10);
+
+  auto res = rref_in_place(aug);
+  EXPECT_EQ(res.rank, 3u);
+  EXPECT_NEAR(storage.at(0, 4), 1, 1e-12);
+  EXPECT_NEAR(storage.at(1, 4), 0, 1e-12);
+  EXPECT_NEAR(storage.at(2, 4), -1, 1e-12);
+  EXPECT_EQ(storage.at(1, 3), 0);
+}
+
+TEST(MatrixViewTest, AugmentedView_MismatchedRows_Throws)
+{
+  Matrix<double> a(3, 3), b(2, 1);
+  EXPECT_THROW(AugmentedView<double>(a.view(), b.view()), std::invalid_argument);
+}
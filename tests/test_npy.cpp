@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Npy.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+std::filesystem::path temp_path(const std::string& name)
+{
+  return std::filesystem::temp_directory_path() / name;
+}
+
+// Writes a version 1.0 .npy file with a hand-written header dictionary
+void write_raw_npy(const std::filesystem::path& path, const std::string& dict, const void* data, std::size_t bytes)
+{
+  std::string header = dict;
+  while ((10 + header.size() + 1) % 64 != 0) header.push_back(' ');
+  header.push_back('\n');
+
+  std::ofstream os(path, std::ios::binary);
+  os.write("\x93NUMPY\x01\x00", 8);
+  os.put(static_cast<char>(header.size() & 0xFF));
+  os.put(static_cast<char>(header.size() >> 8));
+  os << header;
+  os.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+}
+
+} // namespace
+
+// ==============================================================================
+// .npy
+// ==============================================================================
+
+TEST(NpyTest, SaveLoad_RoundTrip)
+{
+  Matrix<double> m({
+    {1.5, -2, 3},
+    {4, 5, 6.25}
+  });
+  const auto path = temp_path("lin_alg_npy_roundtrip.npy");
+  save_npy(path, m);
+
+  auto loaded = load_npy<double>(path);
+  std::filesystem::remove(path);
+
+  ASSERT_TRUE(loaded == m);
+}
+
+TEST(NpyTest, Save_HeaderIsAligned)
+{
+  Matrix<std::int32_t> m({{1, 2}});
+  const auto path = temp_path("lin_alg_npy_header.npy");
+  save_npy(path, m);
+
+  const auto size = std::filesystem::file_size(path);
+  std::filesystem::remove(path);
+
+  EXPECT_EQ((size - 2 * sizeof(std::int32_t)) % 64, 0u);
+}
+
+TEST(NpyTest, Load_FortranOrder_Transposes)
+{
+  const double data[] = {1, 4, 2, 5, 3, 6};
+  const auto path = temp_path("lin_alg_npy_fortran.npy");
+  write_raw_npy(path, "{'descr': '<f8', 'fortran_order': True, 'shape': (2, 3), }", data, sizeof(data));
+
+  auto m = load_npy<double>(path);
+  std::filesystem::remove(path);
+
+  Matrix<double> expected({
+    {1, 2, 3},
+    {4, 5, 6}
+  });
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(NpyTest, Load_ConvertsDtype)
+{
+  const std::int64_t data[] = {1, -2, 3};
+  const auto path = temp_path("lin_alg_npy_convert.npy");
+  write_raw_npy(path, "{'descr': '<i8', 'fortran_order': False, 'shape': (3,), }", data, sizeof(data));
+
+  auto m = load_npy<float>(path);
+  std::filesystem::remove(path);
+
+  Matrix<float> expected({{1}, {-2}, {3}});
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(NpyTest, Load_BigEndian_Swaps)
+{
+  const unsigned char data[] = {0, 0, 0, 1, 0, 0, 1, 0};
+  const auto path = temp_path("lin_alg_npy_be.npy");
+  write_raw_npy(path, "{'descr': '>i4', 'fortran_order': False, 'shape': (1, 2), }", data, sizeof(data));
+
+  auto m = load_npy<std::int32_t>(path);
+  std::filesystem::remove(path);
+
+  Matrix<std::int32_t> expected({{1, 256}});
+  ASSERT_TRUE(m == expected);
+}
+
+TEST(NpyTest, Load_UnsupportedDtype_Throws)
+{
+  const unsigned char data[] = {1, 2};
+  const auto path = temp_path("lin_alg_npy_u1.npy");
+  write_raw_npy(path, "{'descr': '|u1', 'fortran_order': False, 'shape': (2,), }", data, sizeof(data));
+
+  EXPECT_THROW(load_npy<double>(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(NpyTest, Load_OverflowingShape_Throws)
+{
+  // 2³¹ x 2³¹ doubles is 2⁶⁵ bytes, which wraps to zero in 64 bits
+  const double data[] = {1};
+  const auto path = temp_path("lin_alg_npy_huge.npy");
+  write_raw_npy(path, "{'descr': '<f8', 'fortran_order': False, 'shape': (2147483648, 2147483648), }", data, sizeof(data));
+
+  try {
+    load_npy<double>(path);
+    ADD_FAILURE() << "expected std::runtime_error";
+  } catch (const std::runtime_error& e) {
+    EXPECT_STREQ(e.what(), "NumPy shape is too large.");
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(NpyTest, View_ZeroCopy)
+{
+  Matrix<float> m({{1, 2}, {3, 4}});
+  const auto path = temp_path("lin_alg_npy_view.npy");
+  save_npy(path, m);
+
+  {
+    auto view = NpyView<float>::open(path);
+    EXPECT_EQ(view.rows(), 2u);
+    EXPECT_EQ(view.cols(), 2u);
+    EXPECT_EQ(view.row_at(1)[0], 3.0f);
+    EXPECT_TRUE(view.to_matrix() == m);
+    EXPECT_THROW(NpyView<double>::open(path), std::runtime_error);
+  }
+  std::filesystem::remove(path);
+}
+
+// ==============================================================================
+// .npz
+// ==============================================================================
+
+TEST(NpzTest, WriteRead_MultipleArrays)
+{
+  Matrix<double> a({{1, 2}, {3, 4}});
+  Matrix<std::int64_t> b({{5, 6, 7}});
+  const auto path = temp_path("lin_alg_npz.npz");
+  {
+    NpzWriter writer(path);
+    writer.add("a", a);
+    writer.add("b", b);
+    writer.close();
+  }
+
+  {
+    NpzArchive archive(path);
+    EXPECT_EQ(archive.names(), std::vector<std::string>({"a", "b"}));
+    EXPECT_TRUE(archive.load<double>("a") == a);
+    EXPECT_TRUE(archive.load<std::int64_t>("b") == b);
+    EXPECT_TRUE(archive.view<std::int64_t>("b").to_matrix() == b);
+    EXPECT_THROW(archive.load<double>("c"), std::out_of_range);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(NpzTest, CorruptCentralDirectory_Throws)
+{
+  const auto path = temp_path("lin_alg_npz_corrupt.npz");
+  {
+    NpzWriter writer(path);
+    writer.add("a", Matrix<double>({{1, 2}}));
+    writer.close();
+  }
+
+  // Point the first entry's file name length past the end of the archive
+  std::string bytes;
+  {
+    std::ifstream is(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(is), {});
+  }
+  const auto read32 = [&](std::size_t at) {
+    std::uint32_t v = 0;
+    for (int k = 3; k >= 0; --k) v = (v << 8) | static_cast<unsigned char>(bytes[at + k]);
+    return v;
+  };
+  const std::size_t dir = read32(bytes.size() - 22 + 16);
+  bytes[dir + 28] = bytes[dir + 29] = static_cast<char>(0xFF);
+  {
+    std::ofstream os(path, std::ios::binary);
+    os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+  }
+
+  EXPECT_THROW(NpzArchive archive(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(NpzTest, TooManyMembers_Throws)
+{
+  // The end of central directory record counts members in 16 bits
+  const auto path = temp_path("lin_alg_npz_many.npz");
+  {
+    NpzWriter writer(path);
+    const Matrix<float> one({{1}});
+    for (int i = 0; i < 0xFFFF; ++i) writer.add("m" + std::to_string(i), one);
+    EXPECT_THROW(writer.close(), std::runtime_error);
+  }
+  std::filesystem::remove(path);
+}
@@ -97,6 +97,28 @@ TEST(RationalTest, AdditionOverload)
   ASSERT_EQ(r2.denominator(), 3);
 }
 
+TEST(RationalTest, SubtractionOverload)
+{
+  Rational r1(5,7);
+  Rational r2(2,3);
+
+  auto diff1 = r1 - r2;
+  ASSERT_EQ(diff1.numerator(), 1);
+  ASSERT_EQ(diff1.denominator(), 21);
+
+  auto diff2 = r1 - 2;
+  ASSERT_EQ(diff2.numerator(), -9);
+  ASSERT_EQ(diff2.denominator(), 7);
+
+  r1 -= r2;
+  ASSERT_EQ(r1.numerator(), 1);
+  ASSERT_EQ(r1.denominator(), 21);
+
+  r2 -= 2;
+  ASSERT_EQ(r2.numerator(), -4);
+  ASSERT_EQ(r2.denominator(), 3);
+}
+
 TEST(RationalTest, EqualityOverload)
 {
   Rational r1(1,2);
@@ -110,3 +132,28 @@ TEST(RationalTest, EqualityOverload)
   ASSERT_TRUE(r1 == r3);
   ASSERT_FALSE(r2 == r3);
 }
+
+TEST(RationalTest, ConstantEvaluation)
+{
+  constexpr Rational r = Rational(1, 2) + Rational(1, 3) * 3;
+  static_assert(r == Rational(3, 2));
+  EXPECT_EQ(r.denominator(), 2);
+}
+
+TEST(RationalTest, Negation)
+{
+  Rational r(3, 4);
+  auto neg = -r;
+
+  ASSERT_EQ(neg.numerator(), -3);
+  ASSERT_EQ(neg.denominator(), 4);
+  ASSERT_TRUE(neg + r == Rational(0));
+}
+
+TEST(RationalTest, Reduce_NormalizesSignToNumerator)
+{
+  ASSERT_TRUE(Rational(1, -2) == Rational(-1, 2));
+  ASSERT_TRUE(Rational(-1, -1) == Rational(1));
+  ASSERT_EQ(Rational(4, -6).denominator(), 3);
+  ASSERT_EQ(Rational(4, -6).numerator(), -2);
+}
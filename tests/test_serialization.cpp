@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+#include <lin_alg/Serialization.hpp>
+#include <sstream>
+#include <stdexcept>
+
+// bool would be read back raw, and any byte other than 0 or 1 is undefined as a bool
+static_assert(!lin_alg::detail::is_raw_serializable_v<bool>);
+static_assert(lin_alg::detail::is_raw_serializable_v<unsigned char>);
+
+// ==============================================================================
+// Round Trips
+// ==============================================================================
+
+TEST(SerializationTest, RoundTrip_Double)
+{
+  Matrix<double> m({
+    {1.5, -2.25, 3},
+    {4, 5.125, -6e300}
+  });
+
+  std::stringstream ss;
+  serialize(ss, m);
+  auto actual = deserialize<double>(ss);
+
+  ASSERT_TRUE(actual == m);
+}
+
+TEST(SerializationTest, RoundTrip_Int64)
+{
+  Matrix<std::int64_t> m({
+    {1, -2},
+    {INT64_MAX, INT64_MIN}
+  });
+
+  std::stringstream ss;
+  serialize(ss, m);
+
+  ASSERT_TRUE(deserialize<std::int64_t>(ss) == m);
+}
+
+TEST(SerializationTest, RoundTrip_Rational)
+{
+  Matrix<Rational> m({
+    {Rational(1, 2), Rational(3)},
+    {Rational(5, 7), Rational(0)}
+  });
+
+  std::stringstream ss;
+  serialize(ss, m);
+
+  ASSERT_TRUE(deserialize<Rational>(ss) == m);
+}
+
+TEST(SerializationTest, RoundTrip_SmallChunks)
+{
+  Matrix<float> m(7, 13);
+  for (std::size_t i = 0; i < m.data().size(); ++i)
+    m.data()[i] = static_cast<float>(i) * 0.5f;
+
+  std::stringstream ss;
+  serialize(ss, m, 12);
+
+  ASSERT_TRUE(deserialize<float>(ss, 20) == m);
+}
+
+// ==============================================================================
+// Streaming
+// ==============================================================================
+
+TEST(SerializationTest, StreamingWriter_RowBlocks)
+{
+  std::stringstream ss;
+  MatrixWriter<int> writer(ss, 3, 2);
+  std::vector<int> first = {1, 2, 3, 4};
+  std::vector<int> last = {5, 6};
+  writer.write_rows(first);
+  writer.write_rows(last);
+  writer.finish();
+
+  MatrixReader<int> reader(ss);
+  EXPECT_EQ(reader.rows(), 3u);
+  EXPECT_EQ(reader.cols(), 2u);
+
+  std::vector<int> row(2);
+  reader.read_rows(row);
+  EXPECT_EQ(row, std::vector<int>({1, 2}));
+  std::vector<int> rest(4);
+  reader.read_rows(rest);
+  EXPECT_EQ(rest, std::vector<int>({3, 4, 5, 6}));
+  EXPECT_NO_THROW(reader.finish());
+}
+
+TEST(SerializationTest, StreamingWriter_PartialRow_Throws)
+{
+  std::stringstream ss;
+  MatrixWriter<int> writer(ss, 2, 2);
+  std::vector<int> partial = {1, 2, 3};
+  EXPECT_THROW(writer.write_rows(partial), std::invalid_argument);
+}
+
+TEST(SerializationTest, StreamingWriter_FinishEarly_Throws)
+{
+  std::stringstream ss;
+  MatrixWriter<int> writer(ss, 2, 2);
+  EXPECT_THROW(writer.finish(), std::logic_error);
+}
+
+// ==============================================================================
+// Validation
+// ==============================================================================
+
+TEST(SerializationTest, Deserialize_WrongType_Throws)
+{
+  Matrix<double> m({{1, 2}});
+  std::stringstream ss;
+  serialize(ss, m);
+
+  EXPECT_THROW(deserialize<float>(ss), std::runtime_error);
+}
+
+TEST(SerializationTest, Deserialize_CorruptPayload_Throws)
+{
+  Matrix<double> m({{1, 2}, {3, 4}});
+  std::stringstream ss;
+  serialize(ss, m);
+
+  std::string bytes = ss.str();
+  bytes[45] ^= 0x10;
+  std::stringstream corrupt(bytes);
+
+  EXPECT_THROW(deserialize<double>(corrupt), std::runtime_error);
+}
+
+TEST(SerializationTest, Deserialize_CorruptHeader_Throws)
+{
+  Matrix<double> m({{1, 2}, {3, 4}});
+  std::stringstream ss;
+  serialize(ss, m);
+
+  std::string bytes = ss.str();
+  bytes[16] = 3;
+  std::stringstream corrupt(bytes);
+
+  EXPECT_THROW(deserialize<double>(corrupt), std::runtime_error);
+}
+
+TEST(SerializationTest, Deserialize_Truncated_Throws)
+{
+  Matrix<double> m({{1, 2}, {3, 4}});
+  std::stringstream ss;
+  serialize(ss, m);
+
+  std::stringstream truncated(ss.str().substr(0, 50));
+  EXPECT_THROW(deserialize<double>(truncated), std::runtime_error);
+}
+
+TEST(SerializationTest, Deserialize_ForeignByteOrder_Swaps)
+{
+  Matrix<std::uint32_t> m({{0x01020304u, 0xA0B0C0D0u}});
+  std::stringstream ss;
+  serialize(ss, m);
+
+  // Rewrite the stream as if produced on a host of the opposite byte order
+  std::string bytes = ss.str();
+  bytes[7] = static_cast<char>(bytes[7] ^ 1);
+  lin_alg::detail::Checksum64 header_sum;
+  header_sum.update(bytes.data(), 32);
+  lin_alg::detail::store_le(reinterpret_cast<unsigned char*>(&bytes[32]), header_sum.value(), 8);
+  std::reverse(bytes.begin() + 40, bytes.begin() + 44);
+  std::reverse(bytes.begin() + 44, bytes.begin() + 48);
+  lin_alg::detail::Checksum64 payload_sum;
+  payload_sum.update(bytes.data() + 40, 8);
+  lin_alg::detail::store_le(reinterpret_cast<unsigned char*>(&bytes[48]), payload_sum.value(), 8);
+
+  std::stringstream foreign(bytes);
+  ASSERT_TRUE(deserialize<std::uint32_t>(foreign) == m);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Concepts.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+#include <lin_alg/StructuredMatrix.hpp>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+static_assert(LinearOperator<ToeplitzMatrix<double>>);
+static_assert(LinearOperator<HankelMatrix<double>>);
+static_assert(LinearOperator<VandermondeMatrix<double>>);
+
+namespace {
+
+using test_utils::random_vector;
+
+/** Largest entry of |A x - b| for a dense A. */
+double residual(const Matrix<double>& A, const std::vector<double>& x, const std::vector<double>& b)
+{
+  double worst = 0;
+  for (size_t i = 0; i < A.rows(); ++i) {
+    double sum = -b[i];
+    for (size_t j = 0; j < A.cols(); ++j) sum += A.at(i, j) * x[j];
+    worst = std::max(worst, std::abs(sum));
+  }
+  return worst;
+}
+
+} // namespace
+
+// ==============================================================================
+// Toeplitz
+// ==============================================================================
+
+TEST(ToeplitzMatrixTest, Layout_ProductAndDense)
+{
+  std::vector<int> col = {1, 2, 3};
+  std::vector<int> row = {1, 4, 5, 6};
+  ToeplitzMatrix<int> t(col, row);
+
+  EXPECT_EQ(t.rows(), 3u);
+  EXPECT_EQ(t.cols(), 4u);
+  EXPECT_EQ(t.to_dense(), Matrix<int>({
+    {1, 4, 5, 6},
+    {2, 1, 4, 5},
+    {3, 2, 1, 4}
+  }));
+  EXPECT_EQ(t.at(2, 1), 2);
+  EXPECT_THROW(t.at(3, 0), std::out_of_range);
+
+  std::vector<int> x = {1, -1, 2, 0};
+  EXPECT_EQ(t * std::span<const int>(x), std::vector<int>({7, 9, 3}));
+  EXPECT_THROW(t * std::span<const int>(col), std::invalid_argument);
+
+  std::vector<int> bad = {9, 4};
+  EXPECT_THROW(ToeplitzMatrix<int>(bad, row), std::invalid_argument);
+  EXPECT_THROW(ToeplitzMatrix<int>(std::vector<int>{}, row), std::invalid_argument);
+}
+
+TEST(ToeplitzMatrixTest, Solve_NonsymmetricDiagonallyDominant)
+{
+  const size_t n = 300;
+  std::vector<double> col = random_vector(n, 1), row = random_vector(n, 2);
+  for (size_t k = 1; k < n; ++k) {
+    col[k] /= static_cast<double>(k * k);
+    row[k] /= static_cast<double>(k * k);
+  }
+  col[0] = row[0] = 3.0;
+  ToeplitzMatrix<double> t(col, row);
+
+  const std::vector<double> b = random_vector(n, 3);
+  const std::vector<double> x = t.solve(b);
+  EXPECT_LT(residual(t.to_dense(), x, b), 1e-12);
+}
+
+TEST(ToeplitzMatrixTest, Solve_RationalIsExact)
+{
+  std::vector<Rational> col = {Rational(4), Rational(1), Rational(-2), Rational(1, 3)};
+  std::vector<Rational> row = {Rational(4), Rational(3), Rational(1, 2), Rational(5)};
+  ToeplitzMatrix<Rational> t(col, row);
+  std::vector<Rational> b = {Rational(1), Rational(0), Rational(2), Rational(-1)};
+
+  const std::vector<Rational> x = t.solve(b);
+  EXPECT_EQ(x, *t.to_dense().solution(b));
+}
+
+TEST(ToeplitzMatrixTest, Solve_SingularLeadingBlockThrows)
+{
+  std::vector<double> col = {0, 1};
+  std::vector<double> row = {0, 1};
+  std::vector<double> b = {1, 1};
+  EXPECT_THROW(ToeplitzMatrix<double>(col, row).solve(b), std::runtime_error);
+
+  std::vector<double> wide = {0, 1, 2};
+  EXPECT_THROW(ToeplitzMatrix<double>(col, wide).solve(b), std::invalid_argument);
+}
+
+// ==============================================================================
+// Hankel
+// ==============================================================================
+
+TEST(HankelMatrixTest, Layout_ProductAndDense)
+{
+  std::vector<int> col = {1, 2, 3};
+  std::vector<int> row = {3, 4};
+  HankelMatrix<int> h(col, row);
+
+  EXPECT_EQ(h.to_dense(), Matrix<int>({
+    {1, 2},
+    {2, 3},
+    {3, 4}
+  }));
+  EXPECT_EQ(h.at(1, 1), 3);
+
+  std::vector<int> x = {1, -1};
+  EXPECT_EQ(h * std::span<const int>(x), std::vector<int>({-1, -1, -1}));
+
+  std::vector<int> bad = {5, 4};
+  EXPECT_THROW(HankelMatrix<int>(col, bad), std::invalid_argument);
+}
+
+TEST(HankelMatrixTest, Solve_MatchesDense)
+{
+  std::vector<Rational> col = {Rational(1), Rational(2), Rational(-1), Rational(3)};
+  std::vector<Rational> row = {Rational(3), Rational(1, 2), Rational(7), Rational(-4)};
+  HankelMatrix<Rational> h(col, row);
+  std::vector<Rational> b = {Rational(2), Rational(-1), Rational(0), Rational(5)};
+
+  EXPECT_EQ(h.solve(b), *h.to_dense().solution(b));
+
+  const size_t n = 120;
+  std::vector<double> hc = random_vector(n, 4), hr = random_vector(n, 5);
+  for (size_t k = 0; k < n; ++k) hc[k] /= static_cast<double>((n - k) * (n - k));
+  hc[n - 1] = hr[0] = 3.0;
+  for (size_t k = 1; k < n; ++k) hr[k] /= static_cast<double>(k * k);
+  HankelMatrix<double> big(hc, hr);
+  const std::vector<double> rhs = random_vector(n, 6);
+  EXPECT_LT(residual(big.to_dense(), big.solve(rhs), rhs), 1e-12);
+}
+
+// ==============================================================================
+// Vandermonde
+// ==============================================================================
+
+TEST(VandermondeMatrixTest, Layout_ProductAndDense)
+{
+  std::vector<int> nodes = {2, -1, 3};
+  VandermondeMatrix<int> v(nodes, 4);
+
+  EXPECT_EQ(v.to_dense(), Matrix<int>({
+    {1, 2, 4, 8},
+    {1, -1, 1, -1},
+    {1, 3, 9, 27}
+  }));
+  EXPECT_EQ(v.at(2, 3), 27);
+  EXPECT_THROW(v.at(0, 4), std::out_of_range);
+
+  // 1 + x² evaluated at every node
+  std::vector<int> coeffs = {1, 0, 1, 0};
+  EXPECT_EQ(v * std::span<const int>(coeffs), std::vector<int>({5, 2, 10}));
+}
+
+TEST(VandermondeMatrixTest, Solve_InterpolatesExactly)
+{
+  // The cubic through (0, 1), (1, 2), (2, 9), (3, 28) is x³ + 1
+  std::vector<Rational> nodes = {Rational(0), Rational(1), Rational(2), Rational(3)};
+  std::vector<Rational> values = {Rational(1), Rational(2), Rational(9), Rational(28)};
+  VandermondeMatrix<Rational> v(nodes);
+  EXPECT_EQ(v.solve(values), std::vector<Rational>({Rational(1), Rational(0), Rational(0), Rational(1)}));
+
+  std::vector<Rational> repeated = {Rational(1), Rational(2), Rational(1)};
+  std::vector<Rational> rhs = {Rational(1), Rational(1), Rational(1)};
+  EXPECT_THROW(VandermondeMatrix<Rational>(repeated).solve(rhs), std::runtime_error);
+}
+
+TEST(VandermondeMatrixTest, Solve_ChebyshevNodes)
+{
+  const size_t n = 16;
+  std::vector<double> nodes(n);
+  for (size_t i = 0; i < n; ++i) nodes[i] = -std::cos(std::numbers::pi * (static_cast<double>(i) + 0.5) / n);
+  VandermondeMatrix<double> v(nodes);
+
+  const std::vector<double> f = random_vector(n, 7);
+  const std::vector<double> c = v.solve(f);
+  const std::vector<double> back = v * std::span<const double>(c);
+  for (size_t i = 0; i < n; ++i) EXPECT_NEAR(back[i], f[i], 1e-10);
+}
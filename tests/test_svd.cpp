@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/SVD.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_matrix;
+
+/** Checks A = U Σ Vᵀ, orthonormal columns of U and V, and descending singular values. */
+void expect_decomposition(const Matrix<double>& A, const SVD<double>& svd, double tol)
+{
+  const Matrix<double>& U = svd.left_singular_vectors();
+  const Matrix<double>& V = svd.right_singular_vectors();
+  const auto& s = svd.singular_values();
+  const size_t m = A.rows(), n = A.cols(), p = std::min(m, n);
+  ASSERT_EQ(U.rows(), m);
+  ASSERT_EQ(V.rows(), n);
+  ASSERT_EQ(U.cols(), p);
+  ASSERT_EQ(V.cols(), p);
+  ASSERT_EQ(s.size(), p);
+
+  for (size_t k = 1; k < p; ++k) EXPECT_GE(s[k - 1], s[k]);
+  for (size_t i = 0; i < m; ++i)
+    for (size_t j = 0; j < n; ++j) {
+      double sum = 0;
+      for (size_t k = 0; k < p; ++k) sum += U.at(i, k) * s[k] * V.at(j, k);
+      ASSERT_NEAR(sum, A.at(i, j), tol);
+    }
+  for (const Matrix<double>* Q : {&U, &V})
+    for (size_t a = 0; a < p; ++a)
+      for (size_t b = 0; b < p; ++b) {
+        double sum = 0;
+        for (size_t i = 0; i < Q->rows(); ++i) sum += Q->at(i, a) * Q->at(i, b);
+        ASSERT_NEAR(sum, a == b ? 1.0 : 0.0, tol);
+      }
+}
+
+} // namespace
+
+TEST(SVDTest, TallAndWide_Reconstruct)
+{
+  const Matrix<double> tall = random_matrix<double>(60, 40, 1);
+  expect_decomposition(tall, SVD<double>(tall), 1e-12);
+
+  const Matrix<double> wide = random_matrix<double>(25, 70, 2);
+  expect_decomposition(wide, SVD<double>(wide), 1e-12);
+}
+
+TEST(SVDTest, KnownSingularValues)
+{
+  // Orthogonal columns scaled by 3, 2 and 1, shuffled
+  Matrix<double> A({
+    {0, 3, 0},
+    {2, 0, 0},
+    {0, 0, -1},
+    {0, 0, 0}
+  });
+  SVD<double> svd(A);
+  EXPECT_NEAR(svd.singular_values()[0], 3, 1e-15);
+  EXPECT_NEAR(svd.singular_values()[1], 2, 1e-15);
+  EXPECT_NEAR(svd.singular_values()[2], 1, 1e-15);
+  expect_decomposition(A, svd, 1e-15);
+}
+
+TEST(SVDTest, LargeMatrix_RunsParallelRounds)
+{
+  const Matrix<double> A = random_matrix<double>(300, 180, 3);
+  expect_decomposition(A, SVD<double>(A), 1e-11);
+}
+
+TEST(SVDTest, GradedColumns_HighRelativeAccuracy)
+{
+  // Scaling the columns of a well-conditioned matrix over 15 orders of magnitude:
+  // Jacobi keeps every singular value to nearly full relative precision, which a
+  // method working on AᵀA could not
+  const size_t m = 8, n = 5;
+  const Matrix<double> B = random_matrix<double>(m, n, 4);
+  Matrix<double> A(m, n);
+  Matrix<long double> Al(m, n);
+  for (size_t j = 0; j < n; ++j) {
+    const double d = std::pow(10.0, -3.75 * static_cast<double>(j));
+    for (size_t i = 0; i < m; ++i) {
+      A.at(i, j) = B.at(i, j) * d;
+      Al.at(i, j) = static_cast<long double>(A.at(i, j));
+    }
+  }
+
+  const SVD<double> svd(A);
+  const SVD<long double> reference(Al);
+  for (size_t k = 0; k < n; ++k) {
+    const double exact = static_cast<double>(reference.singular_values()[k]);
+    EXPECT_NEAR(svd.singular_values()[k] / exact, 1.0, 1e-13) << "sigma " << k;
+  }
+}
+
+TEST(SVDTest, RankDeficient_MinimumNormSolution)
+{
+  // Third column = first + second, so (1, 1, -1) spans the null space
+  Matrix<double> A({
+    {1, 0, 1},
+    {0, 1, 1},
+    {1, 1, 2},
+    {2, -1, 1}
+  });
+  SVD<double> svd(A);
+  EXPECT_EQ(svd.rank(), 2u);
+
+  // Consistent right-hand side: A (1, 2, 0) = b
+  std::vector<double> b = {1, 2, 3, 0};
+  std::vector<double> x = least_squares(A, b);
+  ASSERT_EQ(x.size(), 3u);
+  for (size_t i = 0; i < 4; ++i) EXPECT_NEAR(A.at(i, 0) * x[0] + A.at(i, 1) * x[1] + A.at(i, 2) * x[2], b[i], 1e-12);
+  EXPECT_NEAR(x[0] + x[1] - x[2], 0.0, 1e-12);
+
+  // solution() sets the free variable to zero instead, a longer vector
+  std::vector<double> basic = *A.solution(b);
+  EXPECT_LT(x[0] * x[0] + x[1] * x[1] + x[2] * x[2], basic[0] * basic[0] + basic[1] * basic[1] + basic[2] * basic[2]);
+
+  EXPECT_THROW(svd.solve(x), std::invalid_argument);
+}
+
+TEST(SVDTest, Inconsistent_LeastSquaresResidualIsOrthogonal)
+{
+  const Matrix<double> A = random_matrix<double>(30, 4, 5);
+  std::vector<double> b(30);
+  for (size_t i = 0; i < 30; ++i) b[i] = std::sin(static_cast<double>(i));
+
+  std::vector<double> x = least_squares(A, b);
+  std::vector<double> r(b);
+  for (size_t i = 0; i < 30; ++i)
+    for (size_t j = 0; j < 4; ++j) r[i] -= A.at(i, j) * x[j];
+  for (size_t j = 0; j < 4; ++j) {
+    double dot = 0;
+    for (size_t i = 0; i < 30; ++i) dot += A.at(i, j) * r[i];
+    EXPECT_NEAR(dot, 0.0, 1e-12);
+  }
+}
+
+TEST(SVDTest, Pinv_PenroseConditions)
+{
+  // Rank 2, wider than tall
+  Matrix<double> A({
+    {1, 2, 3, 4, 5},
+    {2, 4, 6, 8, 10},
+    {1, 0, 1, 0, 1}
+  });
+  const Matrix<double> P = pinv(A);
+  ASSERT_EQ(P.rows(), 5u);
+  ASSERT_EQ(P.cols(), 3u);
+
+  const Matrix<double> APA = A * P * A, PAP = P * A * P, AP = A * P, PA = P * A;
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 5; ++j) EXPECT_NEAR(APA.at(i, j), A.at(i, j), 1e-12);
+  for (size_t i = 0; i < 5; ++i)
+    for (size_t j = 0; j < 3; ++j) EXPECT_NEAR(PAP.at(i, j), P.at(i, j), 1e-12);
+  for (size_t i = 0; i < 3; ++i)
+    for (size_t j = 0; j < 3; ++j) EXPECT_NEAR(AP.at(i, j), AP.at(j, i), 1e-12);
+  for (size_t i = 0; i < 5; ++i)
+    for (size_t j = 0; j < 5; ++j) EXPECT_NEAR(PA.at(i, j), PA.at(j, i), 1e-12);
+}
+
+TEST(SVDTest, ZeroMatrix)
+{
+  SVD<double> svd(Matrix<double>(3, 2));
+  EXPECT_EQ(svd.rank(), 0u);
+  EXPECT_EQ(svd.singular_values(), std::vector<double>({0, 0}));
+  EXPECT_EQ(svd.pinv(), Matrix<double>(2, 3));
+  EXPECT_EQ(svd.solve(std::vector<double>{1, 2, 3}), std::vector<double>({0, 0}));
+}
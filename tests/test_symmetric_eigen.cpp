@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/SymmetricEigen.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "TestUtils.hpp"
+
+namespace {
+
+using test_utils::random_symmetric;
+
+/** Largest entry of |A V - V Λ / scale| and of |Vᵀ V - I|, for @p eig computed from scale * A. */
+void expect_eigenpairs(const Matrix<double>& A, const SymmetricEigen<double>& eig, double tol, double scale = 1)
+{
+  const Matrix<double>& V = eig.eigenvectors();
+  const auto& w = eig.eigenvalues();
+  const size_t n = A.rows(), k = V.cols();
+  ASSERT_EQ(w.size(), k);
+
+  const Matrix<double> AV = A * V;
+  double residual = 0, orthogonality = 0;
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < k; ++j)
+      residual = std::max(residual, std::abs(AV.at(i, j) - V.at(i, j) * (w[j] / scale)));
+  for (size_t p = 0; p < k; ++p)
+    for (size_t q = 0; q < k; ++q) {
+      double s = 0;
+      for (size_t i = 0; i < n; ++i) s += V.at(i, p) * V.at(i, q);
+      orthogonality = std::max(orthogonality, std::abs(s - (p == q ? 1.0 : 0.0)));
+    }
+  for (size_t j = 1; j < k; ++j) EXPECT_LE(w[j - 1], w[j]);
+  // Negated so that NaN fails
+  EXPECT_FALSE(residual >= tol) << residual;
+  EXPECT_FALSE(orthogonality >= tol) << orthogonality;
+}
+
+} // namespace
+
+TEST(SymmetricEigenTest, SmallKnownSpectrum)
+{
+  Matrix<double> A({{2, 1}, {1, 2}});
+  SymmetricEigen<double> eig(A);
+  EXPECT_NEAR(eig.eigenvalues()[0], 1, 1e-14);
+  EXPECT_NEAR(eig.eigenvalues()[1], 3, 1e-14);
+  expect_eigenpairs(A, eig, 1e-14);
+}
+
+TEST(SymmetricEigenTest, ReadsOnlyLowerTriangle)
+{
+  Matrix<double> A({{2, 100}, {1, 2}});
+  SymmetricEigen<double> eig(A);
+  EXPECT_NEAR(eig.eigenvalues()[0], 1, 1e-14);
+  EXPECT_NEAR(eig.eigenvalues()[1], 3, 1e-14);
+}
+
+TEST(SymmetricEigenTest, RandomMatrixFullSpectrum)
+{
+  // Large enough for several reduction panels and divide-and-conquer levels
+  const size_t n = 300;
+  Matrix<double> A = random_symmetric(n, 7);
+  SymmetricEigen<double> eig(A);
+  expect_eigenpairs(A, eig, 1e-11);
+
+  double sum = 0;
+  for (double w : eig.eigenvalues()) sum += w;
+  EXPECT_NEAR(sum, A.trace(), 1e-10);
+}
+
+TEST(SymmetricEigenTest, RepeatedEigenvaluesDeflate)
+{
+  // I + 1 1ᵀ has eigenvalue 1 with multiplicity n - 1, and n + 1
+  const size_t n = 120;
+  Matrix<double> A(n, n);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j) A.at(i, j) = i == j ? 2 : 1;
+
+  SymmetricEigen<double> eig(A);
+  for (size_t j = 0; j + 1 < n; ++j) EXPECT_NEAR(eig.eigenvalues()[j], 1, 1e-12);
+  EXPECT_NEAR(eig.eigenvalues()[n - 1], n + 1.0, 1e-11);
+  expect_eigenpairs(A, eig, 1e-12);
+}
+
+TEST(SymmetricEigenTest, DiagonalMatrix)
+{
+  const size_t n = 70;
+  Matrix<double> A(n, n);
+  for (size_t i = 0; i < n; ++i) A.at(i, i) = static_cast<double>((i * 37) % n);
+
+  SymmetricEigen<double> eig(A);
+  for (size_t j = 0; j < n; ++j) EXPECT_EQ(eig.eigenvalues()[j], static_cast<double>(j));
+  expect_eigenpairs(A, eig, 1e-14);
+}
+
+TEST(SymmetricEigenTest, PartialSpectrumMatchesFull)
+{
+  const size_t n = 150, k = 6;
+  Matrix<double> A = random_symmetric(n, 11);
+  SymmetricEigen<double> full(A);
+  SymmetricEigen<double> smallest(A, k);
+  SymmetricEigen<double> largest(A, k, Spectrum::Largest);
+
+  ASSERT_EQ(smallest.eigenvectors().cols(), k);
+  for (size_t j = 0; j < k; ++j) {
+    EXPECT_NEAR(smallest.eigenvalues()[j], full.eigenvalues()[j], 1e-12);
+    EXPECT_NEAR(largest.eigenvalues()[j], full.eigenvalues()[n - k + j], 1e-12);
+  }
+  expect_eigenpairs(A, smallest, 1e-11);
+  expect_eigenpairs(A, largest, 1e-11);
+}
+
+TEST(SymmetricEigenTest, PartialSpectrumWithClusteredEigenvalues)
+{
+  const size_t n = 60;
+  Matrix<double> A(n, n);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j) A.at(i, j) = i == j ? 2 : 1;
+
+  SymmetricEigen<double> eig(A, 5);
+  for (double w : eig.eigenvalues()) EXPECT_NEAR(w, 1, 1e-12);
+  expect_eigenpairs(A, eig, 1e-11);
+}
+
+TEST(SymmetricEigenTest, TinyAndHugeScales)
+{
+  // Far from 1 the secular equation overflows or deflates everything unless the problem is rescaled
+  const size_t n = 100;
+  const Matrix<double> A = random_symmetric(n, 13);
+  const SymmetricEigen<double> reference(A);
+  for (double scale : {1e-150, 1e-300, 1e155, 1e300}) {
+    const Matrix<double> scaled = A * scale;
+    SymmetricEigen<double> full(scaled);
+    expect_eigenpairs(A, full, 1e-11, scale);
+    for (size_t j = 0; j < n; ++j) EXPECT_NEAR(full.eigenvalues()[j] / scale, reference.eigenvalues()[j], 1e-12);
+
+    SymmetricEigen<double> smallest(scaled, 4);
+    expect_eigenpairs(A, smallest, 1e-11, scale);
+    for (size_t j = 0; j < 4; ++j) EXPECT_NEAR(smallest.eigenvalues()[j] / scale, reference.eigenvalues()[j], 1e-12);
+  }
+
+  SymmetricEigen<double> zero(Matrix<double>(n, n));
+  for (double w : zero.eigenvalues()) EXPECT_EQ(w, 0.0);
+  expect_eigenpairs(Matrix<double>(n, n), zero, 1e-15);
+}
+
+TEST(SymmetricEigenTest, GradedMatrix)
+{
+  // A(i, j) = 2^-(i+j) has entries down to 2^-378, whose squares underflow during the reduction
+  for (size_t n : {150, 190}) {
+    Matrix<double> A(n, n);
+    for (size_t i = 0; i < n; ++i)
+      for (size_t j = 0; j < n; ++j) A.at(i, j) = std::ldexp(1.0, -static_cast<int>(i + j));
+
+    SymmetricEigen<double> full(A);
+    expect_eigenpairs(A, full, 1e-13);
+    EXPECT_NEAR(full.eigenvalues()[n - 1], 4.0 / 3.0, 1e-14);
+    expect_eigenpairs(A, SymmetricEigen<double>(A, 3, Spectrum::Largest), 1e-13);
+  }
+}
+
+TEST(SymmetricEigenTest, InvalidArguments)
+{
+  EXPECT_THROW(SymmetricEigen<double>(Matrix<double>(2, 3)), std::invalid_argument);
+  EXPECT_THROW(SymmetricEigen<double>(Matrix<double>(3, 3), 0), std::invalid_argument);
+  EXPECT_THROW(SymmetricEigen<double>(Matrix<double>(3, 3), 4), std::invalid_argument);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+#include <lin_alg/LU.hpp>
+#include <lin_alg/Matrix.hpp>
+#include <lin_alg/Rational.hpp>
+#include <lin_alg/Triangular.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// Well-conditioned test matrix with garbage in both triangles
+Matrix<double> filled(size_t n, size_t m)
+{
+  Matrix<double> a(n, m);
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < m; ++j)
+      a.at(i, j) = (i == j ? n : 0) + static_cast<double>((i * 13 + j * 7) % 17) / 17.0 - 0.5;
+  return a;
+}
+
+} // namespace
+
+TEST(TriangularTest, At_MasksOtherTriangle)
+{
+  Matrix<int> m({
+    {1, 2, 3},
+    {4, 5, 6},
+    {7, 8, 9}
+  });
+
+  auto U = upper_triangular(m);
+  auto L = lower_triangular(m, Diag::Unit);
+  EXPECT_EQ(U.to_matrix(), Matrix<int>({{1, 2, 3}, {0, 5, 6}, {0, 0, 9}}));
+  EXPECT_EQ(L.to_matrix(), Matrix<int>({{1, 0, 0}, {4, 1, 0}, {7, 8, 1}}));
+  EXPECT_THROW(U.at(3, 0), std::out_of_range);
+  EXPECT_THROW(upper_triangular(Matrix<int>(2, 3)), std::invalid_argument);
+}
+
+TEST(TriangularTest, Solve_SingleRightHandSide_Rational)
+{
+  Matrix<Rational> m({
+    {Rational(2), Rational(1), Rational(-1)},
+    {Rational(0), Rational(3), Rational(2)},
+    {Rational(0), Rational(0), Rational(4)}
+  });
+  std::vector<Rational> b = {Rational(1), Rational(2), Rational(3)};
+
+  auto x = upper_triangular(m).solve(std::span<const Rational>(b));
+  EXPECT_EQ(upper_triangular(m).multiply(std::span<const Rational>(x)), b);
+  EXPECT_EQ(x[2], Rational(3, 4));
+}
+
+TEST(TriangularTest, SolveAndMultiply_LargeBlocked)
+{
+  // Larger than one block, with enough columns to split across threads
+  const size_t n = 150, m = 600;
+  Matrix<double> A = filled(n, n);
+  Matrix<double> B = filled(n, m);
+
+  for (Uplo uplo : {Uplo::Lower, Uplo::Upper})
+    for (Diag diag : {Diag::NonUnit, Diag::Unit}) {
+      TriangularView<double> T(A.view(), uplo, diag);
+
+      Matrix<double> product = T.multiply(B);
+      Matrix<double> dense = T.to_matrix() * B;
+      for (size_t i = 0; i < product.data().size(); ++i)
+        ASSERT_NEAR(product.data()[i], dense.data()[i], 1e-9);
+
+      Matrix<double> X = T.solve(product);
+      for (size_t i = 0; i < X.data().size(); ++i)
+        ASSERT_NEAR(X.data()[i], B.data()[i], 1e-9);
+    }
+}
+
+TEST(TriangularTest, SolveInPlace_OnBlockView)
+{
+  Matrix<double> A({{2, 0}, {1, 4}});
+  Matrix<double> storage({
+    {9, 2, 9},
+    {9, 9, 9}
+  });
+  storage.at(1, 1) = 5;
+
+  lower_triangular(A).solve_in_place(storage.block(0, 1, 2, 1));
+  EXPECT_EQ(storage.at(0, 1), 1);
+  EXPECT_EQ(storage.at(1, 1), 1);
+  EXPECT_EQ(storage.at(0, 0), 9);
+}
+
+TEST(TriangularTest, Singular_Throws)
+{
+  Matrix<double> m({{1, 2}, {0, 0}});
+  EXPECT_THROW(upper_triangular(m).solve(std::vector<double>{1, 1}), std::runtime_error);
+  EXPECT_NO_THROW(upper_triangular(m, Diag::Unit).solve(std::vector<double>{1, 1}));
+  EXPECT_THROW(upper_triangular(m).solve(Matrix<double>(3, 1)), std::invalid_argument);
+}
+
+TEST(TriangularTest, LUFactors)
+{
+  Matrix<double> A = filled(5, 5);
+  LU<double> lu(A);
+
+  Matrix<double> product = lu.lower().multiply(lu.upper().to_matrix());
+  for (size_t i = 0; i < 5; ++i)
+    for (size_t j = 0; j < 5; ++j)
+      EXPECT_NEAR(product.at(i, j), A.at(lu.permutation()[i], j), 1e-12);
+}